@@ -18,6 +18,11 @@
         http://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.6
 */
 
+/* The trace timings use clock_gettime, which strict C11 headers only declare when asked for POSIX */
+#if defined(GLAD_TRACE) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -161,95 +166,150 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension registry. Every extension name is copied once into a single block of memory, which also
+ * holds an open addressing hash set keyed by the FNV-1a hash of the name (the same hash as
+ * "GL_x"_extension in src/gl_features.h, so the app can look extensions up by a hash worked out at
+ * compile time). It's rebuilt each time gladLoadGLLoader runs and kept afterwards, so asking about an
+ * extension never has to go back to GL or scan a list.
+ */
+#include <glad/glad_extras.h>
+
+typedef struct {
+    unsigned int hash;
+    const char *name;
+} glad_extension;
+
+static void *glad_ext_block = NULL;
+static glad_extension *glad_ext_table = NULL;
+static unsigned int glad_ext_capacity = 0;
+static int glad_ext_count = 0;
+
+static unsigned int glad_ext_hash(const char *name, size_t length) {
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < length; index++) {
+        hash = (hash ^ (unsigned char)name[index]) * 16777619u;
+    }
+    return hash;
+}
+
+/* With name NULL only the hash is compared */
+static const glad_extension *glad_ext_find(unsigned int hash, const char *name) {
+    unsigned int slot;
+    if(glad_ext_table == NULL) return NULL;
+    for(slot = hash & (glad_ext_capacity - 1); glad_ext_table[slot].name != NULL; slot = (slot + 1) & (glad_ext_capacity - 1)) {
+        if(glad_ext_table[slot].hash == hash && (name == NULL || strcmp(glad_ext_table[slot].name, name) == 0)) {
+            return &glad_ext_table[slot];
+        }
+    }
+    return NULL;
+}
+
+static void glad_ext_insert(const char *name, size_t length, char **arena) {
+    char *copy = *arena;
+    unsigned int hash;
+    unsigned int slot;
+    if(length == 0) return;
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+    hash = glad_ext_hash(copy, length);
+    if(glad_ext_find(hash, copy) != NULL) return;
+    *arena += length + 1;
+
+    for(slot = hash & (glad_ext_capacity - 1); glad_ext_table[slot].name != NULL; slot = (slot + 1) & (glad_ext_capacity - 1));
+    glad_ext_table[slot].hash = hash;
+    glad_ext_table[slot].name = copy;
+    glad_ext_count++;
+}
 
 static int get_exts(void) {
+    const char *exts = NULL;
+    size_t count = 0;
+    size_t bytes = 0;
+    char *arena;
+
+    free(glad_ext_block);
+    glad_ext_block = NULL;
+    glad_ext_table = NULL;
+    glad_ext_capacity = 0;
+    glad_ext_count = 0;
+
+    /* First work out how much space the names need, so everything fits in one allocation */
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
+        const char *c;
         exts = (const char *)glGetString(GL_EXTENSIONS);
+        if(exts == NULL) return 1;
+        bytes = strlen(exts) + 1;
+        count = 1;
+        for(c = exts; *c; c++) {
+            count += *c == ' ';
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        unsigned int index;
-
-        num_exts_i = 0;
+        int num_exts_i = 0;
+        int index;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+        for(index = 0; index < num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+            bytes += (gl_str_tmp != NULL ? strlen(gl_str_tmp) : 0) + 1;
         }
+        count = (size_t)(num_exts_i > 0 ? num_exts_i : 0);
     }
 #endif
-    return 1;
-}
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+    /* Keep the table at most half full so probe chains stay short */
+    glad_ext_capacity = 16;
+    while(glad_ext_capacity < count * 2) {
+        glad_ext_capacity *= 2;
     }
-}
+    glad_ext_block = malloc(glad_ext_capacity * sizeof(glad_extension) + bytes);
+    if(glad_ext_block == NULL) {
+        glad_ext_capacity = 0;
+        return 0;
+    }
+    glad_ext_table = (glad_extension *)glad_ext_block;
+    memset(glad_ext_table, 0, glad_ext_capacity * sizeof(glad_extension));
+    arena = (char *)(glad_ext_table + glad_ext_capacity);
 
-static int has_ext(const char *ext) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
+        while(*exts) {
+            size_t length = strcspn(exts, " ");
+            glad_ext_insert(exts, length, &arena);
+            exts += length;
+            exts += *exts == ' ';
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        unsigned int index;
+        for(index = 0; index < (unsigned int)count; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) {
+                glad_ext_insert(gl_str_tmp, strlen(gl_str_tmp), &arena);
             }
         }
     }
 #endif
+    return 1;
+}
 
-    return 0;
+int gladHasExtension(const char *name) {
+    return name != NULL && glad_ext_find(glad_ext_hash(name, strlen(name)), name) != NULL;
+}
+
+int gladHasExtensionHash(unsigned int hash) {
+    return glad_ext_find(hash, NULL) != NULL;
+}
+
+int gladExtensionCount(void) {
+    return glad_ext_count;
+}
+
+static int has_ext(const char *ext) {
+    return gladHasExtension(ext);
 }
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
@@ -1732,7 +1792,6 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
 	(void)&has_ext;
-	free_exts();
 	return 1;
 }
 
@@ -1797,12 +1856,513 @@ static void find_coreGL(void) {
 	}
 }
 
+/* Lazy loading (build glad.c with GLAD_LAZY_LOADING defined).
+ *
+ * Instead of looking up every entry point by name when the context is made, each function pointer
+ * starts out pointing at a small trampoline with the same signature. The first call goes through
+ * the trampoline, which looks the real function up, patches the pointer and forwards the call, so
+ * every call after that goes straight to the driver. Only the functions the app actually uses are
+ * ever looked up. Setting the trampolines up only takes a perfect hash lookup per name (see
+ * glad_function_hash.h), and functions from GL versions the context doesn't have are left NULL like usual.
+ *
+ * If two threads hit the same trampoline at once they both resolve it and write the same value,
+ * which is harmless.
+ */
+#include <glad/glad_function_hash.h>
+
+static GLADloadproc glad_loader = NULL;
+static int glad_resolved = 0;
+
+static void* glad_resolve(const char *name) {
+    void* proc = glad_loader != NULL ? glad_loader(name) : NULL;
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s is not available\n", name);
+    }
+    glad_resolved++;
+    return proc;
+}
+
+#ifdef GLAD_LAZY_LOADING
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) \
+    static ret APIENTRY glad_lazy_##name params { \
+        glad_##name = (pfn)glad_resolve(#name); \
+        return glad_##name args; \
+    }
+#define GLAD_VOID_FUNCTION(ret, name, pfn, params, args, record) \
+    static void APIENTRY glad_lazy_##name params { \
+        glad_##name = (pfn)glad_resolve(#name); \
+        glad_##name args; \
+    }
+#include <glad/glad_functions.h>
+#undef GLAD_FUNCTION
+#undef GLAD_VOID_FUNCTION
+#endif
+
+#if defined(GLAD_TRACE) && defined(GLAD_LAZY_LOADING)
+#error "GLAD_TRACE and GLAD_LAZY_LOADING can't be used together"
+#endif
+
+#ifdef GLAD_TRACE
+/* Call tracing (build glad.c and the app with GLAD_TRACE defined, needs C11).
+ *
+ * After loading, every function pointer that was found is swapped for a shim with the same signature.
+ * The shim records which function it was, the arguments as raw 64 bit values and how long the driver
+ * took, then returns what the real function returned. Each thread records into its own ring buffer
+ * that only one other thread (whoever calls gladTraceFrame) reads from, so recording never takes a lock.
+ * gladTraceFrame() drains the rings once a frame, counts the calls into a histogram and appends them
+ * to the capture file, which tools/gl_replay plays back.
+ *
+ * A few calls hand the driver data through a pointer it reads straight away (buffer data, shader
+ * source, uniform arrays, 2D and 3D texture pixels). Those get a copy of the data saved with the call so the
+ * replay has something to send. Every other pointer is only recorded as its value.
+ *
+ * Return values aren't recorded, except glFenceSync's: the sync it made is saved as an extra argument
+ * after the real two, so the replay can tell which of its own syncs later calls are talking about.
+ *
+ * Without GLAD_TRACE none of this is compiled and calls go straight to the driver.
+ */
+#include <stdatomic.h>
+#include <time.h>
+
+#define GLAD_TRACE_RING_SIZE 16384
+#define GLAD_TRACE_MAX_THREADS 16
+#define GLAD_TRACE_NO_BLOB 0xFF
+
+typedef struct {
+    unsigned short function;
+    unsigned char argc;
+    unsigned char blob_arg;
+    unsigned int cpu_ns;
+    unsigned long long args[GLAD_MAX_ARGUMENTS];
+    void *blob;
+    unsigned int blob_size;
+} glad_trace_call;
+
+typedef struct {
+    glad_trace_call calls[GLAD_TRACE_RING_SIZE];
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;
+} glad_trace_ring;
+
+static _Atomic(glad_trace_ring *) glad_trace_rings[GLAD_TRACE_MAX_THREADS];
+static atomic_int glad_trace_ring_count;
+static _Thread_local glad_trace_ring *glad_trace_local = NULL;
+static _Thread_local int glad_trace_no_ring = 0;
+static _Thread_local unsigned long long glad_trace_unpack_buffer = 0;
+
+/* glad_index_glDrawArrays etc, the position of each function in glad_functions.h */
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) glad_index_##name,
+#define GLAD_VOID_FUNCTION GLAD_FUNCTION
+enum {
+#include <glad/glad_functions.h>
+    glad_index_count
+};
+#undef GLAD_FUNCTION
+#undef GLAD_VOID_FUNCTION
+
+static unsigned long long glad_trace_now(void) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (unsigned long long)(counter.QuadPart * 1000000000.0 / frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+static glad_trace_ring *glad_trace_thread_ring(void) {
+    if(glad_trace_local == NULL && !glad_trace_no_ring) {
+        int slot = atomic_fetch_add(&glad_trace_ring_count, 1);
+        glad_trace_ring *ring = slot < GLAD_TRACE_MAX_THREADS ? (glad_trace_ring *)calloc(1, sizeof(glad_trace_ring)) : NULL;
+        if(ring == NULL) {
+            fprintf(stderr, "glad: no trace ring for this thread, its calls won't be recorded\n");
+            glad_trace_no_ring = 1;
+            return NULL;
+        }
+        atomic_store(&glad_trace_rings[slot], ring);
+        glad_trace_local = ring;
+    }
+    return glad_trace_local;
+}
+
+static void glad_trace_begin(glad_trace_call *call, int function) {
+    call->function = (unsigned short)function;
+    call->argc = 0;
+    call->blob_arg = GLAD_TRACE_NO_BLOB;
+    call->blob = NULL;
+    call->blob_size = 0;
+}
+
+static void glad_trace_arg(glad_trace_call *call, const void *value, size_t size) {
+    unsigned long long slot = 0;
+    memcpy(&slot, value, size < sizeof slot ? size : sizeof slot);
+    call->args[call->argc++] = slot;
+}
+
+static void glad_trace_copy(glad_trace_call *call, unsigned char arg, size_t size) {
+    const void *data = (const void *)(size_t)call->args[arg];
+    if(data == NULL || size == 0) return;
+    call->blob = malloc(size);
+    if(call->blob == NULL) return;
+    memcpy(call->blob, data, size);
+    call->blob_size = (unsigned int)size;
+    call->blob_arg = arg;
+}
+
+/* Bytes per pixel for the formats this project uploads, 0 if we don't know */
+static size_t glad_trace_pixel_size(unsigned long long format, unsigned long long type) {
+    size_t components;
+    switch(format) {
+        case GL_RED: case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG: components = 2; break;
+        case GL_RGB: case GL_BGR: components = 3; break;
+        case GL_RGBA: case GL_BGRA: components = 4; break;
+        default: return 0;
+    }
+    switch(type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return components * 2;
+        case GL_FLOAT: case GL_UNSIGNED_INT: case GL_INT: return components * 4;
+        default: return 0;
+    }
+}
+
+/* Rows are padded to GL_UNPACK_ALIGNMENT, assumed to be left at the default of 4 */
+static void glad_trace_copy_pixels(glad_trace_call *call, unsigned char arg, unsigned long long width, unsigned long long height,
+                                   unsigned long long format, unsigned long long type) {
+    size_t row = (size_t)width * glad_trace_pixel_size(format, type);
+    /* With a pixel unpack buffer bound the pointer is an offset into it */
+    if(glad_trace_unpack_buffer != 0) return;
+    glad_trace_copy(call, arg, (row + 3) / 4 * 4 * (size_t)height);
+}
+
+/* Saves the data behind the pointers the driver reads during the call */
+static void glad_trace_capture(glad_trace_call *call) {
+    const unsigned long long *a = call->args;
+    switch(call->function) {
+        case glad_index_glBindBuffer:
+            if(a[0] == GL_PIXEL_UNPACK_BUFFER) glad_trace_unpack_buffer = a[1];
+            break;
+        case glad_index_glBufferData: glad_trace_copy(call, 2, (size_t)a[1]); break;
+        case glad_index_glBufferSubData: glad_trace_copy(call, 3, (size_t)a[2]); break;
+        case glad_index_glShaderSource: {
+            /* All the strings are joined into one, which is what gets replayed */
+            GLsizei count = (GLsizei)a[1];
+            const GLchar *const *strings = (const GLchar *const *)(size_t)a[2];
+            const GLint *lengths = (const GLint *)(size_t)a[3];
+            size_t total = 0;
+            GLsizei index;
+            char *joined;
+            for(index = 0; index < count; index++) {
+                total += lengths != NULL && lengths[index] >= 0 ? (size_t)lengths[index] : strlen(strings[index]);
+            }
+            joined = (char *)malloc(total + 1);
+            if(joined == NULL) break;
+            call->blob = joined;
+            call->blob_size = (unsigned int)(total + 1);
+            call->blob_arg = 2;
+            for(index = 0; index < count; index++) {
+                size_t length = lengths != NULL && lengths[index] >= 0 ? (size_t)lengths[index] : strlen(strings[index]);
+                memcpy(joined, strings[index], length);
+                joined += length;
+            }
+            *joined = '\0';
+            break;
+        }
+        case glad_index_glUniform1fv: case glad_index_glUniform1iv: case glad_index_glUniform1uiv:
+            glad_trace_copy(call, 2, (size_t)a[1] * 4); break;
+        case glad_index_glUniform2fv: case glad_index_glUniform2iv: case glad_index_glUniform2uiv:
+            glad_trace_copy(call, 2, (size_t)a[1] * 8); break;
+        case glad_index_glUniform3fv: case glad_index_glUniform3iv: case glad_index_glUniform3uiv:
+            glad_trace_copy(call, 2, (size_t)a[1] * 12); break;
+        case glad_index_glUniform4fv: case glad_index_glUniform4iv: case glad_index_glUniform4uiv:
+            glad_trace_copy(call, 2, (size_t)a[1] * 16); break;
+        case glad_index_glUniformMatrix3fv: glad_trace_copy(call, 3, (size_t)a[1] * 36); break;
+        case glad_index_glUniformMatrix4fv: glad_trace_copy(call, 3, (size_t)a[1] * 64); break;
+        case glad_index_glTexImage2D: glad_trace_copy_pixels(call, 8, a[3], a[4], a[6], a[7]); break;
+        case glad_index_glTexSubImage2D: glad_trace_copy_pixels(call, 8, a[4], a[5], a[6], a[7]); break;
+        /* Every layer is height more rows, straight after the last */
+        case glad_index_glTexImage3D: glad_trace_copy_pixels(call, 9, a[3], a[4] * a[5], a[7], a[8]); break;
+        case glad_index_glTexSubImage3D: glad_trace_copy_pixels(call, 10, a[5], a[6] * a[7], a[8], a[9]); break;
+        default: break;
+    }
+}
+
+static void glad_trace_end(glad_trace_call *call, unsigned long long start) {
+    unsigned long long elapsed = glad_trace_now() - start;
+    glad_trace_ring *ring = glad_trace_thread_ring();
+    unsigned int head, tail;
+    call->cpu_ns = elapsed > 0xFFFFFFFFull ? 0xFFFFFFFFu : (unsigned int)elapsed;
+    if(ring == NULL) return;
+
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if(head - tail >= GLAD_TRACE_RING_SIZE) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    glad_trace_capture(call);
+    ring->calls[head & (GLAD_TRACE_RING_SIZE - 1)] = *call;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+/* The locals are prefixed so they can't clash with parameter names like "start" */
+#define GLAD_TRACE_ARG(arg) glad_trace_arg(&glad_call, &(arg), sizeof(arg));
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) \
+    static pfn glad_real_##name = NULL; \
+    static ret APIENTRY glad_trace_##name params { \
+        glad_trace_call glad_call; \
+        unsigned long long glad_start; \
+        ret glad_result; \
+        glad_trace_begin(&glad_call, glad_index_##name); \
+        record \
+        glad_start = glad_trace_now(); \
+        glad_result = glad_real_##name args; \
+        if(glad_index_##name == glad_index_glFenceSync) GLAD_TRACE_ARG(glad_result) \
+        glad_trace_end(&glad_call, glad_start); \
+        return glad_result; \
+    }
+#define GLAD_VOID_FUNCTION(ret, name, pfn, params, args, record) \
+    static pfn glad_real_##name = NULL; \
+    static void APIENTRY glad_trace_##name params { \
+        glad_trace_call glad_call; \
+        unsigned long long glad_start; \
+        glad_trace_begin(&glad_call, glad_index_##name); \
+        record \
+        glad_start = glad_trace_now(); \
+        glad_real_##name args; \
+        glad_trace_end(&glad_call, glad_start); \
+    }
+#include <glad/glad_functions.h>
+#undef GLAD_FUNCTION
+#undef GLAD_VOID_FUNCTION
+#undef GLAD_TRACE_ARG
+#endif
+
+/* Every function pointer by name, indexed through the perfect hash in glad_function_hash.h */
+typedef struct {
+    const char *name;
+    void **pointer;
+    void *trampoline;
+#ifdef GLAD_TRACE
+    void **real;
+    void *shim;
+#endif
+} glad_function;
+
+#if defined(GLAD_LAZY_LOADING)
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) { #name, (void**)&glad_##name, (void*)glad_lazy_##name },
+#elif defined(GLAD_TRACE)
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) { #name, (void**)&glad_##name, NULL, (void**)&glad_real_##name, (void*)glad_trace_##name },
+#else
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) { #name, (void**)&glad_##name, NULL },
+#endif
+#define GLAD_VOID_FUNCTION GLAD_FUNCTION
+static const glad_function glad_functions[GLAD_FUNCTION_COUNT] = {
+#include <glad/glad_functions.h>
+};
+#undef GLAD_FUNCTION
+#undef GLAD_VOID_FUNCTION
+
+static unsigned int glad_hash(const char *name, unsigned int seed) {
+    unsigned int hash = 2166136261u ^ seed;
+    for(; *name; name++) {
+        hash = (hash ^ (unsigned char)*name) * 16777619u;
+    }
+    return hash;
+}
+
+static int glad_function_index(const char *name) {
+    unsigned int seed = GLAD_HASH_DISPLACEMENTS[glad_hash(name, 0) % GLAD_HASH_BUCKETS];
+    unsigned short index = GLAD_HASH_SLOTS[glad_hash(name, seed) & (GLAD_HASH_SIZE - 1)];
+    if(index == 0xFFFF || strcmp(glad_functions[index].name, name) != 0) return -1;
+    return index;
+}
+
+int gladLoadGLFunction(const char *name) {
+    int index = glad_function_index(name);
+    if(index < 0 || glad_loader == NULL) return 0;
+    if(*glad_functions[index].pointer == NULL || *glad_functions[index].pointer == glad_functions[index].trampoline) {
+#ifdef GLAD_TRACE
+        *glad_functions[index].real = glad_resolve(name);
+        *glad_functions[index].pointer = *glad_functions[index].real != NULL ? glad_functions[index].shim : NULL;
+#else
+        *glad_functions[index].pointer = glad_resolve(name);
+#endif
+    }
+    return *glad_functions[index].pointer != NULL;
+}
+
+int gladIsLazy(void) {
+#ifdef GLAD_LAZY_LOADING
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+int gladResolvedCount(void) {
+    return glad_resolved;
+}
+
+int gladFunctionCount(void) {
+    return GLAD_FUNCTION_COUNT;
+}
+
+#ifdef GLAD_LAZY_LOADING
+/* Hands out the trampolines instead of the real functions, so the version checks in load_GL_VERSION_x
+   still decide which pointers get set and the rest stay NULL */
+static void* glad_trampoline_loader(const char *name) {
+    int index = glad_function_index(name);
+    return index < 0 ? NULL : glad_functions[index].trampoline;
+}
+#else
+/* Wraps the loader so eager loading gets counted the same way as lazy loading */
+static void* glad_counting_loader(const char *name) {
+    glad_resolved++;
+    return glad_loader(name);
+}
+#endif
+
+#ifdef GLAD_TRACE
+static FILE *glad_trace_file = NULL;
+static unsigned int glad_trace_counts[GLAD_FUNCTION_COUNT];
+static unsigned long long glad_trace_ns[GLAD_FUNCTION_COUNT];
+static unsigned int glad_trace_frame = 0;
+static unsigned int glad_trace_frame_calls = 0;
+static unsigned int glad_trace_frame_dropped = 0;
+
+/* Points everything that was loaded at its shim */
+static void glad_trace_install(void) {
+    int index;
+    for(index = 0; index < GLAD_FUNCTION_COUNT; index++) {
+        if(*glad_functions[index].pointer != NULL && *glad_functions[index].pointer != glad_functions[index].shim) {
+            *glad_functions[index].real = *glad_functions[index].pointer;
+            *glad_functions[index].pointer = glad_functions[index].shim;
+        }
+    }
+}
+
+/* Capture file layout, everything in the machine's own byte order:
+ *   "GLTRACE1", u32 function count, then for each function a u16 length and its name
+ *   then for each call:  'C', u16 function, u8 argument count, u32 cpu ns, u64 per argument,
+ *                        u8 argument the data replaces (0xFF for none), u32 data size, the data
+ *   and at the end of each frame: 'F'
+ */
+static void glad_trace_write(const void *data, size_t size) {
+    if(glad_trace_file != NULL && fwrite(data, 1, size, glad_trace_file) != size) {
+        fprintf(stderr, "glad: couldn't write to the trace capture, stopping it\n");
+        fclose(glad_trace_file);
+        glad_trace_file = NULL;
+    }
+}
+
+int gladTraceBegin(const char *capturePath) {
+    unsigned int count = GLAD_FUNCTION_COUNT;
+    int index;
+    if(capturePath == NULL) return 1;
+    glad_trace_file = fopen(capturePath, "wb");
+    if(glad_trace_file == NULL) {
+        fprintf(stderr, "glad: couldn't open %s for the trace capture\n", capturePath);
+        return 0;
+    }
+    glad_trace_write("GLTRACE1", 8);
+    glad_trace_write(&count, sizeof count);
+    for(index = 0; index < GLAD_FUNCTION_COUNT; index++) {
+        unsigned short length = (unsigned short)strlen(glad_functions[index].name);
+        glad_trace_write(&length, sizeof length);
+        glad_trace_write(glad_functions[index].name, length);
+    }
+    return 1;
+}
+
+void gladTraceFrame(void) {
+    int count = atomic_load(&glad_trace_ring_count);
+    int slot;
+    memset(glad_trace_counts, 0, sizeof glad_trace_counts);
+    memset(glad_trace_ns, 0, sizeof glad_trace_ns);
+    glad_trace_frame_calls = 0;
+    glad_trace_frame_dropped = 0;
+
+    for(slot = 0; slot < count && slot < GLAD_TRACE_MAX_THREADS; slot++) {
+        glad_trace_ring *ring = atomic_load(&glad_trace_rings[slot]);
+        unsigned int head, tail;
+        if(ring == NULL) continue;
+        head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        for(; tail != head; tail++) {
+            glad_trace_call *call = &ring->calls[tail & (GLAD_TRACE_RING_SIZE - 1)];
+            glad_trace_counts[call->function]++;
+            glad_trace_ns[call->function] += call->cpu_ns;
+            glad_trace_frame_calls++;
+            if(glad_trace_file != NULL) {
+                glad_trace_write("C", 1);
+                glad_trace_write(&call->function, sizeof call->function);
+                glad_trace_write(&call->argc, sizeof call->argc);
+                glad_trace_write(&call->cpu_ns, sizeof call->cpu_ns);
+                glad_trace_write(call->args, call->argc * sizeof call->args[0]);
+                glad_trace_write(&call->blob_arg, sizeof call->blob_arg);
+                glad_trace_write(&call->blob_size, sizeof call->blob_size);
+                glad_trace_write(call->blob, call->blob_size);
+            }
+            free(call->blob);
+            call->blob = NULL;
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+        glad_trace_frame_dropped += atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+    }
+    glad_trace_write("F", 1);
+    glad_trace_frame++;
+}
+
+void gladTracePrintFrame(int top) {
+    unsigned long long total_ns = 0;
+    int printed[GLAD_FUNCTION_COUNT] = {0};
+    int index, row;
+    for(index = 0; index < GLAD_FUNCTION_COUNT; index++) {
+        total_ns += glad_trace_ns[index];
+    }
+    printf("GL calls in frame %u: %u (%u dropped), %.3fms in the driver\n", glad_trace_frame, glad_trace_frame_calls,
+           glad_trace_frame_dropped, total_ns / 1000000.0);
+    /* Most called first. It's only a few hundred functions, so picking the top ones out by hand is fine. */
+    for(row = 0; row < top; row++) {
+        int best = -1;
+        for(index = 0; index < GLAD_FUNCTION_COUNT; index++) {
+            if(!printed[index] && glad_trace_counts[index] > 0 && (best < 0 || glad_trace_counts[index] > glad_trace_counts[best])) {
+                best = index;
+            }
+        }
+        if(best < 0) break;
+        printed[best] = 1;
+        printf("  %-32s %6u calls %9.3fms\n", glad_functions[best].name, glad_trace_counts[best], glad_trace_ns[best] / 1000000.0);
+    }
+}
+
+void gladTraceEnd(void) {
+    if(glad_trace_file != NULL) {
+        fclose(glad_trace_file);
+        glad_trace_file = NULL;
+    }
+}
+#endif
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_loader = load;
+	glad_resolved = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
+#ifdef GLAD_LAZY_LOADING
+	load = glad_trampoline_loader;
+#else
+	load = glad_counting_loader;
+#endif
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
 	load_GL_VERSION_1_2(load);
@@ -1824,6 +2384,9 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_6(load);
 
 	if (!find_extensionsGL()) return 0;
+#ifdef GLAD_TRACE
+	glad_trace_install();
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -0,0 +1,42 @@
+/* Additions to the generated glad loader, see the bottom of glad.c */
+#ifndef GLAD_EXTRAS_H
+#define GLAD_EXTRAS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Looks a function up right now instead of on first call (e.g. to warm up the ones a frame needs
+   during a loading screen). Works in both modes. Returns 0 if it doesn't exist. */
+int gladLoadGLFunction(const char *name);
+
+/* 1 if glad.c was built with GLAD_LAZY_LOADING */
+int gladIsLazy(void);
+
+/* How many entry points have been looked up so far, out of how many glad knows about */
+int gladResolvedCount(void);
+int gladFunctionCount(void);
+
+/* Is an extension supported by the current context? The registry is built by gladLoadGLLoader.
+   gladHasExtensionHash takes the FNV-1a hash of the name (see "GL_x"_extension in src/gl_features.h)
+   and only compares hashes, so it doesn't have to touch the string at all. */
+int gladHasExtension(const char *name);
+int gladHasExtensionHash(unsigned int hash);
+int gladExtensionCount(void);
+
+#ifdef GLAD_TRACE
+/* Call tracing, only there when glad.c is built with GLAD_TRACE.
+   gladTraceBegin starts writing every call to a capture file for tools/gl_replay (pass NULL to only
+   keep the per-frame counts). Call gladTraceFrame once a frame after swapping buffers, it collects
+   the calls every thread made since the last one. gladTracePrintFrame prints the most called functions. */
+int gladTraceBegin(const char *capturePath);
+void gladTraceFrame(void);
+void gladTracePrintFrame(int top);
+void gladTraceEnd(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/* Generated by tools/gen_glad_functions.py, don't edit by hand.
+
+   Perfect hash from a function name to its index in glad_functions.h:
+     seed  = GLAD_HASH_DISPLACEMENTS[fnv1a(name, 0) % GLAD_HASH_BUCKETS]
+     index = GLAD_HASH_SLOTS[fnv1a(name, seed) & (GLAD_HASH_SIZE - 1)]
+   then compare the name, since names that aren't in the list land somewhere too. */
+#define GLAD_FUNCTION_COUNT 699
+#define GLAD_MAX_ARGUMENTS 15
+#define GLAD_HASH_BUCKETS 174
+#define GLAD_HASH_SIZE 1024
+
+static const unsigned short GLAD_HASH_DISPLACEMENTS[GLAD_HASH_BUCKETS] = {
+    5, 13, 1, 1, 4, 2, 4, 2, 6, 1, 13, 2, 5, 3, 1, 2,
+    1, 4, 4, 4, 8, 1, 3, 1, 12, 3, 8, 1, 2, 1, 2, 6,
+    12, 5, 2, 13, 1, 5, 22, 4, 1, 0, 8, 1, 3, 5, 5, 18,
+    4, 18, 1, 2, 16, 2, 1, 4, 25, 4, 7, 44, 5, 18, 1, 6,
+    2, 1, 5, 4, 2, 5, 2, 23, 1, 16, 21, 14, 6, 2, 15, 2,
+    25, 3, 1, 12, 23, 15, 2, 24, 2, 5, 6, 33, 1, 8, 1, 1,
+    9, 11, 5, 14, 1, 2, 6, 11, 6, 5, 20, 1, 4, 12, 2, 1,
+    3, 1, 2, 14, 3, 5, 34, 1, 5, 15, 16, 2, 1, 14, 12, 1,
+    31, 13, 1, 22, 1, 6, 3, 5, 1, 4, 7, 13, 28, 1, 3, 1,
+    7, 17, 26, 1, 12, 7, 9, 36, 49, 7, 4, 5, 2, 1, 15, 7,
+    6, 6, 3, 1, 48, 5, 6, 2, 2, 2, 18, 0, 7, 8
+};
+
+static const unsigned short GLAD_HASH_SLOTS[GLAD_HASH_SIZE] = {
+    167, 319, 401, 65535, 65535, 276, 470, 185, 65535, 206, 655, 328, 444, 361, 279, 174,
+    583, 567, 218, 170, 654, 65535, 465, 433, 201, 65535, 65535, 685, 400, 363, 58, 65535,
+    213, 16, 460, 418, 697, 65535, 65535, 65535, 525, 60, 65535, 65535, 405, 65535, 529, 316,
+    0, 65535, 617, 65535, 65535, 193, 65535, 65535, 698, 65535, 560, 65535, 440, 377, 65535, 489,
+    592, 209, 379, 46, 408, 597, 289, 303, 65535, 524, 83, 65535, 254, 65535, 190, 113,
+    485, 371, 100, 65535, 566, 694, 187, 318, 65535, 65535, 484, 65535, 326, 457, 594, 65535,
+    131, 350, 65535, 447, 553, 65535, 302, 478, 558, 65535, 445, 205, 65535, 275, 65535, 65535,
+    65535, 367, 278, 450, 391, 173, 65535, 605, 458, 65535, 288, 604, 263, 636, 516, 660,
+    647, 681, 101, 65535, 65535, 156, 203, 404, 65535, 574, 65535, 38, 554, 65535, 178, 442,
+    65535, 670, 357, 256, 493, 10, 65535, 384, 435, 65535, 94, 18, 65535, 65535, 388, 65535,
+    593, 65535, 64, 588, 161, 522, 390, 65535, 86, 461, 265, 640, 65535, 181, 691, 294,
+    96, 188, 325, 76, 285, 315, 659, 145, 65535, 65535, 586, 65535, 664, 65535, 82, 65535,
+    124, 65535, 580, 65535, 65535, 65535, 207, 372, 65535, 500, 65535, 13, 477, 585, 228, 549,
+    689, 272, 324, 252, 339, 475, 231, 132, 229, 157, 65535, 65535, 519, 65535, 427, 65535,
+    65535, 495, 480, 243, 91, 657, 65535, 93, 587, 123, 222, 65535, 2, 221, 52, 65535,
+    692, 270, 65535, 163, 650, 686, 235, 111, 65535, 55, 65535, 65535, 307, 542, 403, 65535,
+    601, 88, 138, 623, 112, 65535, 103, 65535, 65535, 29, 366, 510, 65535, 65535, 65535, 22,
+    638, 653, 690, 227, 534, 65535, 89, 65535, 226, 688, 452, 356, 308, 65535, 151, 415,
+    220, 53, 140, 603, 565, 5, 345, 454, 65535, 24, 695, 332, 74, 277, 693, 646,
+    65535, 65535, 65535, 514, 49, 490, 153, 652, 223, 430, 309, 464, 65535, 39, 65535, 172,
+    65535, 65535, 335, 65535, 109, 68, 65535, 260, 563, 268, 1, 11, 556, 65535, 536, 65535,
+    192, 65535, 502, 6, 65535, 65535, 486, 199, 687, 541, 65535, 65535, 90, 680, 249, 678,
+    184, 633, 65535, 211, 679, 65535, 65535, 639, 62, 65535, 65535, 508, 65535, 65535, 65535, 215,
+    65535, 65535, 65535, 65535, 463, 531, 614, 382, 338, 610, 282, 396, 65535, 370, 65535, 137,
+    65535, 483, 476, 613, 54, 641, 65535, 110, 683, 125, 65535, 7, 139, 351, 622, 340,
+    538, 65535, 426, 65535, 65535, 73, 65535, 155, 186, 65535, 537, 365, 555, 520, 65535, 65535,
+    65535, 65535, 65535, 33, 383, 482, 65535, 420, 359, 467, 146, 251, 65535, 166, 317, 65535,
+    65535, 291, 21, 642, 615, 394, 459, 65535, 65535, 85, 63, 130, 30, 466, 65535, 327,
+    95, 304, 528, 258, 600, 492, 506, 119, 298, 154, 667, 230, 65535, 575, 65535, 380,
+    65535, 676, 320, 9, 65535, 195, 65535, 375, 65535, 50, 65535, 584, 65535, 392, 406, 115,
+    65535, 65535, 66, 122, 65535, 197, 65535, 135, 98, 65535, 65535, 607, 257, 627, 569, 152,
+    487, 65535, 219, 141, 65535, 70, 200, 35, 635, 421, 381, 65535, 631, 488, 44, 65535,
+    311, 321, 579, 65535, 300, 523, 65535, 671, 65535, 434, 65535, 99, 471, 65535, 429, 499,
+    590, 65535, 606, 65535, 65535, 65535, 28, 65535, 287, 65535, 65535, 65535, 114, 65535, 65535, 428,
+    65535, 65535, 515, 501, 626, 71, 56, 620, 150, 45, 65535, 672, 217, 65535, 354, 232,
+    269, 65535, 441, 573, 599, 479, 407, 498, 521, 233, 65535, 246, 65535, 423, 399, 65535,
+    65535, 65535, 65535, 162, 65535, 65535, 645, 148, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 26,
+    674, 337, 504, 629, 65535, 65535, 481, 416, 386, 104, 65535, 65535, 474, 509, 387, 283,
+    65535, 348, 330, 290, 612, 65535, 176, 310, 165, 65535, 455, 32, 598, 65535, 296, 662,
+    168, 602, 194, 23, 568, 191, 552, 65535, 12, 65535, 341, 65535, 264, 281, 65535, 65535,
+    675, 578, 214, 376, 121, 143, 65535, 247, 65535, 75, 65535, 65535, 65535, 331, 557, 581,
+    65535, 297, 92, 65535, 4, 527, 517, 666, 632, 453, 65535, 616, 322, 611, 128, 299,
+    648, 550, 497, 362, 79, 212, 65535, 410, 65535, 682, 208, 65535, 65535, 245, 65535, 65535,
+    65535, 180, 360, 65535, 496, 20, 572, 65535, 142, 65535, 673, 551, 65535, 65535, 65535, 84,
+    129, 234, 374, 353, 65535, 462, 43, 27, 179, 267, 378, 65535, 202, 116, 65535, 159,
+    432, 449, 668, 19, 65535, 65535, 105, 169, 65535, 65535, 651, 425, 81, 65535, 241, 494,
+    305, 548, 582, 65535, 65535, 352, 619, 533, 65535, 546, 65535, 255, 65535, 117, 250, 530,
+    625, 65535, 65535, 301, 696, 102, 225, 65535, 413, 65535, 65535, 65535, 134, 253, 182, 65535,
+    65535, 262, 65535, 65535, 65535, 61, 65535, 65535, 411, 576, 47, 40, 618, 242, 65535, 65535,
+    409, 65535, 65535, 473, 204, 65535, 656, 41, 513, 313, 608, 312, 65535, 369, 414, 65535,
+    65535, 144, 65535, 438, 292, 280, 472, 65535, 65535, 183, 589, 65535, 355, 65535, 120, 665,
+    42, 65535, 661, 417, 65535, 559, 266, 402, 333, 624, 543, 503, 65535, 571, 609, 562,
+    65535, 469, 65, 637, 65535, 224, 136, 244, 393, 448, 65535, 628, 51, 175, 65535, 677,
+    65535, 65535, 65535, 343, 239, 65535, 306, 216, 684, 69, 595, 505, 14, 539, 65535, 65535,
+    412, 25, 395, 80, 65535, 545, 108, 346, 37, 106, 630, 540, 65535, 422, 17, 347,
+    65535, 78, 561, 36, 323, 65535, 547, 65535, 65535, 271, 65535, 133, 577, 65535, 344, 643,
+    295, 65535, 284, 314, 65535, 65535, 59, 248, 397, 649, 544, 15, 158, 65535, 451, 368,
+    65535, 663, 621, 358, 65535, 65535, 87, 398, 511, 118, 65535, 329, 240, 644, 65535, 189,
+    456, 570, 8, 31, 65535, 65535, 164, 65535, 238, 373, 65535, 274, 65535, 65535, 65535, 512,
+    65535, 273, 65535, 293, 468, 65535, 658, 65535, 65535, 334, 107, 65535, 97, 210, 591, 261,
+    127, 286, 342, 198, 65535, 65535, 126, 160, 65535, 437, 364, 491, 65535, 65535, 439, 171,
+    564, 436, 65535, 65535, 57, 34, 65535, 535, 65535, 237, 507, 3, 65535, 196, 65535, 431,
+    236, 634, 446, 259, 48, 147, 65535, 65535, 177, 65535, 72, 149, 65535, 389, 532, 669,
+    518, 67, 443, 65535, 336, 65535, 419, 349, 65535, 596, 526, 385, 65535, 77, 424, 65535
+};
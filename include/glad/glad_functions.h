@@ -0,0 +1,706 @@
+/* Generated by tools/gen_glad_functions.py, don't edit by hand.
+
+   Every entry point glad.c knows about, in the same order. Define these before including:
+     GLAD_FUNCTION(return type, name, pointer type, (parameters), (arguments), record)
+     GLAD_VOID_FUNCTION(return type, name, pointer type, (parameters), (arguments), record)
+   where record is GLAD_TRACE_ARG(argument) for each argument, with no commas in between.
+   There's no include guard on purpose, it's meant to be included more than once. */
+GLAD_VOID_FUNCTION(void, glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC, (GLuint pipeline, GLuint program), (pipeline, program), GLAD_TRACE_ARG(pipeline) GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture), GLAD_TRACE_ARG(texture))
+GLAD_VOID_FUNCTION(void, glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shader))
+GLAD_VOID_FUNCTION(void, glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(id))
+GLAD_VOID_FUNCTION(void, glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC, (GLenum target, GLuint index, GLuint id), (target, index, id), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(id))
+GLAD_VOID_FUNCTION(void, glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode), GLAD_TRACE_ARG(primitiveMode))
+GLAD_VOID_FUNCTION(void, glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(buffers))
+GLAD_VOID_FUNCTION(void, glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(buffers) GLAD_TRACE_ARG(offsets) GLAD_TRACE_ARG(sizes))
+GLAD_VOID_FUNCTION(void, glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(color) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(colorNumber) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(framebuffer))
+GLAD_VOID_FUNCTION(void, glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format), GLAD_TRACE_ARG(unit) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(layered) GLAD_TRACE_ARG(layer) GLAD_TRACE_ARG(access) GLAD_TRACE_ARG(format))
+GLAD_VOID_FUNCTION(void, glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(textures))
+GLAD_VOID_FUNCTION(void, glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), GLAD_TRACE_ARG(pipeline))
+GLAD_VOID_FUNCTION(void, glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(renderbuffer))
+GLAD_VOID_FUNCTION(void, glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler), GLAD_TRACE_ARG(unit) GLAD_TRACE_ARG(sampler))
+GLAD_VOID_FUNCTION(void, glBindSamplers, PFNGLBINDSAMPLERSPROC, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(samplers))
+GLAD_VOID_FUNCTION(void, glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(texture))
+GLAD_VOID_FUNCTION(void, glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC, (GLuint unit, GLuint texture), (unit, texture), GLAD_TRACE_ARG(unit) GLAD_TRACE_ARG(texture))
+GLAD_VOID_FUNCTION(void, glBindTextures, PFNGLBINDTEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(textures))
+GLAD_VOID_FUNCTION(void, glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(id))
+GLAD_VOID_FUNCTION(void, glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array), GLAD_TRACE_ARG(array))
+GLAD_VOID_FUNCTION(void, glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride), GLAD_TRACE_ARG(bindingindex) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(buffers) GLAD_TRACE_ARG(offsets) GLAD_TRACE_ARG(strides))
+GLAD_VOID_FUNCTION(void, glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_TRACE_ARG(red) GLAD_TRACE_ARG(green) GLAD_TRACE_ARG(blue) GLAD_TRACE_ARG(alpha))
+GLAD_VOID_FUNCTION(void, glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode), GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), GLAD_TRACE_ARG(modeRGB) GLAD_TRACE_ARG(modeAlpha))
+GLAD_VOID_FUNCTION(void, glBlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha), GLAD_TRACE_ARG(buf) GLAD_TRACE_ARG(modeRGB) GLAD_TRACE_ARG(modeAlpha))
+GLAD_VOID_FUNCTION(void, glBlendEquationi, PFNGLBLENDEQUATIONIPROC, (GLuint buf, GLenum mode), (buf, mode), GLAD_TRACE_ARG(buf) GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), GLAD_TRACE_ARG(sfactor) GLAD_TRACE_ARG(dfactor))
+GLAD_VOID_FUNCTION(void, glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), GLAD_TRACE_ARG(sfactorRGB) GLAD_TRACE_ARG(dfactorRGB) GLAD_TRACE_ARG(sfactorAlpha) GLAD_TRACE_ARG(dfactorAlpha))
+GLAD_VOID_FUNCTION(void, glBlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha), GLAD_TRACE_ARG(buf) GLAD_TRACE_ARG(srcRGB) GLAD_TRACE_ARG(dstRGB) GLAD_TRACE_ARG(srcAlpha) GLAD_TRACE_ARG(dstAlpha))
+GLAD_VOID_FUNCTION(void, glBlendFunci, PFNGLBLENDFUNCIPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst), GLAD_TRACE_ARG(buf) GLAD_TRACE_ARG(src) GLAD_TRACE_ARG(dst))
+GLAD_VOID_FUNCTION(void, glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLAD_TRACE_ARG(srcX0) GLAD_TRACE_ARG(srcY0) GLAD_TRACE_ARG(srcX1) GLAD_TRACE_ARG(srcY1) GLAD_TRACE_ARG(dstX0) GLAD_TRACE_ARG(dstY0) GLAD_TRACE_ARG(dstX1) GLAD_TRACE_ARG(dstY1) GLAD_TRACE_ARG(mask) GLAD_TRACE_ARG(filter))
+GLAD_VOID_FUNCTION(void, glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLAD_TRACE_ARG(readFramebuffer) GLAD_TRACE_ARG(drawFramebuffer) GLAD_TRACE_ARG(srcX0) GLAD_TRACE_ARG(srcY0) GLAD_TRACE_ARG(srcX1) GLAD_TRACE_ARG(srcY1) GLAD_TRACE_ARG(dstX0) GLAD_TRACE_ARG(dstY0) GLAD_TRACE_ARG(dstX1) GLAD_TRACE_ARG(dstY1) GLAD_TRACE_ARG(mask) GLAD_TRACE_ARG(filter))
+GLAD_VOID_FUNCTION(void, glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data) GLAD_TRACE_ARG(usage))
+GLAD_VOID_FUNCTION(void, glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data) GLAD_TRACE_ARG(flags))
+GLAD_VOID_FUNCTION(void, glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data))
+GLAD_FUNCTION(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target), GLAD_TRACE_ARG(target))
+GLAD_FUNCTION(GLenum, glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, (GLuint framebuffer, GLenum target), (framebuffer, target), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(target))
+GLAD_VOID_FUNCTION(void, glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(clamp))
+GLAD_VOID_FUNCTION(void, glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask), GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glClearBufferData, PFNGLCLEARBUFFERDATAPROC, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(stencil))
+GLAD_VOID_FUNCTION(void, glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_TRACE_ARG(red) GLAD_TRACE_ARG(green) GLAD_TRACE_ARG(blue) GLAD_TRACE_ARG(alpha))
+GLAD_VOID_FUNCTION(void, glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth), GLAD_TRACE_ARG(depth))
+GLAD_VOID_FUNCTION(void, glClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d), GLAD_TRACE_ARG(d))
+GLAD_VOID_FUNCTION(void, glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(stencil))
+GLAD_VOID_FUNCTION(void, glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(drawbuffer) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s), GLAD_TRACE_ARG(s))
+GLAD_VOID_FUNCTION(void, glClearTexImage, PFNGLCLEARTEXIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(data))
+GLAD_FUNCTION(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLAD_TRACE_ARG(sync) GLAD_TRACE_ARG(flags) GLAD_TRACE_ARG(timeout))
+GLAD_VOID_FUNCTION(void, glClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth), GLAD_TRACE_ARG(origin) GLAD_TRACE_ARG(depth))
+GLAD_VOID_FUNCTION(void, glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), GLAD_TRACE_ARG(red) GLAD_TRACE_ARG(green) GLAD_TRACE_ARG(blue) GLAD_TRACE_ARG(alpha))
+GLAD_VOID_FUNCTION(void, glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(r) GLAD_TRACE_ARG(g) GLAD_TRACE_ARG(b) GLAD_TRACE_ARG(a))
+GLAD_VOID_FUNCTION(void, glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader), GLAD_TRACE_ARG(shader))
+GLAD_VOID_FUNCTION(void, glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(imageSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), GLAD_TRACE_ARG(readTarget) GLAD_TRACE_ARG(writeTarget) GLAD_TRACE_ARG(readOffset) GLAD_TRACE_ARG(writeOffset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth), GLAD_TRACE_ARG(srcName) GLAD_TRACE_ARG(srcTarget) GLAD_TRACE_ARG(srcLevel) GLAD_TRACE_ARG(srcX) GLAD_TRACE_ARG(srcY) GLAD_TRACE_ARG(srcZ) GLAD_TRACE_ARG(dstName) GLAD_TRACE_ARG(dstTarget) GLAD_TRACE_ARG(dstLevel) GLAD_TRACE_ARG(dstX) GLAD_TRACE_ARG(dstY) GLAD_TRACE_ARG(dstZ) GLAD_TRACE_ARG(srcWidth) GLAD_TRACE_ARG(srcHeight) GLAD_TRACE_ARG(srcDepth))
+GLAD_VOID_FUNCTION(void, glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size), GLAD_TRACE_ARG(readBuffer) GLAD_TRACE_ARG(writeBuffer) GLAD_TRACE_ARG(readOffset) GLAD_TRACE_ARG(writeOffset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(border))
+GLAD_VOID_FUNCTION(void, glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(border))
+GLAD_VOID_FUNCTION(void, glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width))
+GLAD_VOID_FUNCTION(void, glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width))
+GLAD_VOID_FUNCTION(void, glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glCreateBuffers, PFNGLCREATEBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(buffers))
+GLAD_VOID_FUNCTION(void, glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(framebuffers))
+GLAD_FUNCTION(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(pipelines))
+GLAD_VOID_FUNCTION(void, glCreateQueries, PFNGLCREATEQUERIESPROC, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(renderbuffers))
+GLAD_VOID_FUNCTION(void, glCreateSamplers, PFNGLCREATESAMPLERSPROC, (GLsizei n, GLuint *samplers), (n, samplers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(samplers))
+GLAD_FUNCTION(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type), GLAD_TRACE_ARG(type))
+GLAD_FUNCTION(GLuint, glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(strings))
+GLAD_VOID_FUNCTION(void, glCreateTextures, PFNGLCREATETEXTURESPROC, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(textures))
+GLAD_VOID_FUNCTION(void, glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(arrays))
+GLAD_VOID_FUNCTION(void, glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode), GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC, (GLDEBUGPROC callback, const void *userParam), (callback, userParam), GLAD_TRACE_ARG(callback) GLAD_TRACE_ARG(userParam))
+GLAD_VOID_FUNCTION(void, glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), GLAD_TRACE_ARG(source) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(severity) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(ids) GLAD_TRACE_ARG(enabled))
+GLAD_VOID_FUNCTION(void, glDebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), GLAD_TRACE_ARG(source) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(severity) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(buf))
+GLAD_VOID_FUNCTION(void, glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(buffers))
+GLAD_VOID_FUNCTION(void, glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(framebuffers))
+GLAD_VOID_FUNCTION(void, glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program), GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(pipelines))
+GLAD_VOID_FUNCTION(void, glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(renderbuffers))
+GLAD_VOID_FUNCTION(void, glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers), GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(samplers))
+GLAD_VOID_FUNCTION(void, glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader), GLAD_TRACE_ARG(shader))
+GLAD_VOID_FUNCTION(void, glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync), GLAD_TRACE_ARG(sync))
+GLAD_VOID_FUNCTION(void, glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(textures))
+GLAD_VOID_FUNCTION(void, glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(arrays))
+GLAD_VOID_FUNCTION(void, glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func), GLAD_TRACE_ARG(func))
+GLAD_VOID_FUNCTION(void, glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag), GLAD_TRACE_ARG(flag))
+GLAD_VOID_FUNCTION(void, glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(f))
+GLAD_VOID_FUNCTION(void, glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(f))
+GLAD_VOID_FUNCTION(void, glDepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(f))
+GLAD_VOID_FUNCTION(void, glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shader))
+GLAD_VOID_FUNCTION(void, glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap), GLAD_TRACE_ARG(cap))
+GLAD_VOID_FUNCTION(void, glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z), GLAD_TRACE_ARG(num_groups_x) GLAD_TRACE_ARG(num_groups_y) GLAD_TRACE_ARG(num_groups_z))
+GLAD_VOID_FUNCTION(void, glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC, (GLintptr indirect), (indirect), GLAD_TRACE_ARG(indirect))
+GLAD_VOID_FUNCTION(void, glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count))
+GLAD_VOID_FUNCTION(void, glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect), (mode, indirect), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(indirect))
+GLAD_VOID_FUNCTION(void, glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(instancecount))
+GLAD_VOID_FUNCTION(void, glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(instancecount) GLAD_TRACE_ARG(baseinstance))
+GLAD_VOID_FUNCTION(void, glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf), GLAD_TRACE_ARG(buf))
+GLAD_VOID_FUNCTION(void, glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(bufs))
+GLAD_VOID_FUNCTION(void, glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices))
+GLAD_VOID_FUNCTION(void, glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(basevertex))
+GLAD_VOID_FUNCTION(void, glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indirect))
+GLAD_VOID_FUNCTION(void, glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(instancecount))
+GLAD_VOID_FUNCTION(void, glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(instancecount) GLAD_TRACE_ARG(baseinstance))
+GLAD_VOID_FUNCTION(void, glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(instancecount) GLAD_TRACE_ARG(basevertex))
+GLAD_VOID_FUNCTION(void, glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(instancecount) GLAD_TRACE_ARG(basevertex) GLAD_TRACE_ARG(baseinstance))
+GLAD_VOID_FUNCTION(void, glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(start) GLAD_TRACE_ARG(end) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices))
+GLAD_VOID_FUNCTION(void, glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(start) GLAD_TRACE_ARG(end) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(basevertex))
+GLAD_VOID_FUNCTION(void, glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC, (GLenum mode, GLuint id), (mode, id), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(id))
+GLAD_VOID_FUNCTION(void, glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(instancecount))
+GLAD_VOID_FUNCTION(void, glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(stream))
+GLAD_VOID_FUNCTION(void, glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(stream) GLAD_TRACE_ARG(instancecount))
+GLAD_VOID_FUNCTION(void, glEnable, PFNGLENABLEPROC, (GLenum cap), (cap), GLAD_TRACE_ARG(cap))
+GLAD_VOID_FUNCTION(void, glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target), GLAD_TRACE_ARG(target))
+GLAD_VOID_FUNCTION(void, glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC, (GLenum target, GLuint index), (target, index), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), (), )
+GLAD_FUNCTION(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags), GLAD_TRACE_ARG(condition) GLAD_TRACE_ARG(flags))
+GLAD_VOID_FUNCTION(void, glFinish, PFNGLFINISHPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glFlush, PFNGLFLUSHPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(renderbuffertarget) GLAD_TRACE_ARG(renderbuffer))
+GLAD_VOID_FUNCTION(void, glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level))
+GLAD_VOID_FUNCTION(void, glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(textarget) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level))
+GLAD_VOID_FUNCTION(void, glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(textarget) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level))
+GLAD_VOID_FUNCTION(void, glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(textarget) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(zoffset))
+GLAD_VOID_FUNCTION(void, glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(layer))
+GLAD_VOID_FUNCTION(void, glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode), GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(buffers))
+GLAD_VOID_FUNCTION(void, glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(framebuffers))
+GLAD_VOID_FUNCTION(void, glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(pipelines))
+GLAD_VOID_FUNCTION(void, glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(renderbuffers))
+GLAD_VOID_FUNCTION(void, glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers), GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(samplers))
+GLAD_VOID_FUNCTION(void, glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(textures))
+GLAD_VOID_FUNCTION(void, glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(ids))
+GLAD_VOID_FUNCTION(void, glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays), GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(arrays))
+GLAD_VOID_FUNCTION(void, glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target), GLAD_TRACE_ARG(target))
+GLAD_VOID_FUNCTION(void, glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC, (GLuint texture), (texture), GLAD_TRACE_ARG(texture))
+GLAD_VOID_FUNCTION(void, glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(bufferIndex) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformBlockIndex) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(uniformBlockName))
+GLAD_VOID_FUNCTION(void, glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformBlockIndex) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformIndex) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(uniformName))
+GLAD_VOID_FUNCTION(void, glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformCount) GLAD_TRACE_ARG(uniformIndices) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(maxCount) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(shaders))
+GLAD_FUNCTION(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(img))
+GLAD_VOID_FUNCTION(void, glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_FUNCTION(GLuint, glGetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(sources) GLAD_TRACE_ARG(types) GLAD_TRACE_ARG(ids) GLAD_TRACE_ARG(severities) GLAD_TRACE_ARG(lengths) GLAD_TRACE_ARG(messageLog))
+GLAD_VOID_FUNCTION(void, glGetDoublei_v, PFNGLGETDOUBLEI_VPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(data))
+GLAD_FUNCTION(GLenum, glGetError, PFNGLGETERRORPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glGetFloati_v, PFNGLGETFLOATI_VPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(data))
+GLAD_FUNCTION(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(name))
+GLAD_FUNCTION(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_FUNCTION(GLenum, glGetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(val))
+GLAD_VOID_FUNCTION(void, glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params), GLAD_TRACE_ARG(renderbuffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetObjectLabel, PFNGLGETOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label), GLAD_TRACE_ARG(identifier) GLAD_TRACE_ARG(name) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(label))
+GLAD_VOID_FUNCTION(void, glGetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label), GLAD_TRACE_ARG(ptr) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(label))
+GLAD_VOID_FUNCTION(void, glGetPointerv, PFNGLGETPOINTERVPROC, (GLenum pname, void **params), (pname, params), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(binaryFormat) GLAD_TRACE_ARG(binary))
+GLAD_VOID_FUNCTION(void, glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(infoLog))
+GLAD_VOID_FUNCTION(void, glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog), GLAD_TRACE_ARG(pipeline) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(infoLog))
+GLAD_VOID_FUNCTION(void, glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params), GLAD_TRACE_ARG(pipeline) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_FUNCTION(GLuint, glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(name))
+GLAD_FUNCTION(GLint, glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(name))
+GLAD_FUNCTION(GLint, glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(programInterface) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(propCount) GLAD_TRACE_ARG(props) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(offset))
+GLAD_VOID_FUNCTION(void, glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(offset))
+GLAD_VOID_FUNCTION(void, glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(offset))
+GLAD_VOID_FUNCTION(void, glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(offset))
+GLAD_VOID_FUNCTION(void, glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog), GLAD_TRACE_ARG(shader) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(infoLog))
+GLAD_VOID_FUNCTION(void, glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision), GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(precisiontype) GLAD_TRACE_ARG(range) GLAD_TRACE_ARG(precision))
+GLAD_VOID_FUNCTION(void, glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source), GLAD_TRACE_ARG(shader) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(source))
+GLAD_VOID_FUNCTION(void, glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params), GLAD_TRACE_ARG(shader) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_FUNCTION(const GLubyte *, glGetString, PFNGLGETSTRINGPROC, (GLenum name), (name), GLAD_TRACE_ARG(name))
+GLAD_FUNCTION(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index), GLAD_TRACE_ARG(name) GLAD_TRACE_ARG(index))
+GLAD_FUNCTION(GLuint, glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(name))
+GLAD_FUNCTION(GLint, glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values), GLAD_TRACE_ARG(sync) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param), GLAD_TRACE_ARG(xfb) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param), GLAD_TRACE_ARG(xfb) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param), GLAD_TRACE_ARG(xfb) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_FUNCTION(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformBlockName))
+GLAD_VOID_FUNCTION(void, glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformCount) GLAD_TRACE_ARG(uniformNames) GLAD_TRACE_ARG(uniformIndices))
+GLAD_FUNCTION(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(name))
+GLAD_VOID_FUNCTION(void, glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params), GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetUniformdv, PFNGLGETUNIFORMDVPROC, (GLuint program, GLint location, GLdouble *params), (program, location, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(pointer))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetnColorTable, PFNGLGETNCOLORTABLEPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(table))
+GLAD_VOID_FUNCTION(void, glGetnCompressedTexImage, PFNGLGETNCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(lod) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetnConvolutionFilter, PFNGLGETNCONVOLUTIONFILTERPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(image))
+GLAD_VOID_FUNCTION(void, glGetnHistogram, PFNGLGETNHISTOGRAMPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(reset) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetnMapdv, PFNGLGETNMAPDVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(query) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glGetnMapfv, PFNGLGETNMAPFVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(query) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glGetnMapiv, PFNGLGETNMAPIVPROC, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(query) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glGetnMinmax, PFNGLGETNMINMAXPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(reset) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetnPixelMapfv, PFNGLGETNPIXELMAPFVPROC, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values), GLAD_TRACE_ARG(map) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetnPixelMapuiv, PFNGLGETNPIXELMAPUIVPROC, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values), GLAD_TRACE_ARG(map) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetnPixelMapusv, PFNGLGETNPIXELMAPUSVPROC, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values), GLAD_TRACE_ARG(map) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glGetnPolygonStipple, PFNGLGETNPOLYGONSTIPPLEPROC, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern), GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pattern))
+GLAD_VOID_FUNCTION(void, glGetnSeparableFilter, PFNGLGETNSEPARABLEFILTERPROC, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(rowBufSize) GLAD_TRACE_ARG(row) GLAD_TRACE_ARG(columnBufSize) GLAD_TRACE_ARG(column) GLAD_TRACE_ARG(span))
+GLAD_VOID_FUNCTION(void, glGetnTexImage, PFNGLGETNTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glGetnUniformdv, PFNGLGETNUNIFORMDVPROC, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetnUniformfv, PFNGLGETNUNIFORMFVPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetnUniformiv, PFNGLGETNUNIFORMIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glGetnUniformuiv, PFNGLGETNUNIFORMUIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC, (GLuint buffer), (buffer), GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(numAttachments) GLAD_TRACE_ARG(attachments))
+GLAD_VOID_FUNCTION(void, glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(numAttachments) GLAD_TRACE_ARG(attachments))
+GLAD_VOID_FUNCTION(void, glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(numAttachments) GLAD_TRACE_ARG(attachments) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(numAttachments) GLAD_TRACE_ARG(attachments) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC, (GLuint texture, GLint level), (texture, level), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level))
+GLAD_VOID_FUNCTION(void, glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth))
+GLAD_FUNCTION(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer), GLAD_TRACE_ARG(buffer))
+GLAD_FUNCTION(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap), GLAD_TRACE_ARG(cap))
+GLAD_FUNCTION(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(index))
+GLAD_FUNCTION(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer), GLAD_TRACE_ARG(framebuffer))
+GLAD_FUNCTION(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program), GLAD_TRACE_ARG(program))
+GLAD_FUNCTION(GLboolean, glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), GLAD_TRACE_ARG(pipeline))
+GLAD_FUNCTION(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id), GLAD_TRACE_ARG(id))
+GLAD_FUNCTION(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer), GLAD_TRACE_ARG(renderbuffer))
+GLAD_FUNCTION(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler), GLAD_TRACE_ARG(sampler))
+GLAD_FUNCTION(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader), GLAD_TRACE_ARG(shader))
+GLAD_FUNCTION(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync), GLAD_TRACE_ARG(sync))
+GLAD_FUNCTION(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture), GLAD_TRACE_ARG(texture))
+GLAD_FUNCTION(GLboolean, glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id), GLAD_TRACE_ARG(id))
+GLAD_FUNCTION(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array), GLAD_TRACE_ARG(array))
+GLAD_VOID_FUNCTION(void, glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width), GLAD_TRACE_ARG(width))
+GLAD_VOID_FUNCTION(void, glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program), GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode), GLAD_TRACE_ARG(opcode))
+GLAD_FUNCTION(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(access))
+GLAD_FUNCTION(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(access))
+GLAD_FUNCTION(void *, glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC, (GLuint buffer, GLenum access), (buffer, access), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(access))
+GLAD_FUNCTION(void *, glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(access))
+GLAD_VOID_FUNCTION(void, glMemoryBarrier, PFNGLMEMORYBARRIERPROC, (GLbitfield barriers), (barriers), GLAD_TRACE_ARG(barriers))
+GLAD_VOID_FUNCTION(void, glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC, (GLbitfield barriers), (barriers), GLAD_TRACE_ARG(barriers))
+GLAD_VOID_FUNCTION(void, glMinSampleShading, PFNGLMINSAMPLESHADINGPROC, (GLfloat value), (value), GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(drawcount))
+GLAD_VOID_FUNCTION(void, glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(indirect) GLAD_TRACE_ARG(drawcount) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glMultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(indirect) GLAD_TRACE_ARG(drawcount) GLAD_TRACE_ARG(maxdrawcount) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(drawcount))
+GLAD_VOID_FUNCTION(void, glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indices) GLAD_TRACE_ARG(drawcount) GLAD_TRACE_ARG(basevertex))
+GLAD_VOID_FUNCTION(void, glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indirect) GLAD_TRACE_ARG(drawcount) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glMultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride), GLAD_TRACE_ARG(mode) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(indirect) GLAD_TRACE_ARG(drawcount) GLAD_TRACE_ARG(maxdrawcount) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data) GLAD_TRACE_ARG(usage))
+GLAD_VOID_FUNCTION(void, glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data) GLAD_TRACE_ARG(flags))
+GLAD_VOID_FUNCTION(void, glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data), GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, (GLuint framebuffer, GLenum buf), (framebuffer, buf), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(buf))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(n) GLAD_TRACE_ARG(bufs))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, (GLuint framebuffer, GLenum src), (framebuffer, src), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(src))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(renderbuffertarget) GLAD_TRACE_ARG(renderbuffer))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level))
+GLAD_VOID_FUNCTION(void, glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer), GLAD_TRACE_ARG(framebuffer) GLAD_TRACE_ARG(attachment) GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(layer))
+GLAD_VOID_FUNCTION(void, glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height), GLAD_TRACE_ARG(renderbuffer) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height), GLAD_TRACE_ARG(renderbuffer) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glObjectLabel, PFNGLOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label), GLAD_TRACE_ARG(identifier) GLAD_TRACE_ARG(name) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(label))
+GLAD_VOID_FUNCTION(void, glObjectPtrLabel, PFNGLOBJECTPTRLABELPROC, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label), GLAD_TRACE_ARG(ptr) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(label))
+GLAD_VOID_FUNCTION(void, glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC, (GLenum pname, const GLfloat *values), (pname, values), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(values))
+GLAD_VOID_FUNCTION(void, glPatchParameteri, PFNGLPATCHPARAMETERIPROC, (GLenum pname, GLint value), (pname, value), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params), GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size), GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode), GLAD_TRACE_ARG(face) GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units), GLAD_TRACE_ARG(factor) GLAD_TRACE_ARG(units))
+GLAD_VOID_FUNCTION(void, glPolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp), GLAD_TRACE_ARG(factor) GLAD_TRACE_ARG(units) GLAD_TRACE_ARG(clamp))
+GLAD_VOID_FUNCTION(void, glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index), GLAD_TRACE_ARG(index))
+GLAD_VOID_FUNCTION(void, glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(binaryFormat) GLAD_TRACE_ARG(binary) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode), GLAD_TRACE_ARG(mode))
+GLAD_VOID_FUNCTION(void, glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message), GLAD_TRACE_ARG(source) GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(length) GLAD_TRACE_ARG(message))
+GLAD_VOID_FUNCTION(void, glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target), GLAD_TRACE_ARG(id) GLAD_TRACE_ARG(target))
+GLAD_VOID_FUNCTION(void, glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src), GLAD_TRACE_ARG(src))
+GLAD_VOID_FUNCTION(void, glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels), GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glReadnPixels, PFNGLREADNPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data), GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(bufSize) GLAD_TRACE_ARG(data))
+GLAD_VOID_FUNCTION(void, glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert), GLAD_TRACE_ARG(value) GLAD_TRACE_ARG(invert))
+GLAD_VOID_FUNCTION(void, glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), GLAD_TRACE_ARG(maskNumber) GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLAD_TRACE_ARG(sampler) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glScissorArrayv, PFNGLSCISSORARRAYVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glScissorIndexed, PFNGLSCISSORINDEXEDPROC, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(left) GLAD_TRACE_ARG(bottom) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(color))
+GLAD_VOID_FUNCTION(void, glShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length), GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(shaders) GLAD_TRACE_ARG(binaryFormat) GLAD_TRACE_ARG(binary) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length), GLAD_TRACE_ARG(shader) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(string) GLAD_TRACE_ARG(length))
+GLAD_VOID_FUNCTION(void, glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(storageBlockIndex) GLAD_TRACE_ARG(storageBlockBinding))
+GLAD_VOID_FUNCTION(void, glSpecializeShader, PFNGLSPECIALIZESHADERPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), GLAD_TRACE_ARG(shader) GLAD_TRACE_ARG(pEntryPoint) GLAD_TRACE_ARG(numSpecializationConstants) GLAD_TRACE_ARG(pConstantIndex) GLAD_TRACE_ARG(pConstantValue))
+GLAD_VOID_FUNCTION(void, glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), GLAD_TRACE_ARG(func) GLAD_TRACE_ARG(ref) GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), GLAD_TRACE_ARG(face) GLAD_TRACE_ARG(func) GLAD_TRACE_ARG(ref) GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask), GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask), GLAD_TRACE_ARG(face) GLAD_TRACE_ARG(mask))
+GLAD_VOID_FUNCTION(void, glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), GLAD_TRACE_ARG(fail) GLAD_TRACE_ARG(zfail) GLAD_TRACE_ARG(zpass))
+GLAD_VOID_FUNCTION(void, glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), GLAD_TRACE_ARG(face) GLAD_TRACE_ARG(sfail) GLAD_TRACE_ARG(dpfail) GLAD_TRACE_ARG(dppass))
+GLAD_VOID_FUNCTION(void, glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glTexBufferRange, PFNGLTEXBUFFERRANGEPROC, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(coords))
+GLAD_VOID_FUNCTION(void, glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(border) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTexStorage1D, PFNGLTEXSTORAGE1DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width))
+GLAD_VOID_FUNCTION(void, glTexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth))
+GLAD_VOID_FUNCTION(void, glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTextureBarrier, PFNGLTEXTUREBARRIERPROC, (void), (), )
+GLAD_VOID_FUNCTION(void, glTextureBuffer, PFNGLTEXTUREBUFFERPROC, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(params))
+GLAD_VOID_FUNCTION(void, glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC, (GLuint texture, GLenum pname, GLint param), (texture, pname, param), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(pname) GLAD_TRACE_ARG(param))
+GLAD_VOID_FUNCTION(void, glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width))
+GLAD_VOID_FUNCTION(void, glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(levels) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth))
+GLAD_VOID_FUNCTION(void, glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(samples) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(fixedsamplelocations))
+GLAD_VOID_FUNCTION(void, glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(level) GLAD_TRACE_ARG(xoffset) GLAD_TRACE_ARG(yoffset) GLAD_TRACE_ARG(zoffset) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height) GLAD_TRACE_ARG(depth) GLAD_TRACE_ARG(format) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(pixels))
+GLAD_VOID_FUNCTION(void, glTextureView, PFNGLTEXTUREVIEWPROC, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers), GLAD_TRACE_ARG(texture) GLAD_TRACE_ARG(target) GLAD_TRACE_ARG(origtexture) GLAD_TRACE_ARG(internalformat) GLAD_TRACE_ARG(minlevel) GLAD_TRACE_ARG(numlevels) GLAD_TRACE_ARG(minlayer) GLAD_TRACE_ARG(numlayers))
+GLAD_VOID_FUNCTION(void, glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer), GLAD_TRACE_ARG(xfb) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size), GLAD_TRACE_ARG(xfb) GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(size))
+GLAD_VOID_FUNCTION(void, glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(varyings) GLAD_TRACE_ARG(bufferMode))
+GLAD_VOID_FUNCTION(void, glUniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glUniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0))
+GLAD_VOID_FUNCTION(void, glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glUniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1))
+GLAD_VOID_FUNCTION(void, glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glUniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2))
+GLAD_VOID_FUNCTION(void, glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glUniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(v0) GLAD_TRACE_ARG(v1) GLAD_TRACE_ARG(v2) GLAD_TRACE_ARG(v3))
+GLAD_VOID_FUNCTION(void, glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), GLAD_TRACE_ARG(program) GLAD_TRACE_ARG(uniformBlockIndex) GLAD_TRACE_ARG(uniformBlockBinding))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_TRACE_ARG(location) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(transpose) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices), GLAD_TRACE_ARG(shadertype) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(indices))
+GLAD_FUNCTION(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target), GLAD_TRACE_ARG(target))
+GLAD_FUNCTION(GLboolean, glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC, (GLuint buffer), (buffer), GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program), GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program), GLAD_TRACE_ARG(pipeline) GLAD_TRACE_ARG(stages) GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program), GLAD_TRACE_ARG(program))
+GLAD_VOID_FUNCTION(void, glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), GLAD_TRACE_ARG(pipeline))
+GLAD_VOID_FUNCTION(void, glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(bindingindex))
+GLAD_VOID_FUNCTION(void, glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(bindingindex) GLAD_TRACE_ARG(divisor))
+GLAD_VOID_FUNCTION(void, glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC, (GLuint vaobj, GLuint buffer), (vaobj, buffer), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(buffer))
+GLAD_VOID_FUNCTION(void, glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(bindingindex) GLAD_TRACE_ARG(buffer) GLAD_TRACE_ARG(offset) GLAD_TRACE_ARG(stride))
+GLAD_VOID_FUNCTION(void, glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides), GLAD_TRACE_ARG(vaobj) GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(buffers) GLAD_TRACE_ARG(offsets) GLAD_TRACE_ARG(strides))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex), GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(bindingindex))
+GLAD_VOID_FUNCTION(void, glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(divisor))
+GLAD_VOID_FUNCTION(void, glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset), GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(stride) GLAD_TRACE_ARG(pointer))
+GLAD_VOID_FUNCTION(void, glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC, (GLuint index, GLdouble x), (index, x), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x))
+GLAD_VOID_FUNCTION(void, glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y))
+GLAD_VOID_FUNCTION(void, glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z))
+GLAD_VOID_FUNCTION(void, glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(z) GLAD_TRACE_ARG(w))
+GLAD_VOID_FUNCTION(void, glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLAD_TRACE_ARG(attribindex) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(relativeoffset))
+GLAD_VOID_FUNCTION(void, glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(stride) GLAD_TRACE_ARG(pointer))
+GLAD_VOID_FUNCTION(void, glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(size) GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(normalized) GLAD_TRACE_ARG(stride) GLAD_TRACE_ARG(pointer))
+GLAD_VOID_FUNCTION(void, glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor), GLAD_TRACE_ARG(bindingindex) GLAD_TRACE_ARG(divisor))
+GLAD_VOID_FUNCTION(void, glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_TRACE_ARG(type) GLAD_TRACE_ARG(value))
+GLAD_VOID_FUNCTION(void, glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(width) GLAD_TRACE_ARG(height))
+GLAD_VOID_FUNCTION(void, glViewportArrayv, PFNGLVIEWPORTARRAYVPROC, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v), GLAD_TRACE_ARG(first) GLAD_TRACE_ARG(count) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(x) GLAD_TRACE_ARG(y) GLAD_TRACE_ARG(w) GLAD_TRACE_ARG(h))
+GLAD_VOID_FUNCTION(void, glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_TRACE_ARG(index) GLAD_TRACE_ARG(v))
+GLAD_VOID_FUNCTION(void, glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLAD_TRACE_ARG(sync) GLAD_TRACE_ARG(flags) GLAD_TRACE_ARG(timeout))
@@ -0,0 +1,38 @@
+#version 330 core
+// Covers the three colour_from_*.frag shaders
+// Features (injected by the preprocessor):
+//   VERTEX_COLOUR - use the colour from the vertex shader
+//   GLOBAL_COLOUR - use the ourColor uniform
+//   OBJECT_BLOCK/OBJECT_UNIFORMS - use objectColour (see blocks.glsl), tinted by the frame's tint with the block
+//   DEPTH_ONLY - write nothing, for the depth prepass (colour writes are masked off then anyway)
+//   OVERDRAW - a small fixed amount to be added up with blending, so brighter means more fragments shaded
+// With none of them it's a constant orange
+#include "colours.glsl"
+#include "blocks.glsl"
+out vec4 FragColor;
+
+#if defined(OBJECT_BLOCK) || defined(OBJECT_UNIFORMS)
+#elif defined(VERTEX_COLOUR)
+in vec4 vertexColor;
+#elif defined(GLOBAL_COLOUR)
+uniform vec4 ourColor;
+#endif
+
+void main()
+{
+#if defined(DEPTH_ONLY)
+    // Nothing to do, the depth comes straight from the rasteriser
+#elif defined(OVERDRAW)
+    FragColor = OVERDRAW_STEP;
+#elif defined(OBJECT_BLOCK)
+    FragColor = objectColour * tint;
+#elif defined(OBJECT_UNIFORMS)
+    FragColor = objectColour;
+#elif defined(VERTEX_COLOUR)
+    FragColor = vertexColor;
+#elif defined(GLOBAL_COLOUR)
+    FragColor = ourColor;
+#else
+    FragColor = ORANGE;
+#endif
+}
@@ -0,0 +1,24 @@
+#version 330 core
+// Covers default.vert, colour_from_constant.vert and colour_per_vertex.vert
+// Features (injected by the preprocessor):
+//   VERTEX_COLOUR - take a colour per vertex from location 1
+//   OBJECT_BLOCK/OBJECT_UNIFORMS - move, scale and push back by objectOffset (see blocks.glsl)
+#include "colours.glsl"
+#include "blocks.glsl"
+layout (location = 0) in vec3 aPos;
+#ifdef VERTEX_COLOUR
+layout (location = 1) in vec3 aColor;
+out vec4 vertexColor;
+#endif
+
+void main()
+{
+#if defined(OBJECT_BLOCK) || defined(OBJECT_UNIFORMS)
+    gl_Position = vec4(aPos * objectOffset.z + objectOffset.xyw, 1.0);
+#else
+    gl_Position = vec4(aPos, 1.0);
+#endif
+#ifdef VERTEX_COLOUR
+    vertexColor = vec4(aColor, 1.0);
+#endif
+}
@@ -0,0 +1,20 @@
+// Per frame and per object data, these have to match the structs in src/shader_data.h
+// Features (injected by the preprocessor):
+//   OBJECT_BLOCK    - the object data comes from the PerObject uniform block
+//   OBJECT_UNIFORMS - the same thing as plain uniforms, to compare against
+#if defined(OBJECT_BLOCK)
+layout (std140) uniform PerFrame
+{
+    float time;
+    vec4 tint;
+};
+
+layout (std140) uniform PerObject
+{
+    vec4 objectOffset; // xy = position, z = scale, w = depth
+    vec4 objectColour;
+};
+#elif defined(OBJECT_UNIFORMS)
+uniform vec4 objectOffset;
+uniform vec4 objectColour;
+#endif
@@ -0,0 +1,5 @@
+// Shared colours, pull this in with #include "colours.glsl"
+const vec4 ORANGE = vec4(1.0f, 0.5f, 0.2f, 1.0f);
+const vec4 DARK_RED = vec4(0.5, 0.0, 0.0, 1.0);
+// Red fills up after 8 layers, green after 16 and blue after 32, so it goes red, yellow, white
+const vec4 OVERDRAW_STEP = vec4(1.0 / 8.0, 1.0 / 16.0, 1.0 / 32.0, 1.0);
@@ -0,0 +1,12 @@
+#version 330 core
+in vec2 texCoord;
+in vec4 spriteColour;
+
+out vec4 FragColor;
+
+uniform sampler2D spriteTexture;
+
+void main()
+{
+    FragColor = texture(spriteTexture, texCoord) * spriteColour;
+}
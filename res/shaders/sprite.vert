@@ -0,0 +1,14 @@
+#version 330 core
+// For SpriteBatch, positions are already in clip space
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColour;
+
+out vec2 texCoord;
+out vec4 spriteColour;
+void main()
+{
+    gl_Position = vec4(aPos, 0.0, 1.0);
+    texCoord = aTexCoord;
+    spriteColour = aColour;
+}
@@ -0,0 +1,28 @@
+#version 330 core
+#ifdef BINDLESS
+#extension GL_ARB_bindless_texture : require
+#endif
+in vec2 texCoord;
+flat in uvec2 textureId;
+
+out vec4 FragColor;
+
+// With BINDLESS the handle is the sampler, there's nothing to bind
+#ifndef BINDLESS
+#ifdef TEXTURE_ARRAY
+uniform sampler2DArray textures;
+#else
+uniform sampler2D textures;
+#endif
+#endif
+
+void main()
+{
+#if defined(BINDLESS)
+    FragColor = texture(sampler2D(textureId), texCoord);
+#elif defined(TEXTURE_ARRAY)
+    FragColor = texture(textures, vec3(texCoord, float(textureId.x)));
+#else
+    FragColor = texture(textures, texCoord);
+#endif
+}
@@ -0,0 +1,18 @@
+#version 330 core
+// Textured quads, with each vertex saying which texture it's from. How that's read depends on the
+// fragment shader's feature:
+//  - neither: ignored, it's whatever's bound to unit 0, so one draw per texture
+//  - TEXTURE_ARRAY: the layer, in x
+//  - BINDLESS: a GL_ARB_bindless_texture handle, low 32 bits in x and high in y
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in uvec2 aTexture;
+
+out vec2 texCoord;
+flat out uvec2 textureId;
+void main()
+{
+    gl_Position = vec4(aPos, 0.0, 1.0);
+    texCoord = aTexCoord;
+    textureId = aTexture;
+}
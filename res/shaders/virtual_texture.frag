@@ -0,0 +1,43 @@
+#version 330 core
+// Draws from a VirtualTexture (src/virtual_texture.h). Works out which mip level and tile each
+// pixel wants, then either:
+//  - FEEDBACK: writes that down for processFeedback, tile x and y, level, 255
+//  - otherwise: looks up where that tile (or the nearest coarser one that's there) is in the
+//    indirection texture, and samples it from the physical texture
+in vec2 virtualCoord;
+
+out vec4 FragColor;
+
+// x: texels across level 0, y: tiles across level 0, z: mip levels, w: added to the mip level,
+// so a feedback pass drawn at a quarter of the size can ask for what the full size one wants
+uniform vec4 virtualInfo;
+#ifndef FEEDBACK
+// x: texels across a tile, y: border texels round each tile, z: 1 / physical texture size,
+// w: texels across a slot, tile and border together
+uniform vec4 physicalInfo;
+uniform sampler2D physicalTexture;
+uniform sampler2D indirectionTexture;
+#endif
+
+void main()
+{
+    vec2 coord = clamp(virtualCoord, 0.0, 1.0);
+    // The usual mip level choice: log2 of how many texels one pixel step covers
+    vec2 dx = dFdx(virtualCoord * virtualInfo.x), dy = dFdy(virtualCoord * virtualInfo.x);
+    float level = 0.5 * log2(max(dot(dx, dx), dot(dy, dy))) + virtualInfo.w;
+    level = clamp(floor(level), 0.0, virtualInfo.z - 1.0);
+    float tilesAcross = virtualInfo.y / exp2(level);
+    vec2 tile = min(floor(coord * tilesAcross), vec2(tilesAcross - 1.0));
+
+#ifdef FEEDBACK
+    FragColor = vec4(tile, level, 255.0) / 255.0;
+#else
+    // r, g: the slot, b: the level of the tile that's actually there, which may be coarser
+    vec3 entry = texelFetch(indirectionTexture, ivec2(tile), int(level)).rgb * 255.0;
+    float entryTilesAcross = virtualInfo.y / exp2(entry.b);
+    vec2 inTile = min(coord * entryTilesAcross - floor(coord * entryTilesAcross), vec2(1.0));
+    vec2 texel = entry.rg * physicalInfo.w + physicalInfo.y + inTile * physicalInfo.x;
+    // The physical texture has no mips, and the jump between tiles would confuse the derivatives anyway
+    FragColor = textureLod(physicalTexture, texel * physicalInfo.z, 0.0);
+#endif
+}
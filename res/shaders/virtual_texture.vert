@@ -0,0 +1,14 @@
+#version 330 core
+// A rectangle covering the whole target, made from gl_VertexID so there's nothing to bind but an
+// empty VAO. Draw 4 vertices as a triangle strip.
+// view: the virtual texture coordinate at the middle of the screen (xy) and how far it goes to
+// the edges (zw). The whole virtual texture is 0 to 1.
+uniform vec4 view;
+
+out vec2 virtualCoord;
+void main()
+{
+    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0 - 1.0;
+    gl_Position = vec4(corner, 0.0, 1.0);
+    virtualCoord = view.xy + corner * view.zw;
+}
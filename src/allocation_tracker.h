@@ -0,0 +1,170 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Counts every heap allocation made through new (which is all of the standard containers), so the
+// render loop can be checked for allocating when it shouldn't. Once everything's warmed up a frame
+// shouldn't need any: per frame data goes in a FrameArena, and anything kept between frames should
+// be reused rather than rebuilt.
+//
+// This replaces the global operator new and delete for the whole program, so include it from
+// exactly one .cpp file (main.cpp, or a tool's). Counts are kept per thread, so the render
+// thread's aren't mixed up with whatever the shader watcher or frame capture threads are doing.
+// malloc and the driver's own allocations aren't seen.
+struct AllocationCounts
+{
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    uint64_t frees = 0;
+
+    AllocationCounts operator-(const AllocationCounts& other) const
+    {
+        return { allocations - other.allocations, bytes - other.bytes, frees - other.frees };
+    }
+};
+
+// Everything allocated on this thread so far
+inline AllocationCounts& threadAllocations()
+{
+    // Plain data, so there's nothing to construct the first time it's touched, which could
+    // itself allocate
+    static thread_local AllocationCounts counts;
+    return counts;
+}
+
+// Every thread put together
+inline std::atomic<uint64_t> totalAllocations{ 0 };
+inline std::atomic<uint64_t> totalAllocatedBytes{ 0 };
+
+inline void countAllocation(size_t bytes)
+{
+    AllocationCounts& counts = threadAllocations();
+    counts.allocations++;
+    counts.bytes += bytes;
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    totalAllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// Adds up what this thread allocates between beginFrame() and endFrame(), frame by frame
+struct FrameAllocationStats
+{
+    void beginFrame()
+    {
+        start = threadAllocations();
+    }
+
+    void endFrame()
+    {
+        last = threadAllocations() - start;
+        totals.allocations += last.allocations;
+        totals.bytes += last.bytes;
+        totals.frees += last.frees;
+        frames++;
+        if (last.allocations)
+            framesAllocating++;
+        if (last.allocations > worst.allocations)
+            worst = last;
+    }
+
+    void reset()
+    {
+        *this = FrameAllocationStats();
+    }
+
+    // The last frame, the one that allocated the most, and all of them added up
+    AllocationCounts last;
+    AllocationCounts worst;
+    AllocationCounts totals;
+    uint64_t frames = 0;
+    uint64_t framesAllocating = 0;
+
+private:
+    AllocationCounts start;
+};
+
+namespace allocation_tracker
+{
+    inline void* allocate(size_t size)
+    {
+        countAllocation(size);
+        for (;;)
+        {
+            if (void* memory = malloc(size ? size : 1))
+                return memory;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    inline void* allocateAligned(size_t size, size_t alignment)
+    {
+        countAllocation(size);
+        // aligned_alloc wants the size to be a multiple of the alignment
+        size = (size + alignment - 1) / alignment * alignment;
+        for (;;)
+        {
+#ifdef _WIN32
+            void* memory = _aligned_malloc(size ? size : alignment, alignment);
+#else
+            void* memory = aligned_alloc(alignment, size ? size : alignment);
+#endif
+            if (memory)
+                return memory;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    inline void release(void* memory)
+    {
+        if (!memory)
+            return;
+        threadAllocations().frees++;
+        free(memory);
+    }
+
+    inline void releaseAligned(void* memory)
+    {
+        if (!memory)
+            return;
+        threadAllocations().frees++;
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        free(memory);
+#endif
+    }
+}
+
+// The replacements themselves. These can't be inline, hence only one .cpp file per program.
+void* operator new(size_t size) { return allocation_tracker::allocate(size); }
+void* operator new[](size_t size) { return allocation_tracker::allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try { return allocation_tracker::allocate(size); }
+    catch (...) { return nullptr; }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try { return allocation_tracker::allocate(size); }
+    catch (...) { return nullptr; }
+}
+void* operator new(size_t size, std::align_val_t alignment) { return allocation_tracker::allocateAligned(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocation_tracker::allocateAligned(size, (size_t)alignment); }
+
+void operator delete(void* memory) noexcept { allocation_tracker::release(memory); }
+void operator delete[](void* memory) noexcept { allocation_tracker::release(memory); }
+void operator delete(void* memory, size_t) noexcept { allocation_tracker::release(memory); }
+void operator delete[](void* memory, size_t) noexcept { allocation_tracker::release(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { allocation_tracker::release(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { allocation_tracker::release(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { allocation_tracker::releaseAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { allocation_tracker::releaseAligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { allocation_tracker::releaseAligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { allocation_tracker::releaseAligned(memory); }
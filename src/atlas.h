@@ -0,0 +1,468 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "gl_objects.h"
+#include "png.h"
+
+// Lots of small images packed into one big texture, so everything drawn from them can go in one
+// batch instead of binding a texture (and starting a new draw call) per image.
+//
+// RectPacker finds room for each rectangle, either with a skyline (fast, keeps just the top edge of
+// what's been placed, good for images that arrive one at a time at runtime) or with maximal
+// rectangles (slower, keeps every free area, packs tighter, good for building atlases offline).
+//
+// TextureAtlas puts the pixels in place and keeps a table of where each image ended up, in
+// texels and as UVs. Each image is surrounded by padding filled with copies of its edge pixels,
+// so filtering and the smaller mip levels only ever blend in the image's own colours rather than
+// its neighbours'. Images can be added at any time, upload() sends whatever changed.
+struct AtlasRect
+{
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool contains(const AtlasRect& other) const
+    {
+        return other.x >= x && other.y >= y && other.x + other.width <= x + width && other.y + other.height <= y + height;
+    }
+
+    bool overlaps(const AtlasRect& other) const
+    {
+        return other.x < x + width && other.x + other.width > x && other.y < y + height && other.y + other.height > y;
+    }
+};
+
+// Where an image is in the atlas in texture coordinates, (u0, v0) the bottom left
+struct UVRect
+{
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+};
+
+enum class PackMethod
+{
+    Skyline,
+    MaxRects,
+};
+
+class RectPacker
+{
+public:
+    void reset(int width, int height, PackMethod method)
+    {
+        this->width = width;
+        this->height = height;
+        this->method = method;
+        usedArea = 0;
+        skyline.assign(1, { 0, 0, width });
+        freeRects.assign(1, { 0, 0, width, height });
+    }
+
+    // Finds room for a width x height rectangle. Returns false if there isn't any.
+    bool insert(int rectWidth, int rectHeight, AtlasRect& placed)
+    {
+        if (rectWidth <= 0 || rectHeight <= 0)
+            return false;
+        bool found = method == PackMethod::Skyline ? insertSkyline(rectWidth, rectHeight, placed) : insertMaxRects(rectWidth, rectHeight, placed);
+        if (found)
+            usedArea += (size_t)rectWidth * rectHeight;
+        return found;
+    }
+
+    // Marks a rectangle as already used, e.g. from an atlas that was loaded. Only the max rects
+    // method can place things around it, so that's what it switches to.
+    void reserve(const AtlasRect& rect)
+    {
+        method = PackMethod::MaxRects;
+        occupy(rect);
+        usedArea += (size_t)rect.width * rect.height;
+    }
+
+    // How much of the area has been handed out, 0 to 1
+    double occupancy() const
+    {
+        return width && height ? (double)usedArea / ((double)width * height) : 0.0;
+    }
+
+    int width = 0;
+    int height = 0;
+    PackMethod method = PackMethod::Skyline;
+
+private:
+    // A stretch of the top edge of everything placed so far, nodes are left to right
+    struct SkylineNode
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    // Bottom left: the lowest spot along the skyline, then the narrowest stretch to break ties
+    bool insertSkyline(int rectWidth, int rectHeight, AtlasRect& placed)
+    {
+        int bestY = INT_MAX, bestWidth = INT_MAX;
+        size_t bestNode = SIZE_MAX;
+        for (size_t i = 0; i < skyline.size(); i++)
+        {
+            int x = skyline[i].x;
+            if (x + rectWidth > width)
+                break;
+            // It sits on the highest node it spans
+            int y = 0;
+            int widthLeft = rectWidth;
+            for (size_t j = i; widthLeft > 0; j++)
+            {
+                y = std::max(y, skyline[j].y);
+                widthLeft -= skyline[j].width;
+            }
+            if (y + rectHeight > height)
+                continue;
+            if (y < bestY || (y == bestY && skyline[i].width < bestWidth))
+            {
+                bestY = y;
+                bestWidth = skyline[i].width;
+                bestNode = i;
+            }
+        }
+        if (bestNode == SIZE_MAX)
+            return false;
+
+        placed = { skyline[bestNode].x, bestY, rectWidth, rectHeight };
+        skyline.insert(skyline.begin() + bestNode, { placed.x, bestY + rectHeight, rectWidth });
+        // Cut the nodes it now covers back to where it ends
+        for (size_t i = bestNode + 1; i < skyline.size();)
+        {
+            int covered = placed.x + rectWidth - skyline[i].x;
+            if (covered <= 0)
+                break;
+            if (covered < skyline[i].width)
+            {
+                skyline[i].x += covered;
+                skyline[i].width -= covered;
+                break;
+            }
+            skyline.erase(skyline.begin() + i);
+        }
+        // Join up neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+        return true;
+    }
+
+    // Best short side fit: the free rectangle it fits most snugly in
+    bool insertMaxRects(int rectWidth, int rectHeight, AtlasRect& placed)
+    {
+        int bestShort = INT_MAX, bestLong = INT_MAX;
+        for (const AtlasRect& free : freeRects)
+        {
+            if (free.width < rectWidth || free.height < rectHeight)
+                continue;
+            int leftX = free.width - rectWidth, leftY = free.height - rectHeight;
+            int shortSide = std::min(leftX, leftY), longSide = std::max(leftX, leftY);
+            if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+            {
+                bestShort = shortSide;
+                bestLong = longSide;
+                placed = { free.x, free.y, rectWidth, rectHeight };
+            }
+        }
+        if (bestShort == INT_MAX)
+            return false;
+        occupy(placed);
+        return true;
+    }
+
+    // Takes a rectangle out of the free ones, wherever it is (MaxRects only)
+    void occupy(const AtlasRect& placed)
+    {
+        // Every free rectangle it overlaps is split into the (up to four) bits around it
+        scratch.clear();
+        for (const AtlasRect& free : freeRects)
+        {
+            if (!free.overlaps(placed))
+            {
+                scratch.push_back(free);
+                continue;
+            }
+            if (placed.x > free.x)
+                scratch.push_back({ free.x, free.y, placed.x - free.x, free.height });
+            if (placed.x + placed.width < free.x + free.width)
+                scratch.push_back({ placed.x + placed.width, free.y, free.x + free.width - placed.x - placed.width, free.height });
+            if (placed.y > free.y)
+                scratch.push_back({ free.x, free.y, free.width, placed.y - free.y });
+            if (placed.y + placed.height < free.y + free.height)
+                scratch.push_back({ free.x, placed.y + placed.height, free.width, free.y + free.height - placed.y - placed.height });
+        }
+        // Drop any that are inside another, they'd never be the best fit. Of two the same, the
+        // first is kept.
+        freeRects.clear();
+        for (size_t i = 0; i < scratch.size(); i++)
+        {
+            bool inside = false;
+            for (size_t j = 0; j < scratch.size() && !inside; j++)
+                inside = j != i && scratch[j].contains(scratch[i]) && (j < i || !scratch[i].contains(scratch[j]));
+            if (!inside)
+                freeRects.push_back(scratch[i]);
+        }
+    }
+
+    size_t usedArea = 0;
+    std::vector<SkylineNode> skyline;
+    std::vector<AtlasRect> freeRects;
+    std::vector<AtlasRect> scratch;
+};
+
+// One image in the atlas
+struct AtlasEntry
+{
+    std::string name;
+    // The image itself, without its padding, in texels from the bottom left
+    AtlasRect rect;
+    UVRect uv;
+};
+
+class TextureAtlas
+{
+public:
+    // Starts again, empty. padding is how many texels of copied edge go round each image.
+    void reset(int size, PackMethod method = PackMethod::Skyline, int padding = 4)
+    {
+        this->size = size;
+        this->padding = padding;
+        // Each mip level halves the padding, so there's only enough for log2(padding) smaller
+        // levels before neighbours start bleeding in
+        mipLevels = 1;
+        while ((1 << mipLevels) <= padding)
+            mipLevels++;
+        // With every rectangle a multiple of the smallest level's texel, they all start on one too
+        alignment = 1 << (mipLevels - 1);
+        packer.reset(size, size, method);
+        pixels.width = pixels.height = size;
+        pixels.rgba.assign((size_t)size * size * 4, 0);
+        entries.clear();
+        names.clear();
+        imageArea = 0;
+        dirty = { 0, 0, size, size };
+        uploadedTexels = 0;
+    }
+
+    // Packs the image in and returns its index in the table, or -1 if there's no room left.
+    // Adding a name that's already there just returns that one.
+    int add(const std::string& name, const Image& image)
+    {
+        auto existing = names.find(name);
+        if (existing != names.end())
+            return existing->second;
+        AtlasRect placed;
+        if (!packer.insert(alignUp(image.width + padding * 2), alignUp(image.height + padding * 2), placed))
+            return -1;
+
+        // The padding (and any left over from lining it up) repeats the nearest edge pixel
+        for (int y = 0; y < placed.height; y++)
+        {
+            int sourceY = std::min(std::max(y - padding, 0), image.height - 1);
+            uint8_t* out = pixels.pixel(placed.x, placed.y + y);
+            for (int x = 0; x < placed.width; x++)
+            {
+                int sourceX = std::min(std::max(x - padding, 0), image.width - 1);
+                memcpy(out + x * 4, image.pixel(sourceX, sourceY), 4);
+            }
+        }
+        return addEntry(name, { placed.x + padding, placed.y + padding, image.width, image.height });
+    }
+
+    // Index of the named image, -1 if it isn't there
+    int find(const std::string& name) const
+    {
+        auto it = names.find(name);
+        return it != names.end() ? it->second : -1;
+    }
+
+    const AtlasEntry& entry(int index) const
+    {
+        return entries[index];
+    }
+
+    size_t count() const
+    {
+        return entries.size();
+    }
+
+    // How much of the atlas is the images themselves, 0 to 1, and how much has been handed out
+    // once the padding is counted
+    double occupancy() const
+    {
+        return size ? (double)imageArea / ((double)size * size) : 0.0;
+    }
+
+    double packedOccupancy() const
+    {
+        return packer.occupancy();
+    }
+
+    // Sends whatever's been added since last time (making the texture the first time) and
+    // rebuilds the mip levels. Needs a context.
+    void upload(const char* label = "Texture atlas")
+    {
+        if (dirty.width == 0)
+            return;
+        if (!texture)
+        {
+            texture = GLTexture::create();
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.rgba.data());
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            // Further away than this just stays at the smallest level the padding covers
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipLevels - 1);
+            GL_DEBUG_LABEL(GL_TEXTURE, texture, label);
+        }
+        else
+        {
+            // Only the rows and columns that changed, picked out of the whole atlas
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, size);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, dirty.x, dirty.y, dirty.width, dirty.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.pixel(dirty.x, dirty.y));
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        }
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        uploadedTexels += (size_t)dirty.width * dirty.height;
+        dirty = {};
+    }
+
+    void destroy()
+    {
+        texture.reset();
+    }
+
+    // Writes the atlas to path (a PNG) and its table next to it, path with .txt on the end
+    bool save(const std::string& path) const
+    {
+        if (!writePng(path, pixels))
+            return false;
+        std::ofstream table(path + ".txt");
+        table << "# Written by TextureAtlas::save, each image's rectangle in texels from the bottom left\n";
+        table << "atlas " << size << " " << padding << "\n";
+        for (const AtlasEntry& entry : entries)
+            table << "image " << entry.rect.x << " " << entry.rect.y << " " << entry.rect.width << " " << entry.rect.height << " " << entry.name << "\n";
+        if (!table)
+        {
+            std::cerr << "Couldn't write " << path << ".txt" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // Reads back what save() wrote. More images can still be added around the ones loaded.
+    bool load(const std::string& path)
+    {
+        std::ifstream table(path + ".txt");
+        Image image;
+        if (!table || !readPng(path, image))
+        {
+            std::cerr << "Couldn't load the atlas " << path << std::endl;
+            return false;
+        }
+        std::string line, keyword;
+        bool started = false;
+        while (std::getline(table, line))
+        {
+            std::istringstream words(line);
+            if (!(words >> keyword) || keyword[0] == '#')
+                continue;
+            if (keyword == "atlas")
+            {
+                int tableSize = 0, tablePadding = 0;
+                words >> tableSize >> tablePadding;
+                if (tableSize != image.width || tableSize != image.height)
+                    break;
+                reset(tableSize, PackMethod::MaxRects, tablePadding);
+                pixels = std::move(image);
+                started = true;
+            }
+            else if (keyword == "image" && started)
+            {
+                AtlasRect rect;
+                std::string name;
+                words >> rect.x >> rect.y >> rect.width >> rect.height >> std::ws;
+                std::getline(words, name);
+                packer.reserve({ rect.x - padding, rect.y - padding, alignUp(rect.width + padding * 2), alignUp(rect.height + padding * 2) });
+                addEntry(name, rect);
+            }
+        }
+        if (!started)
+        {
+            std::cerr << path << ".txt doesn't match the atlas" << std::endl;
+            return false;
+        }
+        dirty = { 0, 0, size, size };
+        return true;
+    }
+
+    Image pixels;
+    GLTexture texture;
+    int size = 0;
+    int padding = 0;
+    int mipLevels = 1;
+    // Texels sent by upload() so far, including the first upload of the whole thing
+    size_t uploadedTexels = 0;
+
+private:
+    int alignUp(int value) const
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    int addEntry(const std::string& name, const AtlasRect& rect)
+    {
+        float scale = 1.0f / size;
+        entries.push_back({ name, rect, { rect.x * scale, rect.y * scale, (rect.x + rect.width) * scale, (rect.y + rect.height) * scale } });
+        names[name] = (int)entries.size() - 1;
+        imageArea += (size_t)rect.width * rect.height;
+        // Grows to cover the padding too
+        AtlasRect padded = { rect.x - padding, rect.y - padding, alignUp(rect.width + padding * 2), alignUp(rect.height + padding * 2) };
+        if (dirty.width == 0)
+            dirty = padded;
+        else
+        {
+            int right = std::max(dirty.x + dirty.width, padded.x + padded.width), top = std::max(dirty.y + dirty.height, padded.y + padded.height);
+            dirty.x = std::min(dirty.x, padded.x);
+            dirty.y = std::min(dirty.y, padded.y);
+            dirty.width = right - dirty.x;
+            dirty.height = top - dirty.y;
+        }
+        return (int)entries.size() - 1;
+    }
+
+    RectPacker packer;
+    int alignment = 1;
+    std::vector<AtlasEntry> entries;
+    std::unordered_map<std::string, int> names;
+    size_t imageArea = 0;
+    // What's changed since the last upload, empty (no width) if nothing
+    AtlasRect dirty;
+};
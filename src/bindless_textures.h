@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "gl_features.h"
+
+// Texture handles from GL_ARB_bindless_texture. A handle is a 64 bit number that a shader can
+// turn straight into a sampler, so instead of binding textures to units between draws their
+// handles go in a buffer (or a vertex attribute) and one draw can read as many different
+// textures as it likes.
+//
+//   if (bindless.load())
+//       handle = bindless.handle(texture, sampler);   // then sampler2D(handle) in the shader
+//
+// Once a texture has a handle its parameters (and the sampler's) can't change any more, and
+// it has to stay alive until release(). The extension isn't in glad's 3.3 core profile, so its
+// functions are looked up here, and it's only there on some desktop drivers. Use a TextureArray
+// when load() returns false.
+class BindlessTextures
+{
+public:
+    // Looks the functions up. Needs a context and glFeatures.detect() to have been called.
+    bool load()
+    {
+        if (!glFeatures.bindlessTextures)
+            return false;
+        getTextureHandle = (PFNGLGETTEXTUREHANDLEARBPROC)glfwGetProcAddress("glGetTextureHandleARB");
+        getTextureSamplerHandle = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC)glfwGetProcAddress("glGetTextureSamplerHandleARB");
+        makeResident = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)glfwGetProcAddress("glMakeTextureHandleResidentARB");
+        makeNonResident = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)glfwGetProcAddress("glMakeTextureHandleNonResidentARB");
+        loaded = getTextureHandle && getTextureSamplerHandle && makeResident && makeNonResident;
+        if (!loaded)
+            std::cerr << "GL_ARB_bindless_texture is listed but its functions are missing" << std::endl;
+        return loaded;
+    }
+
+    bool available() const
+    {
+        return loaded;
+    }
+
+    // A resident handle for texture, read with sampler's settings (or the texture's own with 0).
+    // Asking again for the same pair gives the same handle.
+    GLuint64 handle(GLuint texture, GLuint sampler = 0)
+    {
+        uint64_t key = (uint64_t)texture << 32 | sampler;
+        auto existing = handles.find(key);
+        if (existing != handles.end())
+            return existing->second;
+        GLuint64 handle = sampler ? getTextureSamplerHandle(texture, sampler) : getTextureHandle(texture);
+        if (!handle)
+        {
+            std::cerr << "Couldn't get a bindless handle for texture " << texture << std::endl;
+            return 0;
+        }
+        makeResident(handle);
+        handles[key] = handle;
+        return handle;
+    }
+
+    // Makes every handle non-resident. Do this before deleting the textures or samplers.
+    void release()
+    {
+        for (auto& entry : handles)
+            makeNonResident(entry.second);
+        handles.clear();
+    }
+
+    size_t residentCount() const
+    {
+        return handles.size();
+    }
+
+private:
+    typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC)(GLuint texture);
+    typedef GLuint64 (APIENTRYP PFNGLGETTEXTURESAMPLERHANDLEARBPROC)(GLuint texture, GLuint sampler);
+    typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)(GLuint64 handle);
+    typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)(GLuint64 handle);
+
+    bool loaded = false;
+    PFNGLGETTEXTUREHANDLEARBPROC getTextureHandle = nullptr;
+    PFNGLGETTEXTURESAMPLERHANDLEARBPROC getTextureSamplerHandle = nullptr;
+    PFNGLMAKETEXTUREHANDLERESIDENTARBPROC makeResident = nullptr;
+    PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC makeNonResident = nullptr;
+    // By texture in the top 32 bits and sampler in the bottom
+    std::unordered_map<uint64_t, GLuint64> handles;
+};
@@ -0,0 +1,550 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "culling.h"
+#include "job_system.h"
+#include "simd_math.h"
+
+// An axis aligned box given by its corners
+struct Aabb
+{
+    Vec3 min = { FLT_MAX, FLT_MAX, FLT_MAX };
+    Vec3 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    void grow(Vec3 point)
+    {
+        min = { std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z) };
+        max = { std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z) };
+    }
+
+    void grow(const Aabb& box)
+    {
+        min = { std::min(min.x, box.min.x), std::min(min.y, box.min.y), std::min(min.z, box.min.z) };
+        max = { std::max(max.x, box.max.x), std::max(max.y, box.max.y), std::max(max.z, box.max.z) };
+    }
+
+    // Half the surface area, which is all the SAH needs since it only compares areas
+    float halfArea() const
+    {
+        Vec3 size = max - min;
+        return size.x < 0.0f ? 0.0f : size.x * size.y + size.y * size.z + size.z * size.x;
+    }
+
+    bool overlaps(const Aabb& box) const
+    {
+        return min.x <= box.max.x && box.min.x <= max.x
+            && min.y <= box.max.y && box.min.y <= max.y
+            && min.z <= box.max.z && box.min.z <= max.z;
+    }
+};
+
+struct RayHit
+{
+    uint32_t item = UINT32_MAX;
+    float distance = FLT_MAX;
+};
+
+// A bounding volume hierarchy over the objects in a BoundsArray, for culling and picking when there
+// are too many objects to test one by one.
+//
+// build() makes the tree from scratch with binned SAH splits (the surface area heuristic: split
+// where the two halves' areas times their object counts comes out smallest). With a job system the
+// top few levels are split on the calling thread, binning the objects in parallel, and the subtrees
+// under them are then built in parallel.
+//
+// When objects move, refit() keeps the same tree and just grows or shrinks the boxes, which is much
+// cheaper but lets the tree get looser over time. update() refits, and rebuilds once the tree's SAH
+// cost has drifted too far from what it was built with.
+//
+// Nodes are stored so children always come after their parent, and each pair of children sits side
+// by side. Each subtree's objects are a contiguous run of items.
+class Bvh
+{
+public:
+    struct Node
+    {
+        Aabb box;
+        // Leaves: the first item and how many there are. Inner nodes: count is 0 and first is the
+        // left child, the right child is first + 1.
+        uint32_t first = 0;
+        uint32_t count = 0;
+    };
+
+    void build(const BoundsArray& bounds, JobSystem* jobs = nullptr)
+    {
+        uint32_t itemCount = (uint32_t)bounds.size();
+        nodes.clear();
+        items.resize(itemCount);
+        rebuildCount++;
+        if (itemCount == 0)
+            return;
+        nodes.emplace_back();
+
+        // Each object's box and centre packed together, so splitting doesn't jump around 7 arrays
+        buildItems.resize(itemCount);
+        for (uint32_t i = 0; i < itemCount; i++)
+            buildItems[i] = { itemBox(bounds, i), { bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i] }, i };
+
+        std::vector<Task> subtrees;
+        if (jobs && jobs->threadCount() > 1 && itemCount > PARALLEL_MIN_ITEMS)
+        {
+            // Split the top of the tree here until there are enough pieces to keep every thread busy
+            size_t subtreeItems = std::max<size_t>(itemCount / (jobs->threadCount() * 8), PARALLEL_MIN_ITEMS / 4);
+            std::vector<Task> open = { { 0, 0, itemCount } };
+            while (!open.empty())
+            {
+                Task task = open.back();
+                open.pop_back();
+                if (task.count <= subtreeItems)
+                {
+                    subtrees.push_back(task);
+                    continue;
+                }
+                uint32_t middle;
+                if (!splitNode(nodes, task.node, task.first, task.count, jobs, middle))
+                    continue;
+                uint32_t left = nodes[task.node].first;
+                open.push_back({ left, task.first, middle - task.first });
+                open.push_back({ left + 1, middle, task.first + task.count - middle });
+            }
+
+            std::vector<std::vector<Node>> built(subtrees.size());
+            jobs->parallelFor(subtrees.size(), 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    built[i].emplace_back();
+                    buildRecursive(built[i], 0, subtrees[i].first, subtrees[i].count);
+                }
+            });
+
+            // Stitch the subtrees in. Each one's root takes the place of its node, the rest go on the end.
+            for (size_t i = 0; i < subtrees.size(); i++)
+            {
+                uint32_t base = (uint32_t)nodes.size() - 1;
+                for (Node& node : built[i])
+                    if (node.count == 0)
+                        node.first += base;
+                nodes[subtrees[i].node] = built[i][0];
+                nodes.insert(nodes.end(), built[i].begin() + 1, built[i].end());
+            }
+        }
+        else
+        {
+            buildRecursive(nodes, 0, 0, itemCount);
+        }
+        for (uint32_t i = 0; i < itemCount; i++)
+            items[i] = buildItems[i].index;
+        buildItems.clear();
+        buildItems.shrink_to_fit();
+        builtCost = cost();
+    }
+
+    // Recomputes every box from the objects' current bounds, keeping the tree as it is
+    void refit(const BoundsArray& bounds, JobSystem* jobs = nullptr)
+    {
+        auto refitLeaves = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                if (nodes[i].count > 0)
+                    nodes[i].box = itemBounds(bounds, nodes[i].first, nodes[i].count);
+        };
+        if (jobs)
+            jobs->parallelFor(nodes.size(), REFIT_CHUNK, refitLeaves);
+        else
+            refitLeaves(0, nodes.size());
+
+        // Children come after their parents, so going backwards does every child before its parent
+        for (size_t i = nodes.size(); i-- > 0;)
+        {
+            Node& node = nodes[i];
+            if (node.count == 0)
+            {
+                node.box = nodes[node.first].box;
+                node.box.grow(nodes[node.first + 1].box);
+            }
+        }
+    }
+
+    // Refits, then rebuilds if that has made the tree noticeably worse than a fresh one would be
+    void update(const BoundsArray& bounds, JobSystem* jobs = nullptr)
+    {
+        if (items.size() != bounds.size())
+        {
+            build(bounds, jobs);
+            return;
+        }
+        refit(bounds, jobs);
+        if (cost() > builtCost * REBUILD_COST_RATIO)
+            build(bounds, jobs);
+    }
+
+    // The SAH cost of the whole tree, relative to the root. Lower is better.
+    float cost() const
+    {
+        if (nodes.empty() || nodes[0].box.halfArea() <= 0.0f)
+            return 0.0f;
+        float total = 0.0f;
+        for (const Node& node : nodes)
+            total += node.box.halfArea() * (node.count == 0 ? TRAVERSAL_COST : (float)node.count);
+        return total / nodes[0].box.halfArea();
+    }
+
+    // Appends every object whose box is at least partly inside the frustum. Gives the same objects as
+    // FrustumCuller with CullShape::Boxes, but not in the same order.
+    void queryFrustum(const Frustum& frustum, const BoundsArray& bounds, std::vector<uint32_t>& out) const
+    {
+        if (nodes.empty())
+            return;
+        // The top bit marks nodes already known to be completely inside
+        const uint32_t INSIDE = 0x80000000u;
+        std::vector<uint32_t> stack = { 0 };
+        while (!stack.empty())
+        {
+            uint32_t entry = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[entry & ~INSIDE];
+            bool inside = (entry & INSIDE) != 0;
+            if (!inside)
+            {
+                int test = testFrustum(frustum, node.box);
+                if (test < 0)
+                    continue;
+                inside = test > 0;
+            }
+            if (node.count == 0)
+            {
+                stack.push_back(node.first | (inside ? INSIDE : 0));
+                stack.push_back((node.first + 1) | (inside ? INSIDE : 0));
+            }
+            else
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; i++)
+                    if (inside || inFrustumScalar(frustum, bounds, items[i], CullShape::Boxes))
+                        out.push_back(items[i]);
+            }
+        }
+    }
+
+    // Appends every object whose box overlaps the given one
+    void queryOverlap(const Aabb& box, const BoundsArray& bounds, std::vector<uint32_t>& out) const
+    {
+        if (nodes.empty())
+            return;
+        std::vector<uint32_t> stack = { 0 };
+        while (!stack.empty())
+        {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+            if (!node.box.overlaps(box))
+                continue;
+            if (node.count == 0)
+            {
+                stack.push_back(node.first);
+                stack.push_back(node.first + 1);
+                continue;
+            }
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+                if (itemBox(bounds, items[i]).overlaps(box))
+                    out.push_back(items[i]);
+        }
+    }
+
+    // The nearest object box the ray hits within maxDistance, for picking. The direction doesn't need
+    // to be normalised, distances are in multiples of it.
+    bool raycast(Vec3 origin, Vec3 direction, float maxDistance, const BoundsArray& bounds, RayHit& hit) const
+    {
+        hit = RayHit();
+        hit.distance = maxDistance;
+        if (nodes.empty())
+            return false;
+        Vec3 inverse = { 1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z };
+        std::vector<uint32_t> stack = { 0 };
+        while (!stack.empty())
+        {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+            float entry;
+            if (!rayHitsBox(origin, inverse, node.box, hit.distance, entry))
+                continue;
+            if (node.count == 0)
+            {
+                // Visit the nearer child first so the far one is more likely to be skipped
+                float leftEntry, rightEntry;
+                bool left = rayHitsBox(origin, inverse, nodes[node.first].box, hit.distance, leftEntry);
+                bool right = rayHitsBox(origin, inverse, nodes[node.first + 1].box, hit.distance, rightEntry);
+                if (left && right)
+                {
+                    stack.push_back(leftEntry < rightEntry ? node.first + 1 : node.first);
+                    stack.push_back(leftEntry < rightEntry ? node.first : node.first + 1);
+                }
+                else if (left || right)
+                {
+                    stack.push_back(left ? node.first : node.first + 1);
+                }
+                continue;
+            }
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                if (rayHitsBox(origin, inverse, itemBox(bounds, items[i]), hit.distance, entry) && entry < hit.distance)
+                {
+                    hit.item = items[i];
+                    hit.distance = entry;
+                }
+            }
+        }
+        return hit.item != UINT32_MAX;
+    }
+
+    size_t nodeCount() const
+    {
+        return nodes.size();
+    }
+
+    // How many times build() has run, including the ones update() decided on
+    size_t rebuildCount = 0;
+
+    static Aabb itemBox(const BoundsArray& bounds, uint32_t i)
+    {
+        Aabb box;
+        box.min = { bounds.centerX[i] - bounds.extentX[i], bounds.centerY[i] - bounds.extentY[i], bounds.centerZ[i] - bounds.extentZ[i] };
+        box.max = { bounds.centerX[i] + bounds.extentX[i], bounds.centerY[i] + bounds.extentY[i], bounds.centerZ[i] + bounds.extentZ[i] };
+        return box;
+    }
+
+    // Slab test. entry is where the ray goes into the box (0 if it starts inside).
+    static bool rayHitsBox(Vec3 origin, Vec3 inverse, const Aabb& box, float maxDistance, float& entry)
+    {
+        float x0 = (box.min.x - origin.x) * inverse.x, x1 = (box.max.x - origin.x) * inverse.x;
+        float y0 = (box.min.y - origin.y) * inverse.y, y1 = (box.max.y - origin.y) * inverse.y;
+        float z0 = (box.min.z - origin.z) * inverse.z, z1 = (box.max.z - origin.z) * inverse.z;
+        float enter = std::max({ std::min(x0, x1), std::min(y0, y1), std::min(z0, z1), 0.0f });
+        float exit = std::min({ std::max(x0, x1), std::max(y0, y1), std::max(z0, z1), maxDistance });
+        entry = enter;
+        return enter <= exit;
+    }
+
+private:
+    static constexpr int BIN_COUNT = 16;
+    // Nodes this small are always leaves, up to MAX_LEAF_ITEMS can be if the SAH says so
+    static constexpr uint32_t MIN_SPLIT_ITEMS = 5;
+    static constexpr uint32_t MAX_LEAF_ITEMS = 8;
+    // How much visiting a node costs compared to testing one object
+    static constexpr float TRAVERSAL_COST = 2.0f;
+    static constexpr float REBUILD_COST_RATIO = 1.5f;
+    // Below this, building in parallel isn't worth it
+    static constexpr uint32_t PARALLEL_MIN_ITEMS = 65536;
+    static constexpr size_t REFIT_CHUNK = 4096;
+
+    struct Task
+    {
+        uint32_t node;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    struct BuildItem
+    {
+        Aabb box;
+        Vec3 centre;
+        uint32_t index;
+    };
+
+    struct Bin
+    {
+        Aabb box;
+        uint32_t count = 0;
+    };
+
+    struct Binning
+    {
+        Bin bins[BIN_COUNT];
+
+        void merge(const Binning& other)
+        {
+            for (int b = 0; b < BIN_COUNT; b++)
+            {
+                bins[b].box.grow(other.bins[b].box);
+                bins[b].count += other.bins[b].count;
+            }
+        }
+    };
+
+    Aabb itemBounds(const BoundsArray& bounds, uint32_t first, uint32_t count) const
+    {
+        Aabb box;
+        for (uint32_t i = first; i < first + count; i++)
+            box.grow(itemBox(bounds, items[i]));
+        return box;
+    }
+
+    static float axisOf(Vec3 v, int axis)
+    {
+        return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+    }
+
+    static int binIndex(float value, float low, float scale)
+    {
+        return std::min(BIN_COUNT - 1, std::max(0, (int)((value - low) * scale)));
+    }
+
+    // Sets the node's box, then either makes it a leaf (returning false) or adds its two children and
+    // partitions its items between them, returning where the right child's items start.
+    bool splitNode(std::vector<Node>& out, uint32_t nodeIndex, uint32_t first, uint32_t count, JobSystem* jobs, uint32_t& middle)
+    {
+        // Bounds of the node and of the objects' centres
+        Aabb box, centres;
+        auto measure = [&](size_t begin, size_t end, Aabb& nodeBox, Aabb& centreBox) {
+            for (size_t i = begin; i < end; i++)
+            {
+                const BuildItem& item = buildItems[first + i];
+                nodeBox.grow(item.box);
+                centreBox.grow(item.centre);
+            }
+        };
+        bool parallel = jobs && count > PARALLEL_MIN_ITEMS;
+        size_t chunkSize = parallel ? (count + jobs->threadCount() * 4 - 1) / (jobs->threadCount() * 4) : count;
+        size_t chunks = (count + chunkSize - 1) / chunkSize;
+        if (parallel)
+        {
+            std::vector<Aabb> boxes(chunks), centreBoxes(chunks);
+            jobs->parallelFor(count, chunkSize, [&](size_t begin, size_t end) {
+                measure(begin, end, boxes[begin / chunkSize], centreBoxes[begin / chunkSize]);
+            });
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+            {
+                box.grow(boxes[chunk]);
+                centres.grow(centreBoxes[chunk]);
+            }
+        }
+        else
+        {
+            measure(0, count, box, centres);
+        }
+        out[nodeIndex].box = box;
+        out[nodeIndex].first = first;
+        out[nodeIndex].count = count;
+        if (count < MIN_SPLIT_ITEMS)
+            return false;
+
+        // Drop every object's centre into a bin along the axis the centres are most spread out on
+        Vec3 size = centres.max - centres.min;
+        int axis = size.x >= size.y && size.x >= size.z ? 0 : size.y >= size.z ? 1 : 2;
+        float low = axisOf(centres.min, axis);
+        float scale = axisOf(size, axis) > 0.0f ? BIN_COUNT / axisOf(size, axis) : 0.0f;
+        auto bin = [&](size_t begin, size_t end, Binning& binning) {
+            for (size_t i = begin; i < end; i++)
+            {
+                const BuildItem& item = buildItems[first + i];
+                Bin& target = binning.bins[binIndex(axisOf(item.centre, axis), low, scale)];
+                target.box.grow(item.box);
+                target.count++;
+            }
+        };
+        Binning binning;
+        if (parallel)
+        {
+            std::vector<Binning> chunkBinnings(chunks);
+            jobs->parallelFor(count, chunkSize, [&](size_t begin, size_t end) { bin(begin, end, chunkBinnings[begin / chunkSize]); });
+            for (const Binning& chunkBinning : chunkBinnings)
+                binning.merge(chunkBinning);
+        }
+        else
+        {
+            bin(0, count, binning);
+        }
+
+        // Try a split between every pair of bins
+        float bestCost = FLT_MAX;
+        int bestSplit = 0;
+        if (scale > 0.0f)
+        {
+            const Bin* bins = binning.bins;
+            float rightCost[BIN_COUNT];
+            Aabb right;
+            uint32_t rightCount = 0;
+            for (int b = BIN_COUNT - 1; b > 0; b--)
+            {
+                right.grow(bins[b].box);
+                rightCount += bins[b].count;
+                rightCost[b] = right.halfArea() * rightCount;
+            }
+            Aabb left;
+            uint32_t leftCount = 0;
+            for (int b = 0; b < BIN_COUNT - 1; b++)
+            {
+                left.grow(bins[b].box);
+                leftCount += bins[b].count;
+                float splitCost = left.halfArea() * leftCount + rightCost[b + 1];
+                if (leftCount > 0 && leftCount < count && splitCost < bestCost)
+                {
+                    bestCost = splitCost;
+                    bestSplit = b + 1;
+                }
+            }
+        }
+
+        float leafCost = box.halfArea() * count;
+        float splitCost = box.halfArea() * TRAVERSAL_COST + bestCost;
+        if (count <= MAX_LEAF_ITEMS && leafCost <= splitCost)
+            return false;
+
+        BuildItem* begin = buildItems.data() + first;
+        BuildItem* end = begin + count;
+        if (bestSplit > 0)
+        {
+            middle = first + (uint32_t)(std::partition(begin, end, [&](const BuildItem& item) {
+                return binIndex(axisOf(item.centre, axis), low, scale) < bestSplit;
+            }) - begin);
+        }
+        else
+        {
+            // Every centre is in the same place, so any split is as good as another
+            if (count <= MAX_LEAF_ITEMS)
+                return false;
+            middle = first + count / 2;
+        }
+
+        uint32_t left = (uint32_t)out.size();
+        out.resize(out.size() + 2);
+        out[nodeIndex].first = left;
+        out[nodeIndex].count = 0;
+        return true;
+    }
+
+    void buildRecursive(std::vector<Node>& out, uint32_t nodeIndex, uint32_t first, uint32_t count)
+    {
+        uint32_t middle;
+        if (!splitNode(out, nodeIndex, first, count, nullptr, middle))
+            return;
+        uint32_t left = out[nodeIndex].first;
+        buildRecursive(out, left, first, middle - first);
+        buildRecursive(out, left + 1, middle, first + count - middle);
+    }
+
+    // -1 outside, 0 crossing a plane, 1 completely inside
+    static int testFrustum(const Frustum& frustum, const Aabb& box)
+    {
+        Vec3 center = (box.min + box.max) * 0.5f;
+        Vec3 extent = (box.max - box.min) * 0.5f;
+        int result = 1;
+        for (const Vec4& plane : frustum.planes)
+        {
+            float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            float reach = fabsf(plane.x) * extent.x + fabsf(plane.y) * extent.y + fabsf(plane.z) * extent.z;
+            if (distance + reach < 0.0f)
+                return -1;
+            if (distance - reach < 0.0f)
+                result = 0;
+        }
+        return result;
+    }
+
+    std::vector<Node> nodes;
+    // Object indices, arranged so every leaf's objects are next to each other
+    std::vector<uint32_t> items;
+    // Only used while building
+    std::vector<BuildItem> buildItems;
+    float builtCost = 0.0f;
+};
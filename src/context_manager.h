@@ -0,0 +1,222 @@
+#pragma once
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// More than one window (or hidden, headless context) from one process, sharing GL objects. Every
+// context made here shares with the oldest one still around, so programs, buffers, textures, samplers and sync
+// objects made in any of them can be used in all of them, and only take up memory once.
+//
+// Container objects aren't shared though: a VAO or framebuffer object only exists in the context
+// it was made in. vertexArray() and framebuffer() give each context its own, made the first time
+// that context asks for it, and deleted along with the context.
+//
+// A context can only be current on one thread at a time, so makeCurrent() keeps track of which
+// thread has each one and refuses to take a context another thread is still using. For rendering
+// in parallel, give each thread its own headless context and release() it when done.
+//
+// Things shared between contexts aren't synchronised between them. After changing something in one
+// context, put a fence in with glFenceSync (and flush), and glWaitSync on it in the other before
+// using it.
+class ContextManager
+{
+public:
+    ContextManager() = default;
+    ContextManager(const ContextManager&) = delete;
+    ContextManager& operator=(const ContextManager&) = delete;
+
+    // Uses the current window hints, so set those up (version, profile, depth bits etc) first.
+    // Shared objects live as long as any context in the group does, so it doesn't matter which one
+    // the new context is made sharing with.
+    GLFWwindow* createWindow(int width, int height, const char* title, bool visible = true)
+    {
+        glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+        GLFWwindow* shareWith = NULL;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!contexts.empty())
+                shareWith = contexts.front()->window;
+        }
+        GLFWwindow* window = glfwCreateWindow(width, height, title, NULL, shareWith);
+        if (window == NULL)
+        {
+            std::cerr << "Failed to create " << (visible ? "window " : "headless context ") << title << std::endl;
+            return NULL;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        contexts.push_back(std::make_unique<Context>());
+        contexts.back()->window = window;
+        return window;
+    }
+
+    // A context with nothing to show, for rendering into framebuffer objects. GLFW still needs a
+    // window for it, it's just tiny and never shown.
+    GLFWwindow* createHeadless(const char* name = "Headless")
+    {
+        return createWindow(1, 1, name, false);
+    }
+
+    // Deletes the context's own VAOs and framebuffers, then the context. Has to make it current to
+    // do that, so afterwards whatever was current on this thread before is made current again
+    // (nothing, if it was this one). Fails if another thread has it.
+    bool destroy(GLFWwindow* window)
+    {
+        Context* context = find(window);
+        if (!context)
+            return false;
+        Context* previous = current;
+        if (!makeCurrent(window))
+            return false;
+        for (auto& entry : context->vertexArrays)
+            glDeleteVertexArrays(1, &entry.second);
+        for (auto& entry : context->framebuffers)
+            glDeleteFramebuffers(1, &entry.second);
+        release();
+        glfwDestroyWindow(window);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < contexts.size(); i++)
+            {
+                if (contexts[i].get() == context)
+                {
+                    contexts.erase(contexts.begin() + i);
+                    break;
+                }
+            }
+        }
+        if (previous && previous != context)
+            makeCurrent(previous->window);
+        return true;
+    }
+
+    // Newest first. Any that can't be destroyed (current on another thread) are reported and left.
+    void destroyAll()
+    {
+        std::vector<GLFWwindow*> windows;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& context : contexts)
+                windows.push_back(context->window);
+        }
+        size_t left = 0;
+        for (size_t i = windows.size(); i-- > 0;)
+            left += !destroy(windows[i]);
+        if (left)
+            std::cerr << "Left " << left << " contexts that couldn't be destroyed" << std::endl;
+    }
+
+    // Makes the window's context current on this thread. Fails if another thread has it.
+    bool makeCurrent(GLFWwindow* window)
+    {
+        Context* context = find(window);
+        if (!context)
+            return false;
+        if (current == context)
+            return true;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (context->owned && context->owner != std::this_thread::get_id())
+            {
+                std::cerr << "Context is already current on another thread" << std::endl;
+                return false;
+            }
+            if (current)
+                current->owned = false;
+            context->owner = std::this_thread::get_id();
+            context->owned = true;
+        }
+        glfwMakeContextCurrent(window);
+        current = context;
+        return true;
+    }
+
+    // Lets go of this thread's context so another thread can take it
+    void release()
+    {
+        if (!current)
+            return;
+        glfwMakeContextCurrent(NULL);
+        std::lock_guard<std::mutex> lock(mutex);
+        current->owned = false;
+        current = nullptr;
+    }
+
+    // The window whose context is current on this thread (from makeCurrent)
+    static GLFWwindow* currentWindow()
+    {
+        return current ? current->window : NULL;
+    }
+
+    // The next two need a context from makeCurrent().
+    //
+    // This context's VAO for key (usually the address of whatever owns the buffers), made the first
+    // time. setup is called with it bound to attach buffers and describe the vertices, the same as
+    // it would be for a VAO in just one context.
+    GLuint vertexArray(const void* key, const std::function<void()>& setup)
+    {
+        GLuint& vao = current->vertexArrays[key];
+        if (!vao)
+        {
+            glGenVertexArrays(1, &vao);
+            glBindVertexArray(vao);
+            setup();
+            glBindVertexArray(0);
+        }
+        return vao;
+    }
+
+    // This context's framebuffer object for key, made (empty) the first time. The textures it
+    // draws into can be shared, attach them after binding it.
+    GLuint framebuffer(const void* key)
+    {
+        GLuint& fbo = current->framebuffers[key];
+        if (!fbo)
+            glGenFramebuffers(1, &fbo);
+        return fbo;
+    }
+
+    size_t contextCount() const
+    {
+        return contexts.size();
+    }
+
+    // How many VAOs and framebuffers have been made per context, since they can't be shared
+    size_t containerCount() const
+    {
+        size_t count = 0;
+        for (const auto& context : contexts)
+            count += context->vertexArrays.size() + context->framebuffers.size();
+        return count;
+    }
+
+private:
+    struct Context
+    {
+        GLFWwindow* window = NULL;
+        // Which thread it's current on, if any
+        std::thread::id owner;
+        bool owned = false;
+        std::map<const void*, GLuint> vertexArrays;
+        std::map<const void*, GLuint> framebuffers;
+    };
+
+    Context* find(GLFWwindow* window)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& context : contexts)
+            if (context->window == window)
+                return context.get();
+        return nullptr;
+    }
+
+    // Each context's record stays put when others come and go, so threads can hold on to them
+    std::vector<std::unique_ptr<Context>> contexts;
+    std::mutex mutex;
+    static inline thread_local Context* current = nullptr;
+};
@@ -0,0 +1,259 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include "job_system.h"
+#include "simd_math.h"
+
+// Frustum culling: which objects could be on screen at all.
+//
+// Every object has a bounding box (centre and half size) and a bounding sphere around that box, kept
+// in separate arrays per component so the test can load 4 (SSE/NEON) or 8 (AVX) objects at once and
+// check them against each of the 6 frustum planes together. Spheres are the cheaper test, boxes
+// throw away more. The result is a compact list of visible object indices, in the same order as the
+// objects, for the draw loop to walk.
+struct BoundsArray
+{
+    std::vector<float> centerX, centerY, centerZ;
+    // Half the size of the box along each axis
+    std::vector<float> extentX, extentY, extentZ;
+    std::vector<float> radius;
+
+    size_t size() const
+    {
+        return centerX.size();
+    }
+
+    void resize(size_t count)
+    {
+        centerX.resize(count); centerY.resize(count); centerZ.resize(count);
+        extentX.resize(count); extentY.resize(count); extentZ.resize(count);
+        radius.resize(count);
+    }
+
+    void set(size_t i, Vec3 center, Vec3 extent)
+    {
+        centerX[i] = center.x; centerY[i] = center.y; centerZ[i] = center.z;
+        extentX[i] = extent.x; extentY[i] = extent.y; extentZ[i] = extent.z;
+        radius[i] = length(extent);
+    }
+
+    uint32_t add(Vec3 center, Vec3 extent)
+    {
+        resize(size() + 1);
+        set(size() - 1, center, extent);
+        return (uint32_t)size() - 1;
+    }
+};
+
+// The 6 planes of a view frustum, pointing inwards. A point p is inside a plane when
+// a * p.x + b * p.y + c * p.z + d >= 0.
+struct Frustum
+{
+    Vec4 planes[6];
+
+    // Pulls the planes out of a projection * view matrix (Gribb & Hartmann). Pass just a projection to
+    // get them in view space, or the identity for GL's -1 to 1 clip cube.
+    static Frustum fromMatrix(const Mat4& m)
+    {
+        Vec4 rows[4] = {
+            { m.columns[0].x, m.columns[1].x, m.columns[2].x, m.columns[3].x },
+            { m.columns[0].y, m.columns[1].y, m.columns[2].y, m.columns[3].y },
+            { m.columns[0].z, m.columns[1].z, m.columns[2].z, m.columns[3].z },
+            { m.columns[0].w, m.columns[1].w, m.columns[2].w, m.columns[3].w },
+        };
+        Frustum frustum;
+        frustum.planes[0] = rows[3] + rows[0]; // Left
+        frustum.planes[1] = rows[3] - rows[0]; // Right
+        frustum.planes[2] = rows[3] + rows[1]; // Bottom
+        frustum.planes[3] = rows[3] - rows[1]; // Top
+        frustum.planes[4] = rows[3] + rows[2]; // Near
+        frustum.planes[5] = rows[3] - rows[2]; // Far
+        // Normalised so the distances mean something, the box test relies on it
+        for (Vec4& plane : frustum.planes)
+            plane = plane * (1.0f / sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z));
+        return frustum;
+    }
+};
+
+enum class CullShape
+{
+    Spheres,
+    Boxes,
+};
+
+struct CullStats
+{
+    size_t tested = 0;
+    size_t visible = 0;
+    double ms = 0.0;
+
+    size_t culled() const
+    {
+        return tested - visible;
+    }
+};
+
+// Is the object on the inside of every plane? One object at a time, for the leftovers after the SIMD
+// loop and for comparing against.
+inline bool inFrustumScalar(const Frustum& frustum, const BoundsArray& bounds, size_t i, CullShape shape)
+{
+    for (const Vec4& plane : frustum.planes)
+    {
+        // Same order of operations as the SIMD loops, so both agree on objects right at the edge
+        float distance = (plane.x * bounds.centerX[i] + plane.y * bounds.centerY[i]) + (plane.z * bounds.centerZ[i] + plane.w);
+        float reach = shape == CullShape::Spheres ? bounds.radius[i]
+            : (fabsf(plane.x) * bounds.extentX[i] + fabsf(plane.y) * bounds.extentY[i]) + fabsf(plane.z) * bounds.extentZ[i];
+        if (distance + reach < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+inline void cullRangeScalar(const Frustum& frustum, const BoundsArray& bounds, CullShape shape, size_t begin, size_t end, std::vector<uint32_t>& visible)
+{
+    for (size_t i = begin; i < end; i++)
+        if (inFrustumScalar(frustum, bounds, i, shape))
+            visible.push_back((uint32_t)i);
+}
+
+// Index of the lowest set bit, for walking the lanes of a movemask
+inline unsigned lowestBit(unsigned mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctz(mask);
+#endif
+}
+
+// Appends the visible objects in [begin, end) to the list
+inline void cullRange(const Frustum& frustum, const BoundsArray& bounds, CullShape shape, size_t begin, size_t end, std::vector<uint32_t>& visible)
+{
+    size_t i = begin;
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    const bool boxes = shape == CullShape::Boxes;
+#endif
+#if defined(MATH_AVX)
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 cx = _mm256_loadu_ps(&bounds.centerX[i]), cy = _mm256_loadu_ps(&bounds.centerY[i]), cz = _mm256_loadu_ps(&bounds.centerZ[i]);
+        __m256 ex = boxes ? _mm256_loadu_ps(&bounds.extentX[i]) : _mm256_setzero_ps();
+        __m256 ey = boxes ? _mm256_loadu_ps(&bounds.extentY[i]) : _mm256_setzero_ps();
+        __m256 ez = boxes ? _mm256_loadu_ps(&bounds.extentZ[i]) : _mm256_setzero_ps();
+        __m256 r = boxes ? _mm256_setzero_ps() : _mm256_loadu_ps(&bounds.radius[i]);
+        __m256 outside = _mm256_setzero_ps();
+        for (const Vec4& plane : frustum.planes)
+        {
+            __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.x), cx), _mm256_mul_ps(_mm256_set1_ps(plane.y), cy)),
+                                            _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.z), cz), _mm256_set1_ps(plane.w)));
+            __m256 reach = boxes
+                ? _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(fabsf(plane.x)), ex), _mm256_mul_ps(_mm256_set1_ps(fabsf(plane.y)), ey)),
+                                _mm256_mul_ps(_mm256_set1_ps(fabsf(plane.z)), ez))
+                : r;
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), _mm256_setzero_ps(), _CMP_LT_OQ));
+        }
+        for (unsigned mask = ~(unsigned)_mm256_movemask_ps(outside) & 0xFF; mask; mask &= mask - 1)
+            visible.push_back((uint32_t)(i + lowestBit(mask)));
+    }
+#endif
+#if defined(MATH_SSE)
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 cx = _mm_loadu_ps(&bounds.centerX[i]), cy = _mm_loadu_ps(&bounds.centerY[i]), cz = _mm_loadu_ps(&bounds.centerZ[i]);
+        __m128 ex = boxes ? _mm_loadu_ps(&bounds.extentX[i]) : _mm_setzero_ps();
+        __m128 ey = boxes ? _mm_loadu_ps(&bounds.extentY[i]) : _mm_setzero_ps();
+        __m128 ez = boxes ? _mm_loadu_ps(&bounds.extentZ[i]) : _mm_setzero_ps();
+        __m128 r = boxes ? _mm_setzero_ps() : _mm_loadu_ps(&bounds.radius[i]);
+        __m128 outside = _mm_setzero_ps();
+        for (const Vec4& plane : frustum.planes)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), cx), _mm_mul_ps(_mm_set1_ps(plane.y), cy)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), cz), _mm_set1_ps(plane.w)));
+            __m128 reach = boxes
+                ? _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(fabsf(plane.x)), ex), _mm_mul_ps(_mm_set1_ps(fabsf(plane.y)), ey)),
+                             _mm_mul_ps(_mm_set1_ps(fabsf(plane.z)), ez))
+                : r;
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, reach), _mm_setzero_ps()));
+        }
+        for (unsigned mask = ~(unsigned)_mm_movemask_ps(outside) & 0xF; mask; mask &= mask - 1)
+            visible.push_back((uint32_t)(i + lowestBit(mask)));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= end; i += 4)
+    {
+        float32x4_t cx = vld1q_f32(&bounds.centerX[i]), cy = vld1q_f32(&bounds.centerY[i]), cz = vld1q_f32(&bounds.centerZ[i]);
+        float32x4_t ex = boxes ? vld1q_f32(&bounds.extentX[i]) : vdupq_n_f32(0.0f);
+        float32x4_t ey = boxes ? vld1q_f32(&bounds.extentY[i]) : vdupq_n_f32(0.0f);
+        float32x4_t ez = boxes ? vld1q_f32(&bounds.extentZ[i]) : vdupq_n_f32(0.0f);
+        float32x4_t r = boxes ? vdupq_n_f32(0.0f) : vld1q_f32(&bounds.radius[i]);
+        uint32x4_t outside = vdupq_n_u32(0);
+        for (const Vec4& plane : frustum.planes)
+        {
+            float32x4_t distance = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(plane.w), cx, plane.x), cy, plane.y), cz, plane.z);
+            float32x4_t reach = boxes ? vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(ex, fabsf(plane.x)), ey, fabsf(plane.y)), ez, fabsf(plane.z)) : r;
+            outside = vorrq_u32(outside, vcltq_f32(vaddq_f32(distance, reach), vdupq_n_f32(0.0f)));
+        }
+        uint32_t lanes[4];
+        vst1q_u32(lanes, outside);
+        for (int lane = 0; lane < 4; lane++)
+            if (!lanes[lane])
+                visible.push_back((uint32_t)(i + lane));
+    }
+#endif
+    cullRangeScalar(frustum, bounds, shape, i, end, visible);
+}
+
+// Culls every object, spread over the job system if there is one, and keeps stats on how it went
+class FrustumCuller
+{
+public:
+    void cull(const Frustum& frustum, const BoundsArray& bounds, CullShape shape, std::vector<uint32_t>& visible, JobSystem* jobs = nullptr)
+    {
+        auto start = std::chrono::steady_clock::now();
+        visible.clear();
+        size_t count = bounds.size();
+        if (!jobs || count <= CULL_CHUNK)
+        {
+            cullRange(frustum, bounds, shape, 0, count, visible);
+        }
+        else
+        {
+            // Each chunk gets its own list, then they're joined up in order
+            size_t chunks = (count + CULL_CHUNK - 1) / CULL_CHUNK;
+            if (chunkResults.size() < chunks)
+                chunkResults.resize(chunks);
+            jobs->parallelFor(count, CULL_CHUNK, [&](size_t begin, size_t end) {
+                std::vector<uint32_t>& result = chunkResults[begin / CULL_CHUNK];
+                result.clear();
+                cullRange(frustum, bounds, shape, begin, end, result);
+            });
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+                visible.insert(visible.end(), chunkResults[chunk].begin(), chunkResults[chunk].end());
+        }
+        stats.tested = count;
+        stats.visible = visible.size();
+        stats.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        totals.tested += stats.tested;
+        totals.visible += stats.visible;
+        totals.ms += stats.ms;
+        frames++;
+    }
+
+    // The last cull, and everything added up since the start
+    CullStats stats;
+    CullStats totals;
+    size_t frames = 0;
+
+private:
+    // A multiple of 8 so only the very last chunk has leftovers for the scalar loop
+    static constexpr size_t CULL_CHUNK = 8192;
+
+    std::vector<std::vector<uint32_t>> chunkResults;
+};
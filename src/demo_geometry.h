@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include "simd_math.h"
+
+// Vertex data for the simple demos, kept here so the software rasteriser can draw exactly the same
+// thing as GL does (see tools/bench_raster).
+
+// Each row is the coordinate for a corner of the triangle followed by its colour
+const float RGB_TRIANGLE_VERTICES[] = {
+    // Positions            //  Colours
+    -0.5f, -0.5f, 0.0f,     1.0f, 0.0f, 0.0f,   // Bottom Left
+     0.5f, -0.5f, 0.0f,     0.0f, 1.0f, 0.0f,   // Bottom Right
+     0.0f,  0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   // Top Centre
+};
+const int RGB_TRIANGLE_FLOATS_PER_VERTEX = 6;
+const int RGB_TRIANGLE_COLOUR_OFFSET = 3;
+
+const float HELLO_RECTANGLE_VERTICES[] = {
+     0.5f,  0.5f, 0.0f,    // Top Right
+     0.5f, -0.5f, 0.0f, // Bottom Right
+    -0.5f, -0.5f, 0.0f, // Bottom Left
+    -0.5f,  0.5f, 0.0f  // Top Left
+};
+
+const uint32_t HELLO_RECTANGLE_INDICES[] = {
+    0, 1, 3,// Top Right Triangle
+    1, 2, 3 // Bottom Left Triangle
+};
+//I noticed this uses clockwise, maybe should make it anti-clockwise?
+
+// ORANGE from colours.glsl, what basic.frag draws with no colour feature
+constexpr Vec4 CONSTANT_ORANGE = { 1.0f, 0.5f, 0.2f, 1.0f };
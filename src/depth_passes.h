@@ -0,0 +1,153 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+
+// Keeping the fragment shader from running on pixels that end up hidden.
+//
+// With the depth test on, a fragment behind something already drawn is thrown away before it's
+// shaded (as long as the shader doesn't write gl_FragDepth or discard). That only helps if the
+// thing in front was drawn first, so opaque draws are sorted nearest first. A depth prepass goes
+// further: draw everything once with colour writes off and a shader that does nothing, then draw
+// again with the real shader and the depth test set so only the nearest surface at each pixel
+// passes. Every pixel is then shaded exactly once, at the cost of running the vertex work twice.
+
+struct DepthSettings
+{
+    bool prepass = false;
+    bool frontToBack = true;
+    // Add up fragments with blending instead of shading them, see OVERDRAW in basic.frag
+    bool overdraw = false;
+};
+
+// One opaque draw to be sorted. depth is the nearest point of the object, smaller is closer.
+struct OpaqueDraw
+{
+    float depth;
+    uint32_t object;
+};
+
+// Any vector of them, e.g. a FrameVector
+template <typename Draws>
+void sortFrontToBack(Draws& draws)
+{
+    std::sort(draws.begin(), draws.end(), [](const OpaqueDraw& a, const OpaqueDraw& b) { return a.depth < b.depth; });
+}
+
+// Counts the fragments that pass the depth test between begin() and end() with GL_SAMPLES_PASSED,
+// which with early depth testing is the number the fragment shader ran for. The result is read a
+// couple of frames later so asking for it never waits on the GPU. If the GPU is so far behind that
+// the query about to be reused still hasn't finished, that frame isn't counted (see skipped)
+// rather than throwing the older result away, so the averages stay over every frame counted.
+class FragmentCounter
+{
+public:
+    void begin()
+    {
+        if (!queries[0])
+            glGenQueries(QUERY_COUNT, queries);
+        counting = collect(next);
+        if (!counting)
+        {
+            skipped++;
+            return;
+        }
+        glBeginQuery(GL_SAMPLES_PASSED, queries[next]);
+    }
+
+    void end()
+    {
+        if (!counting)
+            return;
+        glEndQuery(GL_SAMPLES_PASSED);
+        pending[next] = true;
+        next = (next + 1) % QUERY_COUNT;
+        // The oldest query, which has usually finished by now
+        collect(next);
+    }
+
+    void destroy()
+    {
+        if (queries[0])
+            glDeleteQueries(QUERY_COUNT, queries);
+        queries[0] = 0;
+        std::fill(pending, pending + QUERY_COUNT, false);
+        next = 0;
+    }
+
+    // Averages since the last reset(), for comparing settings
+    void reset()
+    {
+        totalFragments = 0;
+        frames = 0;
+        skipped = 0;
+    }
+
+    uint64_t lastFragments = 0;
+    uint64_t totalFragments = 0;
+    uint64_t frames = 0;
+    // Frames that weren't counted because every query was still waiting on the GPU
+    uint64_t skipped = 0;
+
+private:
+    // Adds up the slot's result if it has one waiting. Returns false if it's still in flight.
+    bool collect(int slot)
+    {
+        if (!pending[slot])
+            return true;
+        GLint available = 0;
+        glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            return false;
+        GLuint64 samples = 0;
+        glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &samples);
+        pending[slot] = false;
+        lastFragments = samples;
+        totalFragments += samples;
+        frames++;
+        return true;
+    }
+
+    static constexpr int QUERY_COUNT = 3;
+    GLuint queries[QUERY_COUNT] = {};
+    bool pending[QUERY_COUNT] = {};
+    int next = 0;
+    bool counting = false;
+};
+
+// Draws the opaque objects with the given settings. drawAll(program) should draw every object in
+// the order it wants using that program. The fragment counter (if any) only covers the shading pass.
+// Expects the depth buffer to have been cleared, and leaves depth writes on and the test at LEQUAL.
+template <typename DrawAll>
+void drawOpaque(const DepthSettings& settings, GLuint colourProgram, GLuint depthProgram, GLuint overdrawProgram, DrawAll drawAll, FragmentCounter* counter = nullptr)
+{
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
+    if (settings.prepass)
+    {
+        GL_DEBUG_GROUP("Depth prepass");
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDepthMask(GL_TRUE);
+        drawAll(depthProgram);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        // The depth is already final, only the nearest surface can match it
+        glDepthMask(GL_FALSE);
+    }
+
+    GL_DEBUG_GROUP("Opaque");
+    if (settings.overdraw)
+    {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE);
+    }
+    if (counter)
+        counter->begin();
+    drawAll(settings.overdraw ? overdrawProgram : colourProgram);
+    if (counter)
+        counter->end();
+    if (settings.overdraw)
+        glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+}
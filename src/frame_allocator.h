@@ -0,0 +1,323 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Memory for things that only live for one frame (draw lists, culled lists, command buffers),
+// handed out by bumping a pointer along a block and all given back at once at the end of the frame.
+// There's nothing to free one at a time, and nothing is destructed, so only put things in here
+// that don't need it.
+//
+// When a frame needs more than the block has, another block is allocated for the rest of it. At
+// reset() those are swapped for one block big enough for the whole frame, so once it's seen the
+// biggest frame it never allocates again.
+//
+// Each thread has its own (FrameArena::local()), so job system workers can use theirs without
+// locking. FrameArena::resetAll() resets every thread's at once, call it at the end of the frame
+// while nothing else is running.
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t blockSize = 64 * 1024) : blockSize(blockSize) {}
+
+    ~FrameArena()
+    {
+        for (Block& block : blocks)
+            ::operator delete(block.memory);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        if (!blocks.empty())
+            if (void* memory = take(blocks.back(), bytes, alignment))
+                return memory;
+        // Doesn't fit, carry on in a new block. It has room for the worst case of lining it up.
+        if (!blocks.empty())
+            overflows++;
+        blocks.push_back(newBlock(std::max(blockSize, alignment + bytes)));
+        return take(blocks.back(), bytes, alignment);
+    }
+
+    // Room for count Ts, left uninitialised
+    template <typename T>
+    T* allocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Nothing in a FrameArena gets destructed");
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T, typename... Args>
+    T* make(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Nothing in a FrameArena gets destructed");
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Everything handed out since the last reset is gone after this
+    void reset()
+    {
+        peak = std::max(peak, used);
+        // Swap the extra blocks for one that would have fitted the whole frame
+        if (blocks.size() > 1)
+        {
+            size_t total = 0;
+            for (Block& block : blocks)
+            {
+                total += block.size;
+                ::operator delete(block.memory);
+            }
+            blocks.clear();
+            blocks.push_back(newBlock(total));
+        }
+        for (Block& block : blocks)
+            block.used = 0;
+        used = 0;
+    }
+
+    // Handed out since the last reset
+    size_t bytesUsed() const
+    {
+        return used;
+    }
+
+    // The most any frame has used
+    size_t peakBytes() const
+    {
+        return std::max(peak, used);
+    }
+
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (const Block& block : blocks)
+            total += block.size;
+        return total;
+    }
+
+    // How many times a frame didn't fit and another block had to be allocated
+    size_t overflows = 0;
+
+    // This thread's arena
+    static FrameArena& local()
+    {
+        static thread_local FrameArena arena;
+        // Made after the arena, so it's gone again first when the thread ends
+        static thread_local Registration registration(&arena);
+        return arena;
+    }
+
+    // Resets every thread's arena. Nothing may be using any of them while this runs.
+    static void resetAll()
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (FrameArena* arena : registry)
+            arena->reset();
+    }
+
+private:
+    struct Block
+    {
+        uint8_t* memory;
+        size_t size;
+        size_t used;
+    };
+
+    // Keeps track of a thread's arena for resetAll(), until the thread ends
+    struct Registration
+    {
+        FrameArena* arena;
+
+        explicit Registration(FrameArena* arena) : arena(arena)
+        {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            registry.push_back(arena);
+        }
+
+        ~Registration()
+        {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            registry.erase(std::find(registry.begin(), registry.end(), arena));
+        }
+    };
+
+    // Through operator new rather than malloc, so the allocation tracker sees the arena growing
+    static Block newBlock(size_t size)
+    {
+        return { static_cast<uint8_t*>(::operator new(size)), size, 0 };
+    }
+
+    // Null if it doesn't fit. Lines up the address rather than the offset, since blocks are only
+    // aligned for max_align_t.
+    void* take(Block& block, size_t bytes, size_t alignment)
+    {
+        uintptr_t end = (uintptr_t)block.memory + block.used;
+        size_t start = (size_t)(((end + alignment - 1) & ~(uintptr_t)(alignment - 1)) - (uintptr_t)block.memory);
+        if (start + bytes > block.size)
+            return nullptr;
+        block.used = start + bytes;
+        used += bytes;
+        return block.memory + start;
+    }
+
+    size_t blockSize;
+    // Only the last one is still being filled
+    std::vector<Block> blocks;
+    size_t used = 0;
+    size_t peak = 0;
+
+    static inline std::mutex registryMutex;
+    static inline std::vector<FrameArena*> registry;
+};
+
+// Lets standard containers live in a FrameArena for a frame. Memory is only given back at reset,
+// so growing one leaves the old storage behind until then, reserve() up front where possible.
+//
+//   FrameVector<OpaqueDraw> draws(FrameArena::local());
+//   draws.reserve(count);
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaAllocator(FrameArena& arena) : arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return arena != other.arena;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    FrameArena* arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+// Objects of one type that come and go at any time, but whose addresses mustn't change (unlike
+// HandlePool, which moves them to keep them packed). Memory comes in chunks of CHUNK objects that
+// are kept until the pool goes, and freed slots are reused first, so once it's held the most
+// that are ever alive at once, create and destroy don't allocate.
+//
+//   Node* node = pool.create(...);
+//   pool.destroy(node);
+template <typename T, size_t CHUNK = 256>
+class FixedPool
+{
+public:
+    FixedPool() = default;
+
+    ~FixedPool()
+    {
+        // Anything still alive is destructed along with the pool
+        for (std::unique_ptr<Slot[]>& chunk : chunks)
+            for (size_t i = 0; i < CHUNK; i++)
+                if (chunk[i].alive)
+                    chunk[i].get()->~T();
+    }
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+        if (!freeList)
+            addChunk();
+        Slot* slot = freeList;
+        T* object = new (slot->storage) T(std::forward<Args>(args)...);
+        freeList = slot->next;
+        slot->alive = true;
+        alive++;
+        return object;
+    }
+
+    void destroy(T* object)
+    {
+        if (!object)
+            return;
+        object->~T();
+        // storage is the first member, so the object's address is its slot's
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->alive = false;
+        slot->next = freeList;
+        freeList = slot;
+        alive--;
+    }
+
+    // Makes sure count can be alive at once without allocating
+    void reserve(size_t count)
+    {
+        while (capacity() < count)
+            addChunk();
+    }
+
+    size_t size() const
+    {
+        return alive;
+    }
+
+    size_t capacity() const
+    {
+        return chunks.size() * CHUNK;
+    }
+
+private:
+    struct Slot
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Slot* next;
+        bool alive;
+
+        T* get()
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    void addChunk()
+    {
+        chunks.emplace_back(new Slot[CHUNK]);
+        Slot* chunk = chunks.back().get();
+        // Linked in order, so a fresh pool hands out neighbouring slots
+        for (size_t i = 0; i < CHUNK; i++)
+        {
+            chunk[i].alive = false;
+            chunk[i].next = i + 1 < CHUNK ? &chunk[i + 1] : freeList;
+        }
+        freeList = chunk;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+    Slot* freeList = nullptr;
+    size_t alive = 0;
+};
@@ -0,0 +1,342 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "png.h"
+#include "readback.h"
+
+// Saving every frame, e.g. for rendering a video offline. Reading the frame back straight after
+// drawing it makes the CPU wait for the GPU to finish, so the pixels go through AsyncReadback and
+// are picked up a couple of frames later. Turning them into files is slow too (a 4K PNG takes far
+// longer than drawing the frame), so that's done by a few encoder threads. The render thread only
+// blocks when the GPU is more than a ring's worth of frames behind, or the encoders have fallen
+// too far behind to queue any more.
+//
+//   capture.start("./capture", CaptureFormat::Png, width, height);
+//   // each frame, after drawing and before swapping buffers
+//   glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+//   capture.captureFrame();
+//   ...
+//   capture.stop();   // waits for everything still in flight to be written
+enum class CaptureFormat
+{
+    Png,    // frame_000000.png, ...
+    Raw,    // frame_000000.rgba, ... tightly packed RGBA rows from the top down
+    Y4m,    // one capture.y4m, 4:2:0 YUV which most video tools read directly
+};
+
+// "png", "raw" or "y4m"
+inline bool parseCaptureFormat(const char* name, CaptureFormat& format)
+{
+    if (strcmp(name, "png") == 0) format = CaptureFormat::Png;
+    else if (strcmp(name, "raw") == 0) format = CaptureFormat::Raw;
+    else if (strcmp(name, "y4m") == 0) format = CaptureFormat::Y4m;
+    else return false;
+    return true;
+}
+
+struct CaptureStats
+{
+    size_t captured = 0;
+    size_t written = 0;
+    size_t failed = 0;
+    // Times captureFrame() had to wait for the GPU, because every readback buffer was still busy
+    size_t gpuWaits = 0;
+    // Times captureFrame() had to wait for the encoders, because the queue was full
+    size_t encoderWaits = 0;
+    // Time spent in captureFrame() on the render thread
+    double captureMs = 0.0;
+    // Time spent encoding and writing, added up over every encoder thread
+    double encodeMs = 0.0;
+    uint64_t bytesWritten = 0;
+};
+
+class FrameCapture
+{
+public:
+    ~FrameCapture()
+    {
+        stopEncoders();
+    }
+
+    // Starts saving width x height frames into folder. fps is only used for the Y4M header. By
+    // default there's an encoder per core, leaving one for the render thread, and twice as many
+    // frames can be queued up for them as there are encoders.
+    bool start(const std::string& captureFolder, CaptureFormat captureFormat, int frameWidth, int frameHeight, int fps = 60,
+        unsigned encoderCount = 0, int ringSize = 3, size_t queueLimit = 0)
+    {
+        stop();
+        std::error_code error;
+        std::filesystem::create_directories(captureFolder, error);
+        if (error)
+        {
+            std::cerr << "Can't make capture folder " << captureFolder << ": " << error.message() << std::endl;
+            return false;
+        }
+        folder = captureFolder;
+        format = captureFormat;
+        width = frameWidth;
+        height = frameHeight;
+        if (format == CaptureFormat::Y4m)
+        {
+            video.open(folder + "/capture.y4m", std::ios::binary);
+            if (!video)
+            {
+                std::cerr << "Can't write " << folder << "/capture.y4m" << std::endl;
+                return false;
+            }
+            // C420jpeg is full range BT.601, the same as JPEG
+            char header[128];
+            int length = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps);
+            video.write(header, length);
+        }
+
+        readback.create(width, height, ringSize, "Frame capture");
+        if (encoderCount == 0)
+            encoderCount = std::max(1u, std::thread::hardware_concurrency() - 1);
+        maxQueued = queueLimit ? queueLimit : encoderCount * 2;
+        stats = CaptureStats();
+        nextFrame = 0;
+        nextToWrite = 0;
+        stopping = false;
+        for (unsigned i = 0; i < encoderCount; i++)
+            encoders.emplace_back([this] { encodeLoop(); });
+        running = true;
+        return true;
+    }
+
+    // Starts reading back the current read framebuffer, and hands any earlier frames that have
+    // arrived to the encoders
+    void captureFrame()
+    {
+        if (!running)
+            return;
+        auto start = std::chrono::steady_clock::now();
+        if (!readback.request(0, 0, width, height))
+        {
+            // The GPU is a whole ring behind, wait for the oldest so there's room
+            stats.gpuWaits++;
+            collectOldest(true);
+            readback.request(0, 0, width, height);
+        }
+        stats.captured++;
+        while (collectOldest(false)) {}
+        stats.captureMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Waits for every frame still being read back or encoded, then closes everything
+    void stop()
+    {
+        if (!running)
+            return;
+        while (readback.pending())
+            collectOldest(true);
+        stopEncoders();
+        readback.destroy();
+        video.close();
+        running = false;
+    }
+
+    bool active() const
+    {
+        return running;
+    }
+
+    // Safe to read once stop() has returned
+    CaptureStats stats;
+
+private:
+    struct Frame
+    {
+        size_t index = 0;
+        std::vector<uint8_t> rgba;
+    };
+
+    // Passes the oldest read on to the encoders if it's arrived (or once it has, with wait)
+    bool collectOldest(bool wait)
+    {
+        Frame frame;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!spare.empty())
+            {
+                frame.rgba = std::move(spare.back());
+                spare.pop_back();
+            }
+        }
+        if (!readback.collect(frame.rgba, nullptr, nullptr, wait))
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            spare.push_back(std::move(frame.rgba));
+            return false;
+        }
+        frame.index = nextFrame++;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.size() >= maxQueued)
+        {
+            stats.encoderWaits++;
+            space.wait(lock, [this] { return queue.size() < maxQueued; });
+        }
+        queue.push_back(std::move(frame));
+        work.notify_one();
+        return true;
+    }
+
+    void encodeLoop()
+    {
+        std::vector<uint8_t> scratch;
+        for (;;)
+        {
+            Frame frame;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty())
+                    return;
+                frame = std::move(queue.front());
+                queue.pop_front();
+            }
+            space.notify_one();
+
+            auto start = std::chrono::steady_clock::now();
+            uint64_t bytes = 0;
+            bool ok = encode(frame, scratch, bytes);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            stats.encodeMs += ms;
+            stats.bytesWritten += bytes;
+            if (ok)
+                stats.written++;
+            else
+                stats.failed++;
+            spare.push_back(std::move(frame.rgba));
+        }
+    }
+
+    bool encode(Frame& frame, std::vector<uint8_t>& scratch, uint64_t& bytes)
+    {
+        char name[32];
+        size_t rowBytes = (size_t)width * 4;
+        if (format == CaptureFormat::Png)
+        {
+            snprintf(name, sizeof(name), "/frame_%06zu.png", frame.index);
+            // writePng wants an Image, borrow the frame's pixels for it rather than copying them
+            Image image;
+            image.width = width;
+            image.height = height;
+            image.rgba.swap(frame.rgba);
+            bool ok = writePng(folder + name, image);
+            image.rgba.swap(frame.rgba);
+            std::error_code error;
+            bytes = ok ? std::filesystem::file_size(folder + name, error) : 0;
+            return ok;
+        }
+        if (format == CaptureFormat::Raw)
+        {
+            snprintf(name, sizeof(name), "/frame_%06zu.rgba", frame.index);
+            std::ofstream file(folder + name, std::ios::binary);
+            // GL reads rows from the bottom up, files go from the top down
+            for (int y = height - 1; y >= 0 && file; y--)
+                file.write((const char*)frame.rgba.data() + y * rowBytes, rowBytes);
+            bytes = file ? rowBytes * height : 0;
+            if (!file)
+                std::cerr << "Failed to write " << folder << name << std::endl;
+            return (bool)file;
+        }
+
+        // Y4M: convert in parallel, but the frames have to go into the file in order
+        toYuv420(frame.rgba.data(), scratch);
+        std::unique_lock<std::mutex> lock(videoMutex);
+        videoTurn.wait(lock, [&] { return nextToWrite == frame.index; });
+        video.write("FRAME\n", 6);
+        video.write((const char*)scratch.data(), scratch.size());
+        nextToWrite++;
+        videoTurn.notify_all();
+        bytes = scratch.size() + 6;
+        return (bool)video;
+    }
+
+    // Full range BT.601 in 8.8 fixed point, with each chroma sample the average of a 2x2 block
+    void toYuv420(const uint8_t* rgba, std::vector<uint8_t>& yuv) const
+    {
+        int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+        yuv.resize((size_t)width * height + (size_t)chromaWidth * chromaHeight * 2);
+        uint8_t* lumaPlane = yuv.data();
+        uint8_t* cbPlane = lumaPlane + (size_t)width * height;
+        uint8_t* crPlane = cbPlane + (size_t)chromaWidth * chromaHeight;
+        size_t rowBytes = (size_t)width * 4;
+        for (int y = 0; y < height; y++)
+        {
+            const uint8_t* row = rgba + (size_t)(height - 1 - y) * rowBytes;
+            uint8_t* luma = lumaPlane + (size_t)y * width;
+            for (int x = 0; x < width; x++)
+                luma[x] = (uint8_t)((77 * row[x * 4] + 150 * row[x * 4 + 1] + 29 * row[x * 4 + 2] + 128) >> 8);
+        }
+        for (int cy = 0; cy < chromaHeight; cy++)
+        {
+            // Rows and columns past the edge of an odd sized frame repeat the last one
+            const uint8_t* top = rgba + (size_t)(height - 1 - cy * 2) * rowBytes;
+            const uint8_t* bottom = rgba + (size_t)(height - 1 - std::min(cy * 2 + 1, height - 1)) * rowBytes;
+            for (int cx = 0; cx < chromaWidth; cx++)
+            {
+                int left = cx * 8, right = std::min(cx * 2 + 1, width - 1) * 4;
+                int r = top[left] + top[right] + bottom[left] + bottom[right];
+                int g = top[left + 1] + top[right + 1] + bottom[left + 1] + bottom[right + 1];
+                int b = top[left + 2] + top[right + 2] + bottom[left + 2] + bottom[right + 2];
+                // The sums are 4x the average, so shift by 2 more, and 128 << 10 puts the middle at 128.
+                // Pure blue or red rounds up to 256, hence the min.
+                cbPlane[(size_t)cy * chromaWidth + cx] = (uint8_t)std::min(255, (-43 * r - 85 * g + 128 * b + (128 << 10) + 512) >> 10);
+                crPlane[(size_t)cy * chromaWidth + cx] = (uint8_t)std::min(255, (128 * r - 107 * g - 21 * b + (128 << 10) + 512) >> 10);
+            }
+        }
+    }
+
+    void stopEncoders()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        work.notify_all();
+        for (std::thread& encoder : encoders)
+            encoder.join();
+        encoders.clear();
+    }
+
+    std::string folder;
+    CaptureFormat format = CaptureFormat::Png;
+    int width = 0;
+    int height = 0;
+    bool running = false;
+    AsyncReadback readback;
+    size_t nextFrame = 0;
+    std::vector<std::thread> encoders;
+
+    // Shared with the encoders
+    std::mutex mutex;
+    std::condition_variable work;
+    std::condition_variable space;
+    std::deque<Frame> queue;
+    std::vector<std::vector<uint8_t>> spare;
+    size_t maxQueued = 0;
+    bool stopping = false;
+
+    // Y4M frames are written one at a time, in order
+    std::mutex videoMutex;
+    std::condition_variable videoTurn;
+    std::ofstream video;
+    size_t nextToWrite = 0;
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <iostream>
+#include <glad/glad.h>
+#include "gl_debug.h"
+
+// An offscreen render target: a colour texture and, optionally, a depth texture to go with it.
+// Depth is a texture rather than a renderbuffer so later passes can read it back.
+// Draw into it with bind(), then either sample colourTexture or blitToScreen() when done.
+class Framebuffer
+{
+public:
+    // Calling it again replaces the attachments (the old ones are deleted)
+    bool create(int width, int height, bool withDepth = true, const char* label = "framebuffer")
+    {
+        destroy();
+        this->width = width;
+        this->height = height;
+        this->withDepth = withDepth;
+        this->label = label;
+
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+        glGenTextures(1, &colourTexture);
+        glBindTexture(GL_TEXTURE_2D, colourTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colourTexture, 0);
+
+        if (withDepth)
+        {
+            glGenTextures(1, &depthTexture);
+            glBindTexture(GL_TEXTURE_2D, depthTexture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+        {
+            std::cerr << label << ": framebuffer isn't complete (status 0x" << std::hex << status << std::dec << ")" << std::endl;
+            destroy();
+            return false;
+        }
+        GL_DEBUG_LABEL(GL_FRAMEBUFFER, framebuffer, label);
+        GL_DEBUG_LABEL(GL_TEXTURE, colourTexture, label);
+        GL_DEBUG_LABEL(GL_TEXTURE, depthTexture, label);
+        return true;
+    }
+
+    // Makes new attachments if the size has changed, e.g. when the window is resized
+    bool resize(int newWidth, int newHeight)
+    {
+        if (framebuffer && newWidth == width && newHeight == height)
+            return true;
+        destroy();
+        return create(newWidth, newHeight, withDepth, label);
+    }
+
+    void destroy()
+    {
+        if (framebuffer) glDeleteFramebuffers(1, &framebuffer);
+        if (colourTexture) glDeleteTextures(1, &colourTexture);
+        if (depthTexture) glDeleteTextures(1, &depthTexture);
+        framebuffer = colourTexture = depthTexture = 0;
+    }
+
+    // Draws go here from now on, with the viewport covering the whole thing
+    void bind() const
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glViewport(0, 0, width, height);
+    }
+
+    // Back to the window's framebuffer
+    static void unbind(int windowWidth, int windowHeight)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, screen);
+        glViewport(0, 0, windowWidth, windowHeight);
+    }
+
+    // Copies the colour to the window, stretched to fit, and leaves the window's framebuffer bound
+    void blitToScreen(int windowWidth, int windowHeight) const
+    {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, screen);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, windowWidth, windowHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        unbind(windowWidth, windowHeight);
+    }
+
+    // What counts as the window's framebuffer, normally 0. Headless renders point it at their own
+    // target so demos that draw offscreen and copy to the window end up there instead.
+    static inline GLuint screen = 0;
+
+    GLuint framebuffer = 0;
+    GLuint colourTexture = 0;
+    GLuint depthTexture = 0;
+    int width = 0;
+    int height = 0;
+
+private:
+    bool withDepth = true;
+    const char* label = "framebuffer";
+};
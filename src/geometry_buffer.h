@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "mesh_simplify.h"
+
+// Where a mesh ended up in a GeometryBuffer
+struct GeometryMesh
+{
+    GLint baseVertex = 0;
+    // firstIndex is from the start of the whole index buffer
+    std::vector<MeshLod> lods;
+    float radius = 0.0f;
+
+    uint32_t triangleCount(size_t lod) const
+    {
+        return lods[lod].indexCount / 3;
+    }
+};
+
+// One vertex buffer and one index buffer shared by lots of meshes and all their LODs, so drawing a
+// different mesh (or LOD) is just a different range with glDrawElementsBaseVertex, with no VAO or
+// buffer changes in between. Add everything, then upload() once.
+class GeometryBuffer
+{
+public:
+    size_t add(const LodMesh& mesh)
+    {
+        GeometryMesh placed;
+        placed.baseVertex = (GLint)vertices.size();
+        placed.radius = mesh.radius;
+        uint32_t firstIndex = (uint32_t)indices.size();
+        for (MeshLod lod : mesh.lods)
+        {
+            lod.firstIndex += firstIndex;
+            placed.lods.push_back(lod);
+        }
+        vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+        indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+        meshes.push_back(placed);
+        return meshes.size() - 1;
+    }
+
+    // Sends everything added so far to the GPU. Positions go in attribute 0, like the other demos.
+    void upload(const char* label = "geometry")
+    {
+        if (!vao)
+        {
+            glGenVertexArrays(1, &vao);
+            glGenBuffers(1, &vertexBuffer);
+            glGenBuffers(1, &indexBuffer);
+        }
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vec3), vertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+        attach();
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        GL_DEBUG_LABEL(GL_VERTEX_ARRAY, vao, label);
+        GL_DEBUG_LABEL(GL_BUFFER, vertexBuffer, label);
+        GL_DEBUG_LABEL(GL_BUFFER, indexBuffer, label);
+    }
+
+    void destroy()
+    {
+        if (vao) glDeleteVertexArrays(1, &vao);
+        if (vertexBuffer) glDeleteBuffers(1, &vertexBuffer);
+        if (indexBuffer) glDeleteBuffers(1, &indexBuffer);
+        vao = vertexBuffer = indexBuffer = 0;
+    }
+
+    void bind() const
+    {
+        glBindVertexArray(vao);
+    }
+
+    // Points the bound VAO at the buffers. upload() does this for its own VAO, which only exists in
+    // the context it was made in, so other contexts sharing the buffers call it from
+    // ContextManager::vertexArray() to get one of their own.
+    void attach() const
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vec3), (void*)0);
+        glEnableVertexAttribArray(0);
+        // The element buffer binding is part of the VAO, so leave it bound
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    }
+
+    // Bytes on the GPU, for working out what sharing between contexts saves
+    size_t byteSize() const
+    {
+        return vertices.size() * sizeof(Vec3) + indices.size() * sizeof(uint32_t);
+    }
+
+    // Expects bind() to have been called
+    void draw(size_t mesh, size_t lod) const
+    {
+        const GeometryMesh& placed = meshes[mesh];
+        const MeshLod& range = placed.lods[lod];
+        glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+            (void*)(range.firstIndex * sizeof(uint32_t)), placed.baseVertex);
+    }
+
+    std::vector<GeometryMesh> meshes;
+
+private:
+    std::vector<Vec3> vertices;
+    std::vector<uint32_t> indices;
+    GLuint vao = 0;
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+};
@@ -0,0 +1,189 @@
+#pragma once
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <glad/glad.h>
+#include <glad/glad_extras.h>
+#include <GLFW/glfw3.h>
+#include "gl_features.h"
+
+// Driver debug output (KHR_debug, core since GL 4.3). In debug builds the driver reports every GL error
+// and its performance warnings through a callback as they happen, objects get names that show up in
+// those messages (and in RenderDoc etc.), and each render function is wrapped in a debug group.
+//
+// With NDEBUG defined all of it compiles down to nothing, the labels and groups included.
+//
+// Call debugWindowHints() before making the window and setupDebugOutput() once the context is current.
+// Label objects with GL_DEBUG_LABEL(GL_BUFFER, VBO, "name") and wrap work in GL_DEBUG_GROUP("name").
+#define GL_DEBUG_CONCAT_INNER(a, b) a##b
+#define GL_DEBUG_CONCAT(a, b) GL_DEBUG_CONCAT_INNER(a, b)
+
+#ifdef NDEBUG
+
+// The arguments are still used, so a label passed in as a parameter doesn't leave it unused
+#define GL_DEBUG_LABEL(identifier, name, label) ((void)(identifier), (void)(name), (void)(label))
+#define GL_DEBUG_GROUP(name) ((void)(name))
+
+inline void debugWindowHints() {}
+inline bool setupDebugOutput() { return false; }
+inline void printDebugSummary() {}
+
+#else
+
+// What the driver has told us so far. Every context shares these, and contexts on other threads
+// (see ContextManager) can call back at the same time, so they're only touched under mutex.
+struct DebugCounters
+{
+    std::mutex mutex;
+    int errors = 0;
+    // Deprecated or undefined behaviour, portability issues
+    int warnings = 0;
+    int performance = 0;
+    // The performance warnings sorted by what they're about, going by the wording of the message
+    int implicitSyncs = 0;
+    int recompiles = 0;
+    // How many times each performance message has come up, they tend to repeat every frame
+    std::map<GLuint, int> performanceIds;
+};
+inline DebugCounters debugCounters;
+
+inline const char* debugSourceName(GLenum source)
+{
+    switch (source)
+    {
+    case GL_DEBUG_SOURCE_API: return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION: return "application";
+    default: return "other";
+    }
+}
+
+inline const char* debugTypeName(GLenum type)
+{
+    switch (type)
+    {
+    case GL_DEBUG_TYPE_ERROR: return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behaviour";
+    case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+    case GL_DEBUG_TYPE_MARKER: return "marker";
+    default: return "other";
+    }
+}
+
+inline bool debugMessageMentions(const std::string& message, const char* word)
+{
+    return message.find(word) != std::string::npos;
+}
+
+inline void APIENTRY onDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* /*userParam*/)
+{
+    std::string text(message, length < 0 ? strlen(message) : (size_t)length);
+    if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP)
+        return;
+
+    // Held while printing too, so messages from different threads don't come out interleaved
+    std::lock_guard<std::mutex> lock(debugCounters.mutex);
+
+    if (type == GL_DEBUG_TYPE_PERFORMANCE)
+    {
+        debugCounters.performance++;
+        std::string lower = text;
+        for (char& c : lower)
+            c = (char)tolower((unsigned char)c);
+        if (debugMessageMentions(lower, "recompil"))
+            debugCounters.recompiles++;
+        else if (debugMessageMentions(lower, "stall") || debugMessageMentions(lower, "sync") || debugMessageMentions(lower, "wait"))
+            debugCounters.implicitSyncs++;
+        // Only print them the first time, the summary at the end has the totals
+        if (debugCounters.performanceIds[id]++ > 0)
+            return;
+    }
+    else if (type == GL_DEBUG_TYPE_ERROR)
+        debugCounters.errors++;
+    else
+        debugCounters.warnings++;
+
+    std::cerr << "GL " << debugSourceName(source) << " " << debugTypeName(type) << " " << id
+        << (severity == GL_DEBUG_SEVERITY_HIGH ? " (high)" : "") << ": " << text << std::endl;
+}
+
+inline void debugWindowHints()
+{
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+}
+
+// Needs glFeatures.detect() to have been called
+inline bool setupDebugOutput()
+{
+    if (!glFeatures.debugOutput)
+    {
+        std::cerr << "No debug output on this driver (needs GL 4.3 or KHR_debug)" << std::endl;
+        return false;
+    }
+    // Before 4.3 these only exist through the extension, and glad only loads them up front for 4.3 contexts
+    for (const char* name : { "glDebugMessageCallback", "glDebugMessageControl", "glObjectLabel", "glPushDebugGroup", "glPopDebugGroup" })
+        gladLoadGLFunction(name);
+    if (!glDebugMessageCallback)
+        return false;
+
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT))
+        std::cerr << "Didn't get a debug context, the driver might not say as much" << std::endl;
+
+    glEnable(GL_DEBUG_OUTPUT);
+    // Makes the callback run inside the GL call that caused it, so a breakpoint in it shows who's to blame
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(onDebugMessage, nullptr);
+    // Notifications are mostly chatter (buffer placement, our own debug groups)
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+    return true;
+}
+
+inline void debugLabel(GLenum identifier, GLuint name, const char* label)
+{
+    if (glObjectLabel && name)
+        glObjectLabel(identifier, name, -1, label);
+}
+
+// Pushes a debug group for as long as it's in scope
+struct DebugGroup
+{
+    explicit DebugGroup(const char* name)
+    {
+        pushed = glPushDebugGroup != nullptr;
+        if (pushed)
+            glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+    }
+
+    ~DebugGroup()
+    {
+        if (pushed)
+            glPopDebugGroup();
+    }
+
+    DebugGroup(const DebugGroup&) = delete;
+    DebugGroup& operator=(const DebugGroup&) = delete;
+
+    bool pushed;
+};
+
+inline void printDebugSummary()
+{
+    std::lock_guard<std::mutex> lock(debugCounters.mutex);
+    std::cout << "GL debug output: " << debugCounters.errors << " errors, " << debugCounters.warnings << " warnings, "
+        << debugCounters.performance << " performance warnings (" << debugCounters.implicitSyncs << " implicit syncs, "
+        << debugCounters.recompiles << " recompiles, " << debugCounters.performanceIds.size() << " different messages)" << std::endl;
+}
+
+#define GL_DEBUG_LABEL(identifier, name, label) debugLabel(identifier, name, label)
+#define GL_DEBUG_GROUP(name) DebugGroup GL_DEBUG_CONCAT(debugGroup, __LINE__)(name)
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <glad/glad.h>
+#include <glad/glad_extras.h>
+#include "hash.h"
+
+// Extension names hashed at compile time, for gladHasExtensionHash: "GL_KHR_debug"_extension
+constexpr uint32_t operator""_extension(const char* name, size_t length)
+{
+    return fnv1a(name, length);
+}
+
+inline bool hasExtension(uint32_t hash)
+{
+    return gladHasExtensionHash(hash) != 0;
+}
+
+// Which of the faster paths the current context supports. Each one is either core in some GL
+// version, or available earlier as an extension, so it's checked both ways.
+// Call detect() once after gladLoadGLLoader, then pick code paths from the flags.
+struct GLFeatures
+{
+    // glBufferStorage with GL_MAP_PERSISTENT_BIT, so buffers can stay mapped while the GPU reads them
+    bool persistentMapping = false;
+    // glMultiDrawArraysIndirect/glMultiDrawElementsIndirect, draw arguments come from a buffer
+    bool indirectDraw = false;
+    // glGetProgramBinary/glProgramBinary, to cache linked programs on disk. Some drivers have it but support no formats.
+    bool programBinary = false;
+    // glDebugMessageCallback and object labels
+    bool debugOutput = false;
+    // GL_COMPLETION_STATUS_KHR, to check on shader compiles without blocking
+    bool parallelShaderCompile = false;
+    // Texture handles that shaders can use without binding them to units
+    bool bindlessTextures = false;
+    // Most anisotropic filtering allowed, 1 if there isn't any (core in 4.6, an extension before)
+    float maxAnisotropy = 1.0f;
+
+    void detect()
+    {
+        persistentMapping = GLAD_GL_VERSION_4_4 || hasExtension("GL_ARB_buffer_storage"_extension);
+        indirectDraw = GLAD_GL_VERSION_4_3 || hasExtension("GL_ARB_multi_draw_indirect"_extension);
+        if (GLAD_GL_VERSION_4_1 || hasExtension("GL_ARB_get_program_binary"_extension))
+        {
+            GLint formats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            programBinary = formats > 0;
+        }
+        debugOutput = GLAD_GL_VERSION_4_3 || hasExtension("GL_KHR_debug"_extension);
+        parallelShaderCompile = hasExtension("GL_KHR_parallel_shader_compile"_extension) || hasExtension("GL_ARB_parallel_shader_compile"_extension);
+        bindlessTextures = hasExtension("GL_ARB_bindless_texture"_extension);
+        if (GLAD_GL_VERSION_4_6 || hasExtension("GL_ARB_texture_filter_anisotropic"_extension) || hasExtension("GL_EXT_texture_filter_anisotropic"_extension))
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &maxAnisotropy);
+    }
+
+    void print() const
+    {
+        std::cout << "GL " << GLVersion.major << "." << GLVersion.minor << ", " << gladExtensionCount() << " extensions" << std::endl;
+        std::cout << "  persistent mapping: " << persistentMapping << ", indirect draw: " << indirectDraw
+            << ", program binary: " << programBinary << ", debug output: " << debugOutput
+            << ", parallel shader compile: " << parallelShaderCompile << ", bindless textures: " << bindlessTextures
+            << ", max anisotropy: " << maxAnisotropy << std::endl;
+    }
+};
+inline GLFeatures glFeatures;
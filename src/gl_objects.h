@@ -0,0 +1,238 @@
+#pragma once
+#include <utility>
+#include <vector>
+#include <glad/glad.h>
+#include "handle_pool.h"
+
+// Owning wrappers for GL object names, so they get deleted when whatever holds them goes away or
+// is given a new one, rather than leaking. They can be moved but not copied, so there's only ever
+// one owner. They convert to GLuint, so they can be passed straight to GL calls.
+//
+//   GLBuffer VBO = GLBuffer::create();
+//   glBindBuffer(GL_ARRAY_BUFFER, VBO);
+//   VBO = GLBuffer::create();   // the old buffer is deleted here
+//
+// Deleting needs the context, so anything that would outlive it (globals, or locals in main()
+// after glfwTerminate) has to be reset() before then.
+
+// How to make and delete each kind of object, a batch at a time
+struct GLBufferTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenBuffers(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteBuffers(count, names); }
+};
+
+struct GLVertexArrayTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenVertexArrays(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteVertexArrays(count, names); }
+};
+
+struct GLTextureTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenTextures(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteTextures(count, names); }
+};
+
+struct GLFramebufferTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenFramebuffers(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteFramebuffers(count, names); }
+};
+
+struct GLSamplerTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenSamplers(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteSamplers(count, names); }
+};
+
+struct GLQueryTraits
+{
+    static void generate(GLsizei count, GLuint* names) { glGenQueries(count, names); }
+    static void destroy(GLsizei count, const GLuint* names) { glDeleteQueries(count, names); }
+};
+
+// Programs are made and deleted one at a time
+struct GLProgramTraits
+{
+    static void generate(GLsizei count, GLuint* names) { for (GLsizei i = 0; i < count; i++) names[i] = glCreateProgram(); }
+    static void destroy(GLsizei count, const GLuint* names) { for (GLsizei i = 0; i < count; i++) glDeleteProgram(names[i]); }
+};
+
+template <typename Traits>
+class GLObject
+{
+public:
+    GLObject() = default;
+
+    // Takes ownership of an existing name
+    explicit GLObject(GLuint name) : name(name) {}
+
+    static GLObject create()
+    {
+        GLuint name = 0;
+        Traits::generate(1, &name);
+        return GLObject(name);
+    }
+
+    ~GLObject()
+    {
+        reset();
+    }
+
+    GLObject(GLObject&& other) noexcept : name(other.release()) {}
+
+    GLObject& operator=(GLObject&& other) noexcept
+    {
+        if (this != &other)
+            reset(other.release());
+        return *this;
+    }
+
+    GLObject(const GLObject&) = delete;
+    GLObject& operator=(const GLObject&) = delete;
+
+    operator GLuint() const
+    {
+        return name;
+    }
+
+    GLuint get() const
+    {
+        return name;
+    }
+
+    // Deletes the object now (if there is one) and takes name instead
+    void reset(GLuint newName = 0)
+    {
+        if (name)
+            Traits::destroy(1, &name);
+        name = newName;
+    }
+
+    // Gives up ownership without deleting anything
+    GLuint release()
+    {
+        GLuint released = name;
+        name = 0;
+        return released;
+    }
+
+private:
+    GLuint name = 0;
+};
+
+using GLBuffer = GLObject<GLBufferTraits>;
+using GLVertexArray = GLObject<GLVertexArrayTraits>;
+using GLTexture = GLObject<GLTextureTraits>;
+using GLFramebuffer = GLObject<GLFramebufferTraits>;
+using GLSampler = GLObject<GLSamplerTraits>;
+using GLQuery = GLObject<GLQueryTraits>;
+using GLProgram = GLObject<GLProgramTraits>;
+
+// Names waiting to be deleted, one glDelete* call per kind when flushed rather than one per object
+template <typename Traits>
+class GLDeleteQueue
+{
+public:
+    void add(GLuint name)
+    {
+        if (name)
+            names.push_back(name);
+    }
+
+    void flush()
+    {
+        if (!names.empty())
+        {
+            Traits::destroy((GLsizei)names.size(), names.data());
+            names.clear();
+            batches++;
+        }
+    }
+
+    size_t pending() const
+    {
+        return names.size();
+    }
+
+    // How many glDelete* calls flush() has made
+    size_t batches = 0;
+
+private:
+    std::vector<GLuint> names;
+};
+
+// Objects of one kind that are made and thrown away all the time, e.g. per frame buffers or
+// queries. Handles rather than names are given out, so one that's kept after being destroyed is
+// caught (get() returns 0) even once GL hands the same name out again. Destroyed objects are only
+// actually deleted at endFrame(), all with one call, and new names are made a batch at a time.
+//
+// Like GLObject, call clear() while the context is still current.
+template <typename Traits>
+class GLObjectPool
+{
+public:
+    Handle create()
+    {
+        if (spare.empty())
+        {
+            spare.resize(GENERATE_BATCH);
+            Traits::generate(GENERATE_BATCH, spare.data());
+        }
+        GLuint name = spare.back();
+        spare.pop_back();
+        return objects.create(name);
+    }
+
+    // 0 if the handle is stale
+    GLuint get(Handle handle) const
+    {
+        const GLObject<Traits>* object = objects.get(handle);
+        return object ? object->get() : 0;
+    }
+
+    void destroy(Handle handle)
+    {
+        if (GLObject<Traits>* object = objects.get(handle))
+        {
+            // Released first so moving the last object into its place doesn't delete it straight away
+            deletes.add(object->release());
+            objects.destroy(handle);
+        }
+    }
+
+    void endFrame()
+    {
+        deletes.flush();
+    }
+
+    // Deletes everything, alive or not
+    void clear()
+    {
+        for (GLObject<Traits>& object : objects)
+            deletes.add(object.release());
+        for (GLuint name : spare)
+            deletes.add(name);
+        objects.clear();
+        spare.clear();
+        deletes.flush();
+    }
+
+    size_t size() const
+    {
+        return objects.size();
+    }
+
+    size_t deleteCalls() const
+    {
+        return deletes.batches;
+    }
+
+private:
+    static const GLsizei GENERATE_BATCH = 64;
+
+    HandlePool<GLObject<Traits>> objects;
+    std::vector<GLuint> spare;
+    GLDeleteQueue<Traits> deletes;
+};
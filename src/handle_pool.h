@@ -0,0 +1,153 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Refers to something in a HandlePool. The generation makes handles to things that have been
+// destroyed stop working, even once their slot is reused for something new, so holding on to an
+// old one is caught rather than quietly pointing at the wrong thing (the ABA problem). A default
+// handle (generation 0) never refers to anything.
+struct Handle
+{
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    explicit operator bool() const
+    {
+        return generation != 0;
+    }
+
+    bool operator==(const Handle& other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const Handle& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// Things that come and go a lot, kept packed together in one array, with handles rather than
+// pointers to refer to them. Handles go through a table of slots to find where each one is, so
+// removing one can move the last one into its place and the array stays dense for looping over.
+// Slots are reused once freed, so after warming up to the most that are ever alive at once,
+// creating and destroying doesn't allocate any more.
+//
+//   Handle handle = pool.create(...);
+//   if (T* thing = pool.get(handle)) ...   // null once it's been destroyed
+//   pool.destroy(handle);
+//   for (T& thing : pool) ...               // in no particular order
+template <typename T>
+class HandlePool
+{
+public:
+    template <typename... Args>
+    Handle create(Args&&... args)
+    {
+        uint32_t index;
+        if (freeSlots.empty())
+        {
+            index = (uint32_t)slots.size();
+            slots.push_back({ 0, 1 });
+        }
+        else
+        {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        slots[index].dense = (uint32_t)items.size();
+        items.emplace_back(std::forward<Args>(args)...);
+        itemSlots.push_back(index);
+        return { index, slots[index].generation };
+    }
+
+    bool valid(Handle handle) const
+    {
+        return handle.generation != 0 && handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    T* get(Handle handle)
+    {
+        return valid(handle) ? &items[slots[handle.index].dense] : nullptr;
+    }
+
+    const T* get(Handle handle) const
+    {
+        return valid(handle) ? &items[slots[handle.index].dense] : nullptr;
+    }
+
+    // Returns false if the handle was already stale
+    bool destroy(Handle handle)
+    {
+        if (!valid(handle))
+            return false;
+        Slot& slot = slots[handle.index];
+        uint32_t last = (uint32_t)items.size() - 1;
+        if (slot.dense != last)
+        {
+            items[slot.dense] = std::move(items[last]);
+            itemSlots[slot.dense] = itemSlots[last];
+            slots[itemSlots[slot.dense]].dense = slot.dense;
+        }
+        items.pop_back();
+        itemSlots.pop_back();
+        // Skip 0 when it wraps, that's the never valid generation
+        if (++slot.generation == 0)
+            slot.generation = 1;
+        freeSlots.push_back(handle.index);
+        return true;
+    }
+
+    void clear()
+    {
+        for (uint32_t index : itemSlots)
+        {
+            if (++slots[index].generation == 0)
+                slots[index].generation = 1;
+            freeSlots.push_back(index);
+        }
+        items.clear();
+        itemSlots.clear();
+    }
+
+    void reserve(size_t count)
+    {
+        items.reserve(count);
+        itemSlots.reserve(count);
+        slots.reserve(count);
+        freeSlots.reserve(count);
+    }
+
+    // The handle for the i'th item when looping over them
+    Handle handleAt(size_t i) const
+    {
+        uint32_t index = itemSlots[i];
+        return { index, slots[index].generation };
+    }
+
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    // Most that have been alive at once, which is how much room is kept
+    size_t slotCount() const { return slots.size(); }
+
+    T& operator[](size_t i) { return items[i]; }
+    typename std::vector<T>::iterator begin() { return items.begin(); }
+    typename std::vector<T>::iterator end() { return items.end(); }
+    typename std::vector<T>::const_iterator begin() const { return items.begin(); }
+    typename std::vector<T>::const_iterator end() const { return items.end(); }
+
+private:
+    struct Slot
+    {
+        // Where the item is in items
+        uint32_t dense;
+        uint32_t generation;
+    };
+
+    std::vector<T> items;
+    // Which slot each item belongs to, to fix up the table when items move
+    std::vector<uint32_t> itemSlots;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// FNV-1a, small and constexpr so names can be hashed at compile time. glad.c uses the same hash for
+// its extension registry, so hashes made here can be handed straight to it.
+constexpr uint32_t fnv1a(const char* name, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    return hash;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "png.h"
+
+// Comparing a render against a known good one (a golden image) without failing on differences
+// nobody could see. Colours are compared in YIQ, which weights brightness changes over hue the way
+// eyes do (the same measure pixelmatch uses), and a pixel only counts as different when that
+// distance is over threshold. A few different pixels are allowed too, since drivers don't all
+// agree on exactly which pixels along an edge a triangle covers.
+struct DiffSettings
+{
+    // 0 to 1, as a fraction of the biggest possible difference (black against white)
+    float threshold = 0.1f;
+    // Fraction of the pixels that can be different before the images count as not matching
+    double maxDifferentFraction = 0.001;
+};
+
+struct DiffResult
+{
+    bool sizeMatches = true;
+    size_t differentPixels = 0;
+    // The biggest difference seen, on the same 0 to 1 scale as the threshold
+    float maxDifference = 0.0f;
+    bool matches = false;
+};
+
+namespace image_diff_detail
+{
+    // Squared YIQ distance between two pixels, blended onto white first so alpha counts too
+    inline float colourDelta(const uint8_t* a, const uint8_t* b)
+    {
+        auto blend = [](uint8_t channel, uint8_t alpha) { return 255.0f + (channel - 255.0f) * (alpha / 255.0f); };
+        float r1 = blend(a[0], a[3]), g1 = blend(a[1], a[3]), b1 = blend(a[2], a[3]);
+        float r2 = blend(b[0], b[3]), g2 = blend(b[1], b[3]), b2 = blend(b[2], b[3]);
+        float y = (r1 - r2) * 0.29889531f + (g1 - g2) * 0.58662247f + (b1 - b2) * 0.11448223f;
+        float i = (r1 - r2) * 0.59597799f - (g1 - g2) * 0.27417610f - (b1 - b2) * 0.32180189f;
+        float q = (r1 - r2) * 0.21147017f - (g1 - g2) * 0.52261711f + (b1 - b2) * 0.31114694f;
+        return 0.5053f * y * y + 0.299f * i * i + 0.1957f * q * q;
+    }
+
+    // colourDelta() for black against white
+    const float MAX_DELTA = 35215.0f;
+}
+
+// Compares actual against expected. If diff isn't null it gets a picture of the differences: the
+// expected image faded out, with every different pixel in red.
+inline DiffResult diffImages(const Image& expected, const Image& actual, const DiffSettings& settings = DiffSettings(), Image* diff = nullptr)
+{
+    using namespace image_diff_detail;
+    DiffResult result;
+    if (expected.width != actual.width || expected.height != actual.height)
+    {
+        result.sizeMatches = false;
+        return result;
+    }
+
+    if (diff)
+    {
+        diff->width = expected.width;
+        diff->height = expected.height;
+        diff->rgba.resize(expected.rgba.size());
+    }
+    float limit = MAX_DELTA * settings.threshold * settings.threshold;
+    float maxDelta = 0.0f;
+    for (int y = 0; y < expected.height; y++)
+    {
+        for (int x = 0; x < expected.width; x++)
+        {
+            const uint8_t* a = expected.pixel(x, y);
+            const uint8_t* b = actual.pixel(x, y);
+            float delta = colourDelta(a, b);
+            maxDelta = std::max(maxDelta, delta);
+            bool different = delta > limit;
+            result.differentPixels += different;
+            if (diff)
+            {
+                uint8_t* out = diff->pixel(x, y);
+                if (different)
+                {
+                    out[0] = 255; out[1] = 0; out[2] = 0;
+                }
+                else
+                {
+                    float grey = a[0] * 0.29889531f + a[1] * 0.58662247f + a[2] * 0.11448223f;
+                    out[0] = out[1] = out[2] = (uint8_t)(255.0f + (grey - 255.0f) * 0.1f);
+                }
+                out[3] = 255;
+            }
+        }
+    }
+    result.maxDifference = std::sqrt(maxDelta / MAX_DELTA);
+    size_t allowed = (size_t)(settings.maxDifferentFraction * expected.width * expected.height);
+    result.matches = result.differentPixels <= allowed;
+    return result;
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small pool of worker threads for splitting loops up, e.g. updating transforms or culling.
+// parallelFor() cuts the range into chunks which the workers (and the calling thread) grab one at a
+// time until they run out, then returns once every chunk is done. It's meant to be driven from one
+// thread at a time, usually the render thread.
+class JobSystem
+{
+public:
+    // By default one worker per core, leaving one for the thread that calls parallelFor
+    explicit JobSystem(unsigned threadCount = std::max(1u, std::thread::hardware_concurrency()) - 1)
+    {
+        for (unsigned i = 0; i < threadCount; i++)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Calls job(begin, end) for every chunk of [0, count). Small ranges just run on this thread.
+    // The job is used where it is rather than copied into a std::function, which would allocate
+    // for any lambda capturing more than a couple of things.
+    template <typename Job>
+    void parallelFor(size_t count, size_t chunkSize, const Job& job)
+    {
+        if (count == 0)
+            return;
+        chunkSize = std::max<size_t>(chunkSize, 1);
+        if (workers.empty() || count <= chunkSize)
+        {
+            job(0, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batch.job = &job;
+            batch.run = [](const void* job, size_t begin, size_t end) { (*static_cast<const Job*>(job))(begin, end); };
+            batch.count = count;
+            batch.chunkSize = chunkSize;
+            next = 0;
+            pending = (count + chunkSize - 1) / chunkSize;
+            generation++;
+        }
+        wake.notify_all();
+        runChunks(batch);
+
+        // Wait for the last chunks, and for every worker to be out of the batch before it goes away
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pending == 0 && active == 0; });
+    }
+
+    size_t threadCount() const
+    {
+        return workers.size() + 1;
+    }
+
+private:
+    struct Batch
+    {
+        const void* job = nullptr;
+        void (*run)(const void* job, size_t begin, size_t end) = nullptr;
+        size_t count = 0;
+        size_t chunkSize = 1;
+    };
+
+    void runChunks(Batch work)
+    {
+        for (;;)
+        {
+            size_t begin = next.fetch_add(work.chunkSize);
+            if (begin >= work.count)
+                break;
+            work.run(work.job, begin, std::min(begin + work.chunkSize, work.count));
+            if (pending.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+    }
+
+    void workerLoop()
+    {
+        unsigned seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            // Woke up too late, the batch is already finished
+            if (pending == 0)
+                continue;
+            Batch work = batch;
+            active++;
+            lock.unlock();
+            runChunks(work);
+            lock.lock();
+            active--;
+            if (active == 0)
+                done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Batch batch;
+    std::atomic<size_t> next{ 0 };
+    std::atomic<size_t> pending{ 0 };
+    unsigned generation = 0;
+    int active = 0;
+    bool stopping = false;
+};
@@ -0,0 +1,457 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "png.h"
+
+// Just enough JPEG to load the textures in res/textures, with no libraries: baseline (sequential,
+// Huffman coded, 8 bit) greyscale or YCbCr with any chroma subsampling and restart markers.
+// Progressive and arithmetic coded files are turned down with a message, re-save them as
+// baseline. Chroma is upsampled by repeating it, which is plenty for textures.
+//
+// Images come out RGBA with the bottom row first, like readPng.
+namespace jpeg_detail
+{
+    inline const uint8_t ZIGZAG[64] = {
+        0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,
+        12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+        35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+        58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+    };
+
+    // Canonical Huffman codes: the codes of each length are consecutive, so decoding only needs
+    // the biggest code of each length and where its values start
+    struct HuffmanTable
+    {
+        int maxCode[18];
+        int valueOffset[17];
+        std::vector<uint8_t> values;
+        bool defined = false;
+
+        void build(const uint8_t* counts, const uint8_t* symbols)
+        {
+            int total = 0;
+            for (int length = 1; length <= 16; length++)
+                total += counts[length - 1];
+            values.assign(symbols, symbols + total);
+            int code = 0, index = 0;
+            for (int length = 1; length <= 16; length++)
+            {
+                valueOffset[length] = index - code;
+                code += counts[length - 1];
+                index += counts[length - 1];
+                maxCode[length] = counts[length - 1] ? code - 1 : -1;
+                code <<= 1;
+            }
+            // Stops decode() running off the end on a corrupt file
+            maxCode[17] = INT32_MAX;
+            defined = true;
+        }
+    };
+
+    struct Component
+    {
+        int id = 0;
+        int h = 1, v = 1;
+        int quantTable = 0;
+        int dcTable = 0, acTable = 0;
+        int dcPrediction = 0;
+        // Samples for the whole image, padded out to whole MCUs
+        int stride = 0;
+        std::vector<uint8_t> samples;
+    };
+
+    // Reads the entropy coded data a bit at a time, skipping the 0 stuffed after every 0xFF
+    struct BitReader
+    {
+        const uint8_t* data;
+        size_t size;
+        size_t position;
+        uint32_t bits = 0;
+        int count = 0;
+        // Hit a marker (or the end), everything after reads as 0
+        bool ended = false;
+
+        int bit()
+        {
+            if (count == 0)
+            {
+                uint8_t byte = 0;
+                if (!ended && position < size)
+                {
+                    byte = data[position];
+                    if (byte == 0xFF)
+                    {
+                        if (position + 1 < size && data[position + 1] == 0)
+                            position += 2;
+                        else
+                        {
+                            ended = true;
+                            byte = 0;
+                        }
+                    }
+                    else
+                        position++;
+                }
+                else
+                    ended = true;
+                bits = byte;
+                count = 8;
+            }
+            count--;
+            return (bits >> count) & 1;
+        }
+
+        int receive(int length)
+        {
+            int value = 0;
+            for (int i = 0; i < length; i++)
+                value = (value << 1) | bit();
+            return value;
+        }
+
+        // The top bit says which half of the range the value is in
+        int receiveExtend(int length)
+        {
+            if (length == 0)
+                return 0;
+            int value = receive(length);
+            return value < (1 << (length - 1)) ? value - (1 << length) + 1 : value;
+        }
+
+        int decode(const HuffmanTable& table)
+        {
+            int code = 0;
+            for (int length = 1; length <= 16; length++)
+            {
+                code = (code << 1) | bit();
+                if (code <= table.maxCode[length])
+                    return table.values[code + table.valueOffset[length]];
+            }
+            return -1;
+        }
+
+        // Lines up on the next byte and steps over a restart marker
+        void restart()
+        {
+            count = 0;
+            ended = false;
+            while (position + 1 < size && !(data[position] == 0xFF && data[position + 1] >= 0xD0 && data[position + 1] <= 0xD7))
+                position++;
+            position += 2;
+        }
+    };
+
+    // The 8x8 inverse DCT, done as rows then columns
+    inline void inverseDct(const float* in, uint8_t* out, int stride)
+    {
+        static const std::vector<float> cosines = [] {
+            std::vector<float> table(64);
+            for (int x = 0; x < 8; x++)
+                for (int u = 0; u < 8; u++)
+                    table[x * 8 + u] = (u == 0 ? sqrtf(0.5f) : 1.0f) * cosf((2.0f * x + 1.0f) * u * 3.14159265f / 16.0f);
+            return table;
+        }();
+        float rows[64];
+        for (int y = 0; y < 8; y++)
+            for (int x = 0; x < 8; x++)
+            {
+                float sum = 0.0f;
+                for (int u = 0; u < 8; u++)
+                    sum += cosines[x * 8 + u] * in[y * 8 + u];
+                rows[y * 8 + x] = sum * 0.5f;
+            }
+        for (int x = 0; x < 8; x++)
+            for (int y = 0; y < 8; y++)
+            {
+                float sum = 0.0f;
+                for (int v = 0; v < 8; v++)
+                    sum += cosines[y * 8 + v] * rows[v * 8 + x];
+                int value = (int)lrintf(sum * 0.5f + 128.0f);
+                out[y * stride + x] = (uint8_t)std::min(255, std::max(0, value));
+            }
+    }
+
+    inline uint16_t getBigEndian16(const uint8_t* bytes)
+    {
+        return (uint16_t)(bytes[0] << 8 | bytes[1]);
+    }
+}
+
+inline bool decodeJpeg(const uint8_t* file, size_t size, Image& image, const std::string& name = "JPEG")
+{
+    using namespace jpeg_detail;
+    if (size < 4 || file[0] != 0xFF || file[1] != 0xD8)
+    {
+        std::cerr << name << " isn't a JPEG" << std::endl;
+        return false;
+    }
+
+    uint16_t quantTables[4][64] = {};
+    HuffmanTable dcTables[4], acTables[4];
+    std::vector<Component> components;
+    int width = 0, height = 0, restartInterval = 0;
+    size_t position = 2;
+    for (;;)
+    {
+        // Markers can be padded with any number of 0xFF bytes
+        while (position < size && file[position] == 0xFF && position + 1 < size && file[position + 1] == 0xFF)
+            position++;
+        if (position + 4 > size || file[position] != 0xFF)
+        {
+            std::cerr << name << ": ran out before the image data" << std::endl;
+            return false;
+        }
+        uint8_t marker = file[position + 1];
+        size_t length = getBigEndian16(&file[position + 2]);
+        const uint8_t* body = &file[position + 4];
+        if (length < 2 || position + 2 + length > size)
+        {
+            std::cerr << name << ": a segment runs past the end" << std::endl;
+            return false;
+        }
+        size_t bodySize = length - 2;
+        position += 2 + length;
+
+        if (marker == 0xDB) // Quantisation tables
+        {
+            for (size_t i = 0; i < bodySize;)
+            {
+                int precision = body[i] >> 4, id = body[i] & 3;
+                i++;
+                for (int k = 0; k < 64 && i < bodySize; k++)
+                {
+                    quantTables[id][ZIGZAG[k]] = precision ? getBigEndian16(&body[i]) : body[i];
+                    i += precision ? 2 : 1;
+                }
+            }
+        }
+        else if (marker == 0xC4) // Huffman tables
+        {
+            for (size_t i = 0; i + 17 <= bodySize;)
+            {
+                int tableClass = body[i] >> 4, id = body[i] & 3;
+                const uint8_t* counts = &body[i + 1];
+                size_t total = 0;
+                for (int length = 0; length < 16; length++)
+                    total += counts[length];
+                if (i + 17 + total > bodySize)
+                    break;
+                (tableClass ? acTables : dcTables)[id].build(counts, &body[i + 17]);
+                i += 17 + total;
+            }
+        }
+        else if (marker == 0xC0 || marker == 0xC1) // Baseline and extended sequential frames
+        {
+            if (bodySize < 6 || body[0] != 8)
+            {
+                std::cerr << name << ": only 8 bit samples are supported" << std::endl;
+                return false;
+            }
+            height = getBigEndian16(&body[1]);
+            width = getBigEndian16(&body[3]);
+            int count = body[5];
+            if ((count != 1 && count != 3) || bodySize < 6 + (size_t)count * 3 || width == 0 || height == 0)
+            {
+                std::cerr << name << ": only greyscale and YCbCr images are supported" << std::endl;
+                return false;
+            }
+            components.resize(count);
+            for (int c = 0; c < count; c++)
+            {
+                const uint8_t* entry = &body[6 + c * 3];
+                components[c].id = entry[0];
+                components[c].h = std::max(1, entry[1] >> 4);
+                components[c].v = std::max(1, entry[1] & 15);
+                components[c].quantTable = entry[2] & 3;
+            }
+        }
+        else if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+        {
+            std::cerr << name << ": progressive, lossless and arithmetic coded JPEGs aren't supported, save it as baseline" << std::endl;
+            return false;
+        }
+        else if (marker == 0xDD && bodySize >= 2) // Restart interval
+        {
+            restartInterval = getBigEndian16(body);
+        }
+        else if (marker == 0xDA) // Start of scan, the image data follows
+        {
+            if (components.empty() || bodySize < 1)
+            {
+                std::cerr << name << ": image data before the frame header" << std::endl;
+                return false;
+            }
+            int count = body[0];
+            // Baseline images have one scan with every component in it
+            if (count != (int)components.size() || bodySize < 1 + (size_t)count * 2)
+            {
+                std::cerr << name << ": only single scan images are supported" << std::endl;
+                return false;
+            }
+            for (int c = 0; c < count; c++)
+            {
+                for (Component& component : components)
+                {
+                    if (component.id == body[1 + c * 2])
+                    {
+                        component.dcTable = body[2 + c * 2] >> 4 & 3;
+                        component.acTable = body[2 + c * 2] & 3;
+                    }
+                }
+            }
+            break;
+        }
+        else if (marker == 0xD9)
+        {
+            std::cerr << name << ": no image data" << std::endl;
+            return false;
+        }
+        // Anything else (APPn, comments) is skipped
+    }
+
+    int maxH = 1, maxV = 1;
+    for (const Component& component : components)
+    {
+        maxH = std::max(maxH, component.h);
+        maxV = std::max(maxV, component.v);
+        if (!dcTables[component.dcTable].defined || !acTables[component.acTable].defined)
+        {
+            std::cerr << name << ": missing Huffman tables" << std::endl;
+            return false;
+        }
+    }
+    int mcusX = (width + maxH * 8 - 1) / (maxH * 8);
+    int mcusY = (height + maxV * 8 - 1) / (maxV * 8);
+    // A single component isn't interleaved, its MCUs are just its 8x8 blocks
+    if (components.size() == 1)
+    {
+        components[0].h = components[0].v = maxH = maxV = 1;
+        mcusX = (width + 7) / 8;
+        mcusY = (height + 7) / 8;
+    }
+    for (Component& component : components)
+    {
+        component.stride = mcusX * component.h * 8;
+        component.samples.assign((size_t)component.stride * mcusY * component.v * 8, 0);
+    }
+
+    BitReader reader{ file, size, position };
+    float coefficients[64];
+    int mcusLeft = restartInterval;
+    for (int mcuY = 0; mcuY < mcusY; mcuY++)
+    {
+        for (int mcuX = 0; mcuX < mcusX; mcuX++)
+        {
+            if (restartInterval && mcusLeft-- == 0)
+            {
+                reader.restart();
+                for (Component& component : components)
+                    component.dcPrediction = 0;
+                mcusLeft = restartInterval - 1;
+            }
+            for (Component& component : components)
+            {
+                const HuffmanTable& dc = dcTables[component.dcTable];
+                const HuffmanTable& ac = acTables[component.acTable];
+                const uint16_t* quant = quantTables[component.quantTable];
+                for (int blockY = 0; blockY < component.v; blockY++)
+                {
+                    for (int blockX = 0; blockX < component.h; blockX++)
+                    {
+                        std::fill_n(coefficients, 64, 0.0f);
+                        int dcLength = reader.decode(dc);
+                        if (dcLength < 0)
+                        {
+                            std::cerr << name << ": corrupt image data" << std::endl;
+                            return false;
+                        }
+                        component.dcPrediction += reader.receiveExtend(dcLength);
+                        coefficients[0] = (float)(component.dcPrediction * quant[0]);
+                        for (int k = 1; k < 64;)
+                        {
+                            int symbol = reader.decode(ac);
+                            if (symbol < 0)
+                            {
+                                std::cerr << name << ": corrupt image data" << std::endl;
+                                return false;
+                            }
+                            int run = symbol >> 4, length = symbol & 15;
+                            if (length == 0)
+                            {
+                                // End of block, or a run of 16 zeros
+                                if (run != 15)
+                                    break;
+                                k += 16;
+                                continue;
+                            }
+                            k += run;
+                            if (k > 63)
+                                break;
+                            coefficients[ZIGZAG[k]] = (float)(reader.receiveExtend(length) * quant[ZIGZAG[k]]);
+                            k++;
+                        }
+                        int x = (mcuX * component.h + blockX) * 8;
+                        int y = (mcuY * component.v + blockY) * 8;
+                        inverseDct(coefficients, &component.samples[(size_t)y * component.stride + x], component.stride);
+                    }
+                }
+            }
+        }
+    }
+
+    image.width = width;
+    image.height = height;
+    image.rgba.resize((size_t)width * height * 4);
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t* out = image.pixel(0, height - 1 - y);
+        for (int x = 0; x < width; x++)
+        {
+            // Subsampled components cover more than one pixel each
+            auto sample = [&](const Component& component) {
+                return (float)component.samples[(size_t)(y * component.v / maxV) * component.stride + x * component.h / maxH];
+            };
+            float luma = sample(components[0]);
+            if (components.size() == 1)
+                out[x * 4] = out[x * 4 + 1] = out[x * 4 + 2] = (uint8_t)luma;
+            else
+            {
+                float cb = sample(components[1]) - 128.0f, cr = sample(components[2]) - 128.0f;
+                out[x * 4] = (uint8_t)std::min(255.0f, std::max(0.0f, luma + 1.402f * cr + 0.5f));
+                out[x * 4 + 1] = (uint8_t)std::min(255.0f, std::max(0.0f, luma - 0.344136f * cb - 0.714136f * cr + 0.5f));
+                out[x * 4 + 2] = (uint8_t)std::min(255.0f, std::max(0.0f, luma + 1.772f * cb + 0.5f));
+            }
+            out[x * 4 + 3] = 255;
+        }
+    }
+    return true;
+}
+
+inline bool readJpeg(const std::string& path, Image& image)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        std::cerr << "Couldn't open " << path << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    return decodeJpeg(file.data(), file.size(), image, path);
+}
+
+// Either kind, going by the extension
+inline bool readImage(const std::string& path, Image& image)
+{
+    std::string extension = path.substr(path.find_last_of('.') + 1);
+    for (char& c : extension)
+        c = (char)tolower((unsigned char)c);
+    if (extension == "jpg" || extension == "jpeg")
+        return readJpeg(path, image);
+    return readPng(path, image);
+}
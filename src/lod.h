@@ -0,0 +1,53 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "mesh_simplify.h"
+
+// Picking a level of detail from how big it ends up on screen.
+//
+// Each LOD knows roughly how far it strays from the full mesh (MeshLod::error, in the mesh's units).
+// Multiplied by how many pixels one unit covers at the object's distance, that's how many pixels
+// the LOD could be off by. The selector uses the coarsest LOD that stays under pixelError.
+//
+// Right at a threshold an object would flip between two LODs every frame as it moved or its size
+// wobbled, which shows up as popping. So moving to a coarser LOD needs the error to be comfortably
+// under (by the hysteresis fraction), while moving back to a finer one only happens once it's over.
+struct LodSettings
+{
+    float pixelError = 1.0f;
+    float hysteresis = 0.25f;
+};
+
+// Pixels covered by one world unit at a distance, for a perspective camera
+inline float pixelsPerUnit(float distance, float fovY, float viewportHeight)
+{
+    return viewportHeight / (2.0f * std::max(distance, 1e-4f) * tanf(fovY * 0.5f));
+}
+
+// The LOD to draw this frame, given the one drawn last frame
+inline uint32_t selectLod(const std::vector<MeshLod>& lods, uint32_t current, float pixelsPerMeshUnit, const LodSettings& settings = LodSettings())
+{
+    uint32_t lod = std::min(current, (uint32_t)lods.size() - 1);
+    while (lod > 0 && lods[lod].error * pixelsPerMeshUnit > settings.pixelError)
+        lod--;
+    while (lod + 1 < lods.size() && lods[lod + 1].error * pixelsPerMeshUnit <= settings.pixelError * (1.0f - settings.hysteresis))
+        lod++;
+    return lod;
+}
+
+// What got drawn, for comparing LODs on and off
+struct LodStats
+{
+    size_t frames = 0;
+    size_t triangles = 0;
+    double ms = 0.0;
+
+    void addFrame(size_t frameTriangles, double frameMs)
+    {
+        frames++;
+        triangles += frameTriangles;
+        ms += frameMs;
+    }
+};
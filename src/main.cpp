@@ -1,28 +1,90 @@
+#include <chrono>
+#include <cmath>
+#include <filesystem>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <glad/glad.h>
+#include <glad/glad_extras.h>
 #include <GLFW/glfw3.h>
+#include "allocation_tracker.h"
+#include "context_manager.h"
+#include "culling.h"
+#include "demo_geometry.h"
+#include "depth_passes.h"
+#include "frame_allocator.h"
+#include "frame_capture.h"
+#include "framebuffer.h"
+#include "gl_debug.h"
+#include "gl_features.h"
+#include "gl_objects.h"
+#include "geometry_buffer.h"
+#include "image_diff.h"
+#include "jpeg.h"
+#include "lod.h"
+#include "mesh.h"
+#include "mesh_simplify.h"
+#include "occlusion.h"
+#include "png.h"
+#include "readback.h"
+#include "shader.h"
+#include "shader_preprocessor.h"
+#include "shader_reload.h"
+#include "program_reflection.h"
+#include "shader_data.h"
+#include "sprite_batch.h"
+#include "uniform_buffer.h"
+#include "virtual_texture.h"
 
-// "method C++" from: http://insanecoding.blogspot.com/2011/11/how-to-read-in-file-in-c.html
-std::string get_file_contents(const char *filename)
+// Handles #include and feature defines in ./shaders, and caches the results
+ShaderPreprocessor shaderPreprocessor;
+
+// Rebuilds shader programs when files in ./shaders change
+ShaderReloader shaderReloader;
+
+// Variants of basic.vert + basic.frag, see BasicShaderFeatures
+ShaderPermutations basicShaders(shaderPreprocessor, "./shaders/basic.vert", "./shaders/basic.frag", basicShaderFeatures);
+
+// Uniform blocks for the object grid
+UniformBuffer<PerFrame> perFrameBuffer;
+UniformArrayBuffer<PerObject> perObjectBuffer;
+
+// Only the grid objects that are on screen get drawn
+FrustumCuller frustumCuller;
+BoundsArray objectBounds;
+std::vector<uint32_t> visibleObjects;
+
+// Meshes and their LODs for the LOD demo, L switches LOD selection on and off
+GeometryBuffer sharedGeometry;
+bool lodEnabled = true;
+LodStats lodOnStats, lodOffStats;
+
+// How the overdraw demo draws its opaque objects, P/F/O toggle the prepass, sorting and overdraw view
+DepthSettings depthSettings;
+// One per combination of the settings, so results never get mixed up when they change
+FragmentCounter fragmentCounters[8];
+// Occlusion culling for the overdraw demo, H switches it on and off. Frame times are kept for both.
+OcclusionCuller occlusionCuller;
+bool occlusionEnabled = true;
+double occlusionFrameMs[2] = {};
+size_t occlusionFrames[2] = {};
+// Whether the sprite demo draws from its atlas, A switches
+bool atlasEnabled = true;
+
+// Set while rendering headlessly at a fixed size (see runGoldenChecks), otherwise the window's size is used
+int captureWidth = 0;
+int captureHeight = 0;
+
+// The size of whatever is being drawn to
+void getFrameSize(int& width, int& height)
 {
-    std::ifstream in(filename, std::ios::in | std::ios::binary);
-    if (in)
+    if (captureWidth)
     {
-        std::string contents;
-        in.seekg(0, std::ios::end);
-        contents.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&contents[0], contents.size());
-        in.close();
-        return(contents);
-    }
-    else
-    {
-        std::cerr << "Failed to read " << filename << std::endl;
-        return "";
+        width = captureWidth;
+        height = captureHeight;
+        return;
     }
+    glfwGetFramebufferSize(glfwGetCurrentContext(), &width, &height);
 }
 
 void onWindowResize(GLFWwindow* window, int width, int height)
@@ -40,80 +102,40 @@ void onKey(GLFWwindow* window, int key, int scancode, int action, int mods)
             glfwSetWindowShouldClose(window, true);
         else if (key == GLFW_KEY_W) // Wireframe toggle
             glPolygonMode(GL_FRONT_AND_BACK, (wireframe = !wireframe) ? GL_LINE : GL_FILL);
+        else if (key == GLFW_KEY_L) // LOD toggle
+            lodEnabled = !lodEnabled;
+        else if (key == GLFW_KEY_P) // Depth prepass toggle
+            std::cout << "Depth prepass " << ((depthSettings.prepass = !depthSettings.prepass) ? "on" : "off") << std::endl;
+        else if (key == GLFW_KEY_F) // Front to back sorting toggle
+            std::cout << "Front to back sorting " << ((depthSettings.frontToBack = !depthSettings.frontToBack) ? "on" : "off") << std::endl;
+        else if (key == GLFW_KEY_O) // Overdraw view toggle
+            std::cout << "Overdraw view " << ((depthSettings.overdraw = !depthSettings.overdraw) ? "on" : "off") << std::endl;
+        else if (key == GLFW_KEY_H) // Occlusion culling toggle
+            std::cout << "Occlusion culling " << ((occlusionEnabled = !occlusionEnabled) ? "on" : "off") << std::endl;
+        else if (key == GLFW_KEY_A) // Sprite atlas toggle
+            std::cout << "Sprite atlas " << ((atlasEnabled = !atlasEnabled) ? "on" : "off") << std::endl;
     }
 }
 
-GLuint makeShaderProgram(const char* vertexShaderPath, const char* fragmentShaderPath)
+// Gets a variant of the basic shaders and keeps it up to date whenever its files are saved.
+// The program belongs to basicShaders, so hang on to the pointer rather than copying the handle,
+// otherwise you'd miss out on reloads.
+GLuint* loadBasicShader(uint32_t features)
 {
-    int success;
-    std::string infoLog;
-    int length;
-
-    // Create Vertex Shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    std::string vertexShaderString = get_file_contents(vertexShaderPath);
-    const GLchar* vertexShaderSource = vertexShaderString.c_str();
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Check for errors
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &length);
-        infoLog.resize(length);
-        glGetShaderInfoLog(vertexShader, length, NULL, &infoLog[0]);
-        std::cerr << "Vertex Shader failed to compile!" << std::endl << infoLog << std::endl;
-    }
-
-    // Create Fragment Shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    std::string fragmentShaderString = get_file_contents(fragmentShaderPath);
-    const GLchar* fragmentShaderSource = fragmentShaderString.c_str();
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Check for errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &length);
-        infoLog.resize(length);
-        glGetShaderInfoLog(fragmentShader, length, NULL, &infoLog[0]);
-        std::cerr << "Fragment Shader failed to compile!" << std::endl << infoLog << std::endl;
-    }
-
-    // Combine the Vertex Shader and Fragment Shader into a Shader Program
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-
-    // Check for linking errors
-    if (!success)
-    {
-        glGetProgramiv(shaderProgram, GL_INFO_LOG_LENGTH, &length);
-        infoLog.resize(length);
-        glGetProgramInfoLog(shaderProgram, length, NULL, &infoLog[0]);
-        std::cerr << "Shader Program linking failed!" << std::endl << infoLog << std::endl;
-    }
-
-    //Delete the shaders
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return shaderProgram;
+    GLuint& shaderProgram = basicShaders.get(features);
+    shaderReloader.watch(shaderProgram, basicShaders.vertexPath, basicShaders.fragmentPath, basicShaders.definesFor(features));
+    return &shaderProgram;
 }
 
-void setupHelloTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO) {
+void setupHelloTriangle(GLuint* &shaderProgram, GLVertexArray &VAO, GLBuffer &VBO) {
     // Load Shader Program
-    //shaderProgram = makeShaderProgram("./shaders/default.vert", "./shaders/colour_from_constant.frag");
-    //shaderProgram = makeShaderProgram("./shaders/colour_from_constant.vert", "./shaders/colour_from_vertex.frag");
-    shaderProgram = makeShaderProgram("./shaders/default.vert", "./shaders/colour_from_global.frag");
+    //shaderProgram = loadBasicShader(0); // Same as default.vert + colour_from_constant.frag
+    //shaderProgram = loadBasicShader(BASIC_VERTEX_COLOUR); // Like colour_from_constant.vert + colour_from_vertex.frag, but with a per vertex colour
+    shaderProgram = loadBasicShader(BASIC_GLOBAL_COLOUR); // Same as default.vert + colour_from_global.frag
 
     // Make and bind a Vertex Array Object to store vertex attribute state changes
-    glGenVertexArrays(1, &VAO);
+    // (replacing one from an earlier call deletes it)
+    VAO = GLVertexArray::create();
     glBindVertexArray(VAO);
 
     // Each row is the coordinate for a corner of the triangle followed by its colour
@@ -126,7 +148,7 @@ void setupHelloTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO) {
 
     // These verticies need to be sent to the graphics card, the way this is done is through a Vertex Buffer Object (VBO)
     // Create a single buffer and save the id
-    glGenBuffers(1, &VBO);
+    VBO = GLBuffer::create();
     // Bind the VBO for future operations, VBOs are type GL_ARRAY_BUFFER
     // You can operate on each type of buffer simultaneously
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
@@ -158,6 +180,10 @@ void setupHelloTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO) {
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
     glEnableVertexAttribArray(0);
 
+    // Names that show up in driver messages and debuggers (only in debug builds)
+    GL_DEBUG_LABEL(GL_VERTEX_ARRAY, VAO, "HelloTriangle VAO");
+    GL_DEBUG_LABEL(GL_BUFFER, VBO, "HelloTriangle VBO");
+
     // Unbind the VAO to stop storing the state changes
     glBindVertexArray(0);
 
@@ -165,18 +191,19 @@ void setupHelloTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO) {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void renderHelloTriangle(GLuint &shaderProgram, GLuint &VAO)
+void renderHelloTriangle(GLuint &shaderProgram, const GLVertexArray &VAO)
 {
+    // The uniform locations are looked up once per program, and rebuilt if the program gets reloaded
+    GL_DEBUG_GROUP("HelloTriangle");
+    static ProgramReflection uniforms;
     float timeValue = glfwGetTime();
     float greenValue = (sin(timeValue) / 2.0f) + 0.5f;
-    // Not sure if this is bad practice, but I made it static to save from having to get it multiple times
-    static int vertexColorLocation = glGetUniformLocation(shaderProgram, "ourColor");
 
     // Use the Shader Program
-    glUseProgram(shaderProgram);
+    uniforms.use(shaderProgram);
 
-    // Set the global colour
-    glUniform4f(vertexColorLocation, 0.0f, greenValue, 0.0f, 1.0f);
+    // Set the global colour, the name is hashed at compile time
+    uniforms.set("ourColor"_uniform, 0.0f, greenValue, 0.0f, 1.0f);
 
     // Restore vertex attribute state using VBO
     glBindVertexArray(VAO);
@@ -188,45 +215,39 @@ void renderHelloTriangle(GLuint &shaderProgram, GLuint &VAO)
     glBindVertexArray(0);
 }
 
-void setupHelloRectangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO, GLuint &EBO) {
-    shaderProgram = makeShaderProgram("./shaders/default.vert", "./shaders/colour_from_constant.frag");
+void setupHelloRectangle(GLuint* &shaderProgram, GLVertexArray &VAO, GLBuffer &VBO, GLBuffer &EBO) {
+    shaderProgram = loadBasicShader(0);
 
-    glGenVertexArrays(1, &VAO);
+    VAO = GLVertexArray::create();
     glBindVertexArray(VAO);
 
-    float vertices[] = {
-         0.5f,  0.5f, 0.0f,    // Top Right
-         0.5f, -0.5f, 0.0f, // Bottom Right
-        -0.5f, -0.5f, 0.0f, // Bottom Left
-        -0.5f,  0.5f, 0.0f  // Top Left
-    };
-
-    GLuint indices[] = {
-        0, 1, 3,// Top Right Triangle
-        1, 2, 3 // Bottom Left Triangle
-    };
-    //I noticed this uses clockwise, maybe should make it anti-clockwise?
+    // Four corners and two triangles' worth of indices, see demo_geometry.h
 
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
+    VBO = GLBuffer::create();
+    EBO = GLBuffer::create();
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(HELLO_RECTANGLE_VERTICES), HELLO_RECTANGLE_VERTICES, GL_STATIC_DRAW);
 
     // This time also make an element array buffer to say which vertices to use
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(HELLO_RECTANGLE_INDICES), HELLO_RECTANGLE_INDICES, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
     glEnableVertexAttribArray(0);
 
+    GL_DEBUG_LABEL(GL_VERTEX_ARRAY, VAO, "HelloRectangle VAO");
+    GL_DEBUG_LABEL(GL_BUFFER, VBO, "HelloRectangle VBO");
+    GL_DEBUG_LABEL(GL_BUFFER, EBO, "HelloRectangle EBO");
+
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
-void renderHelloRectangle(GLuint &shaderProgram, GLuint &VAO)
+void renderHelloRectangle(GLuint &shaderProgram, const GLVertexArray &VAO)
 {
+    GL_DEBUG_GROUP("HelloRectangle");
     glUseProgram(shaderProgram);
     glBindVertexArray(VAO);
 
@@ -236,25 +257,19 @@ void renderHelloRectangle(GLuint &shaderProgram, GLuint &VAO)
     glBindVertexArray(0);
 }
 
-void setupRGBTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO)
+void setupRGBTriangle(GLuint* &shaderProgram, GLVertexArray &VAO, GLBuffer &VBO)
 {
-    shaderProgram = makeShaderProgram("./shaders/colour_per_vertex.vert", "./shaders/colour_from_vertex.frag");
+    shaderProgram = loadBasicShader(BASIC_VERTEX_COLOUR);
 
-    glGenVertexArrays(1, &VAO);
+    VAO = GLVertexArray::create();
     glBindVertexArray(VAO);
 
-    // Each row is the coordinate for a corner of the triangle followed by its colour
-    float vertices[] = {
-        // Positions            //  Colours
-        -0.5f, -0.5f, 0.0f,     1.0f, 0.0f, 0.0f,   // Bottom Left
-         0.5f, -0.5f, 0.0f,     0.0f, 1.0f, 0.0f,   // Bottom Right
-         0.0f,  0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   // Top Centre
-    };
+    // Each vertex is the coordinate for a corner of the triangle followed by its colour, see demo_geometry.h
 
     // This is still the same
-    glGenBuffers(1, &VBO);
+    VBO = GLBuffer::create();
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(RGB_TRIANGLE_VERTICES), RGB_TRIANGLE_VERTICES, GL_STATIC_DRAW);
 
     // Can't use 0 for the width anymore, since no longer tightly packed
     // 6 * sizeof(float) is the stride, which is the distance between the data for each vertex
@@ -266,12 +281,16 @@ void setupRGBTriangle(GLuint &shaderProgram, GLuint &VAO, GLuint &VBO)
     glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
     glEnableVertexAttribArray(1);
 
+    GL_DEBUG_LABEL(GL_VERTEX_ARRAY, VAO, "RGBTriangle VAO");
+    GL_DEBUG_LABEL(GL_BUFFER, VBO, "RGBTriangle VBO");
+
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void renderRGBTriangle(GLuint &shaderProgram, GLuint &VAO)
+void renderRGBTriangle(GLuint &shaderProgram, const GLVertexArray &VAO)
 {
+    GL_DEBUG_GROUP("RGBTriangle");
     glUseProgram(shaderProgram);
     glBindVertexArray(VAO);
 
@@ -280,15 +299,883 @@ void renderRGBTriangle(GLuint &shaderProgram, GLuint &VAO)
     glBindVertexArray(0);
 }
 
-int main()
+// Lots of little triangles, each with its own position and colour in a uniform block
+const int OBJECT_GRID_SIZE = 32;
+
+void setupObjectGrid(GLuint* &shaderProgram, GLVertexArray &VAO, GLBuffer &VBO)
+{
+    shaderProgram = loadBasicShader(BASIC_OBJECT_BLOCK);
+
+    VAO = GLVertexArray::create();
+    glBindVertexArray(VAO);
+
+    // The same triangle as before, the shader moves and shrinks it into place
+    float vertices[] = {
+        -0.5f, -0.5f, 0.0f, // Bottom Left
+         0.5f, -0.5f, 0.0f, // Bottom Right
+         0.0f,  0.5f, 0.0f, // Top Centre
+    };
+
+    VBO = GLBuffer::create();
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glEnableVertexAttribArray(0);
+
+    GL_DEBUG_LABEL(GL_VERTEX_ARRAY, VAO, "ObjectGrid VAO");
+    GL_DEBUG_LABEL(GL_BUFFER, VBO, "ObjectGrid VBO");
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    perFrameBuffer.create("PerFrame");
+    perObjectBuffer.create(OBJECT_GRID_SIZE * OBJECT_GRID_SIZE, "PerObject");
+    objectBounds.resize(OBJECT_GRID_SIZE * OBJECT_GRID_SIZE);
+    // Room for everything to be visible, so culling never has to grow it mid frame
+    visibleObjects.reserve(OBJECT_GRID_SIZE * OBJECT_GRID_SIZE);
+}
+
+void renderObjectGrid(GLuint &shaderProgram, const GLVertexArray &VAO)
+{
+    GL_DEBUG_GROUP("ObjectGrid");
+    static ProgramReflection uniforms;
+    float timeValue = glfwGetTime();
+
+    perFrameBuffer.data.time = timeValue;
+    perFrameBuffer.data.tint = { 1.0f, (sinf(timeValue) / 4.0f) + 0.75f, 1.0f, 1.0f };
+    perFrameBuffer.upload(PER_FRAME_BINDING);
+
+    // Fill in every object's block, then send them all in one go
+    int count = OBJECT_GRID_SIZE * OBJECT_GRID_SIZE;
+    float cell = 2.0f / OBJECT_GRID_SIZE;
+    // The grid drifts side to side so part of it goes off screen and gets culled
+    float drift = 0.75f * sinf(timeValue * 0.5f);
+    for (int i = 0; i < count; i++)
+    {
+        int x = i % OBJECT_GRID_SIZE;
+        int y = i / OBJECT_GRID_SIZE;
+        PerObject& object = perObjectBuffer[i];
+        object.objectOffset = { -1.0f + (x + 0.5f) * cell + drift, -1.0f + (y + 0.5f) * cell, cell * (0.75f + 0.25f * sinf(timeValue + i)), 0.0f };
+        object.objectColour = { (float)x / OBJECT_GRID_SIZE, (float)y / OBJECT_GRID_SIZE, 0.5f, 1.0f };
+        // The triangle is 1 unit across before the shader scales it
+        float halfSize = object.objectOffset.z * 0.5f;
+        objectBounds.set(i, { object.objectOffset.x, object.objectOffset.y, 0.0f }, { halfSize, halfSize, 0.0f });
+    }
+    perObjectBuffer.upload(count);
+
+    // The grid is already in clip space, so the frustum is just the -1 to 1 cube
+    static const Frustum clipFrustum = Frustum::fromMatrix(identity());
+    frustumCuller.cull(clipFrustum, objectBounds, CullShape::Boxes, visibleObjects);
+
+    uniforms.use(shaderProgram);
+    glBindVertexArray(VAO);
+
+    // Each draw just points the PerObject block at its slice of the buffer
+    for (uint32_t i : visibleObjects)
+    {
+        perObjectBuffer.bind(i, PER_OBJECT_BINDING);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    glBindVertexArray(0);
+}
+
+// A grid of detailed spheres growing and shrinking, each drawn with the LOD that suits its size
+const int LOD_GRID_SIZE = 8;
+std::vector<uint32_t> sphereLods;
+
+void setupLodSpheres(GLuint* &shaderProgram)
+{
+    shaderProgram = loadBasicShader(BASIC_OBJECT_BLOCK);
+
+    // This is the "import": simplify once up front and keep every LOD in the shared buffers
+    auto start = std::chrono::steady_clock::now();
+    LodMesh sphere = buildLods(makeSphere(64, 128));
+    float buildMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Sphere LODs (built in " << buildMs << "ms):";
+    for (const MeshLod& lod : sphere.lods)
+        std::cout << " " << lod.indexCount / 3 << " triangles (error " << lod.error << ")";
+    std::cout << std::endl;
+
+    sharedGeometry.add(sphere);
+    sharedGeometry.upload("Shared geometry");
+    sphereLods.assign(LOD_GRID_SIZE * LOD_GRID_SIZE, 0);
+
+    perFrameBuffer.create("PerFrame");
+    perObjectBuffer.create(LOD_GRID_SIZE * LOD_GRID_SIZE, "PerObject");
+}
+
+void renderLodSpheres(GLuint &shaderProgram)
+{
+    GL_DEBUG_GROUP("LodSpheres");
+    static ProgramReflection uniforms;
+    float timeValue = glfwGetTime();
+
+    // Time since the last call is the whole frame, which is what the LODs are meant to bring down
+    static double lastTime = 0.0;
+    double frameMs = lastTime > 0.0 ? (timeValue - lastTime) * 1000.0 : 0.0;
+    lastTime = timeValue;
+
+    perFrameBuffer.data.time = timeValue;
+    perFrameBuffer.data.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+    perFrameBuffer.upload(PER_FRAME_BINDING);
+
+    int width, height;
+    getFrameSize(width, height);
+
+    int count = LOD_GRID_SIZE * LOD_GRID_SIZE;
+    float cell = 2.0f / LOD_GRID_SIZE;
+    const GeometryMesh& mesh = sharedGeometry.meshes[0];
+    for (int i = 0; i < count; i++)
+    {
+        int x = i % LOD_GRID_SIZE;
+        int y = i / LOD_GRID_SIZE;
+        float radius = cell * 0.5f * (0.05f + 0.95f * (0.5f + 0.5f * sinf(timeValue * 0.7f + i * 0.3f)));
+        PerObject& object = perObjectBuffer[i];
+        object.objectOffset = { -1.0f + (x + 0.5f) * cell, -1.0f + (y + 0.5f) * cell, radius, 0.0f };
+        object.objectColour = { 0.3f + 0.7f * x / LOD_GRID_SIZE, 0.3f + 0.7f * y / LOD_GRID_SIZE, 0.8f, 1.0f };
+        // The sphere is already in clip space, where one unit is half the window high
+        float pixelsPerMeshUnit = radius * height * 0.5f;
+        sphereLods[i] = lodEnabled ? selectLod(mesh.lods, sphereLods[i], pixelsPerMeshUnit) : 0;
+    }
+    perObjectBuffer.upload(count);
+
+    uniforms.use(shaderProgram);
+    sharedGeometry.bind();
+    size_t triangles = 0;
+    for (int i = 0; i < count; i++)
+    {
+        perObjectBuffer.bind(i, PER_OBJECT_BINDING);
+        sharedGeometry.draw(0, sphereLods[i]);
+        triangles += mesh.triangleCount(sphereLods[i]);
+    }
+    glBindVertexArray(0);
+
+    if (frameMs > 0.0)
+        (lodEnabled ? lodOnStats : lodOffStats).addFrame(triangles, frameMs);
+}
+
+// Lots of overlapping spheres at different depths, drawn offscreen and copied to the window.
+// The fragment counts show what the depth prepass and front to back sorting save, and the big
+// spheres double as occluders so the ones completely hidden behind them aren't drawn at all.
+const int OVERDRAW_SPHERE_COUNT = 300;
+// Spheres at least this big are drawn into the occlusion buffer
+const float OCCLUDER_MIN_RADIUS = 0.2f;
+size_t overdrawSphereMesh = 0;
+GLuint* depthOnlyProgram = nullptr;
+GLuint* overdrawProgram = nullptr;
+Framebuffer sceneTarget;
+// A rough sphere with its corners on the surface, so it's always inside the real one
+Mesh occluderSphere;
+std::vector<uint32_t> overdrawSpheres;
+
+void setupOverdrawScene(GLuint* &shaderProgram)
+{
+    shaderProgram = loadBasicShader(BASIC_OBJECT_BLOCK);
+    depthOnlyProgram = loadBasicShader(BASIC_OBJECT_BLOCK | BASIC_DEPTH_ONLY);
+    overdrawProgram = loadBasicShader(BASIC_OBJECT_BLOCK | BASIC_OVERDRAW);
+
+    overdrawSphereMesh = sharedGeometry.add(buildLods(makeSphere(16, 32), 1));
+    sharedGeometry.upload("Shared geometry");
+
+    perFrameBuffer.create("PerFrame");
+    perObjectBuffer.create(OVERDRAW_SPHERE_COUNT, "PerObject");
+    // Made in a random order, which is what drawing them unsorted gets
+    srand(1);
+    auto random = [] { return (float)rand() / RAND_MAX; };
+    for (int i = 0; i < OVERDRAW_SPHERE_COUNT; i++)
+    {
+        PerObject& object = perObjectBuffer[i];
+        object.objectOffset = { random() * 1.6f - 0.8f, random() * 1.6f - 0.8f, 0.05f + random() * 0.25f, random() * 1.2f - 0.6f };
+        object.objectColour = { random(), random(), random(), 1.0f };
+    }
+
+    occluderSphere = makeSphere(6, 12);
+    objectBounds.resize(OVERDRAW_SPHERE_COUNT);
+    overdrawSpheres.clear();
+    for (int i = 0; i < OVERDRAW_SPHERE_COUNT; i++)
+    {
+        const std140::vec4& offset = perObjectBuffer[i].objectOffset;
+        objectBounds.set(i, { offset.x, offset.y, offset.w }, { offset.z, offset.z, offset.z });
+        overdrawSpheres.push_back((uint32_t)i);
+    }
+    visibleObjects.reserve(OVERDRAW_SPHERE_COUNT);
+}
+
+void renderOverdrawScene(GLuint &shaderProgram)
+{
+    GL_DEBUG_GROUP("OverdrawScene");
+    int width, height;
+    getFrameSize(width, height);
+    if (!sceneTarget.resize(width, height))
+        return;
+
+    // Time since the last call is the whole frame, culling included
+    static double lastTime = 0.0;
+    double timeValue = glfwGetTime();
+    double frameMs = lastTime > 0.0 ? (timeValue - lastTime) * 1000.0 : 0.0;
+    lastTime = timeValue;
+    if (frameMs > 0.0)
+    {
+        occlusionFrameMs[occlusionEnabled] += frameMs;
+        occlusionFrames[occlusionEnabled]++;
+    }
+
+    // The spheres are already in clip space, so the camera is the identity
+    const std::vector<uint32_t>* drawn = &overdrawSpheres;
+    if (occlusionEnabled)
+    {
+        occlusionCuller.beginFrame(identity());
+        for (int i = 0; i < OVERDRAW_SPHERE_COUNT; i++)
+        {
+            const std140::vec4& offset = perObjectBuffer[i].objectOffset;
+            if (offset.z >= OCCLUDER_MIN_RADIUS)
+                occlusionCuller.addOccluder(occluderSphere.vertices, occluderSphere.indices.data(), occluderSphere.indices.size(),
+                    translation({ offset.x, offset.y, offset.w }) * scaling({ offset.z, offset.z, offset.z }));
+        }
+        occlusionCuller.buildPyramid();
+        occlusionCuller.cull(objectBounds, overdrawSpheres, visibleObjects);
+        occlusionCuller.endFrame();
+        drawn = &visibleObjects;
+    }
+
+    perFrameBuffer.data.time = timeValue;
+    perFrameBuffer.data.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+    perFrameBuffer.upload(PER_FRAME_BINDING);
+    perObjectBuffer.upload(OVERDRAW_SPHERE_COUNT);
+
+    // Nearest point of each sphere, smaller depth is closer. Only needed for this frame.
+    FrameVector<OpaqueDraw> opaqueDraws(FrameArena::local());
+    opaqueDraws.reserve(drawn->size());
+    for (uint32_t i : *drawn)
+        opaqueDraws.push_back({ perObjectBuffer[i].objectOffset.w - perObjectBuffer[i].objectOffset.z, i });
+    if (depthSettings.frontToBack)
+        sortFrontToBack(opaqueDraws);
+
+    sceneTarget.bind();
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    int mode = depthSettings.prepass | depthSettings.frontToBack << 1 | depthSettings.overdraw << 2;
+    drawOpaque(depthSettings, shaderProgram, *depthOnlyProgram, *overdrawProgram, [&](GLuint program) {
+        glUseProgram(program);
+        sharedGeometry.bind();
+        for (const OpaqueDraw& draw : opaqueDraws)
+        {
+            perObjectBuffer.bind(draw.object, PER_OBJECT_BINDING);
+            sharedGeometry.draw(overdrawSphereMesh, 0);
+        }
+        glBindVertexArray(0);
+    }, &fragmentCounters[mode]);
+    sceneTarget.blitToScreen(width, height);
+}
+
+// Lots of small sprites in a random order, drawn either each from its own texture or all from one
+// atlas, A switches between them. With their own textures nearly every sprite needs a bind and a
+// draw call of its own, from the atlas they all go in one. The photos in ./textures go in first,
+// then made up images arrive a few at a time over the first frames and are packed into the atlas
+// as they come, the way images loaded while the game's running would be.
+const int SPRITE_COUNT = 2000;
+const int STREAMED_SPRITE_IMAGES = 40;
+// A streamed image arrives this often, in seconds, so they've all arrived within a few frames
+const double SPRITE_ARRIVAL_INTERVAL = 0.003;
+// The photos are 512x512, so two of them with their padding need more than 1024
+const int SPRITE_ATLAS_SIZE = 2048;
+// The biggest a sprite is drawn, in pixels
+const float SPRITE_MAX_PIXELS = 64.0f;
+ShaderPermutations spriteShaders(shaderPreprocessor, "./shaders/sprite.vert", "./shaders/sprite.frag", {});
+SpriteBatch spriteBatch;
+TextureAtlas spriteAtlas;
+
+struct SpriteImage
+{
+    Image image;
+    // Its own texture, for drawing without the atlas
+    GLTexture texture;
+    // Where it is in the atlas, -1 until it's arrived
+    int atlasEntry = -1;
+};
+std::vector<SpriteImage> spriteImages;
+size_t arrivedSpriteImages = 0;
+
+struct Sprite
+{
+    float x, y;
+    uint32_t image;
+    uint32_t colour;
+};
+std::vector<Sprite> sprites;
+// Added up separately with the atlas off and on
+SpriteStats spriteTotals[2];
+size_t spriteFrames[2] = {};
+double spriteFrameMs[2] = {};
+
+// A made up image, some stripes, a checkerboard or a blob, in a couple of colours
+Image makeSpriteImage(int width, int height, int pattern, const uint8_t* colourA, const uint8_t* colourB)
+{
+    Image image;
+    image.width = width;
+    image.height = height;
+    image.rgba.resize((size_t)width * height * 4);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float u = (x + 0.5f) / width * 2.0f - 1.0f, v = (y + 0.5f) / height * 2.0f - 1.0f;
+            bool first = pattern == 0 ? (x / 4) % 2 == 0 : pattern == 1 ? (x / 8 + y / 8) % 2 == 0 : u * u + v * v < 0.7f;
+            memcpy(image.pixel(x, y), first ? colourA : colourB, 4);
+        }
+    }
+    return image;
+}
+
+void uploadSpriteTexture(SpriteImage& sprite)
+{
+    sprite.texture = GLTexture::create();
+    glBindTexture(GL_TEXTURE_2D, sprite.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, sprite.image.width, sprite.image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, sprite.image.rgba.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void setupSprites(GLuint* &shaderProgram)
+{
+    shaderProgram = &spriteShaders.get(0);
+    shaderReloader.watch(*shaderProgram, spriteShaders.vertexPath, spriteShaders.fragmentPath, {});
+
+    spriteAtlas.destroy();
+    spriteAtlas.reset(SPRITE_ATLAS_SIZE);
+    spriteImages.clear();
+    arrivedSpriteImages = 0;
+    for (const char* path : { "./textures/container.jpg", "./textures/wall.jpg" })
+    {
+        SpriteImage sprite;
+        if (readImage(path, sprite.image))
+            spriteImages.push_back(std::move(sprite));
+    }
+    size_t loaded = spriteImages.size();
+    srand(1);
+    for (int i = 0; i < STREAMED_SPRITE_IMAGES; i++)
+    {
+        uint8_t colours[2][4];
+        for (auto& colour : colours)
+            colour[0] = (uint8_t)rand(), colour[1] = (uint8_t)rand(), colour[2] = (uint8_t)rand(), colour[3] = 255;
+        SpriteImage sprite;
+        sprite.image = makeSpriteImage(16 + rand() % 49, 16 + rand() % 49, i % 3, colours[0], colours[1]);
+        spriteImages.push_back(std::move(sprite));
+    }
+    for (SpriteImage& sprite : spriteImages)
+        uploadSpriteTexture(sprite);
+    // The loaded ones are there from the start
+    for (; arrivedSpriteImages < loaded; arrivedSpriteImages++)
+        spriteImages[arrivedSpriteImages].atlasEntry = spriteAtlas.add("image" + std::to_string(arrivedSpriteImages), spriteImages[arrivedSpriteImages].image);
+    spriteAtlas.upload("Sprite atlas");
+
+    sprites.clear();
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        float x = (float)rand() / RAND_MAX * 2.0f - 1.0f, y = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        uint32_t tint = 0xFF000000u | (uint32_t)(0x808080 + rand() % 0x7F7F7F);
+        sprites.push_back({ x, y, (uint32_t)(rand() % spriteImages.size()), tint });
+    }
+    spriteBatch.create(SPRITE_COUNT);
+}
+
+void renderSprites(GLuint &shaderProgram)
+{
+    GL_DEBUG_GROUP("Sprites");
+    int width, height;
+    getFrameSize(width, height);
+
+    static double lastTime = 0.0;
+    double timeValue = glfwGetTime();
+    double frameMs = lastTime > 0.0 ? (timeValue - lastTime) * 1000.0 : 0.0;
+    lastTime = timeValue;
+
+    // Anything that's arrived since last frame goes in the atlas, and only those texels are sent
+    size_t arriving = std::min(spriteImages.size(), (size_t)(timeValue / SPRITE_ARRIVAL_INTERVAL) + spriteImages.size() - STREAMED_SPRITE_IMAGES);
+    for (; arrivedSpriteImages < arriving; arrivedSpriteImages++)
+    {
+        SpriteImage& sprite = spriteImages[arrivedSpriteImages];
+        sprite.atlasEntry = spriteAtlas.add("image" + std::to_string(arrivedSpriteImages), sprite.image);
+        if (sprite.atlasEntry < 0)
+            std::cerr << "Sprite atlas is full, image " << arrivedSpriteImages << " won't be drawn" << std::endl;
+    }
+    spriteAtlas.upload("Sprite atlas");
+
+    spriteBatch.begin(shaderProgram);
+    for (const Sprite& sprite : sprites)
+    {
+        const SpriteImage& image = spriteImages[sprite.image];
+        if (sprite.image >= arrivedSpriteImages || image.atlasEntry < 0)
+            continue;
+        // Same shape as the image, at most SPRITE_MAX_PIXELS across
+        float scale = std::min(1.0f, SPRITE_MAX_PIXELS / std::max(image.image.width, image.image.height));
+        float spriteWidth = image.image.width * scale * 2.0f / width, spriteHeight = image.image.height * scale * 2.0f / height;
+        if (atlasEnabled)
+            spriteBatch.draw(spriteAtlas.texture, sprite.x, sprite.y, spriteWidth, spriteHeight, spriteAtlas.entry(image.atlasEntry).uv, sprite.colour);
+        else
+            spriteBatch.draw(image.texture, sprite.x, sprite.y, spriteWidth, spriteHeight, UVRect(), sprite.colour);
+    }
+    spriteBatch.end();
+
+    spriteTotals[atlasEnabled].add(spriteBatch.stats);
+    spriteFrames[atlasEnabled]++;
+    if (frameMs > 0.0)
+        spriteFrameMs[atlasEnabled] += frameMs;
+}
+
+// A 4096x4096 made up image, far more than the memory it's allowed, drawn through a VirtualTexture
+// while the camera zooms in and out and wanders about. Only the tiles the view needs are loaded,
+// from a page file written to the temp folder the first time. Each frame a feedback pass draws
+// the view small to say which tiles it wants, and that comes back a couple of frames later.
+const int VIRTUAL_TEXTURE_SIZE = 4096;
+const uint32_t VIRTUAL_TILE_SIZE = 128;
+// Room for 100 tiles of the 1365 in the file, about 7% of the whole thing with its mips
+const size_t VIRTUAL_TEXTURE_BUDGET = 7 * 1024 * 1024;
+// The feedback pass is drawn this many times smaller each way, neighbouring pixels nearly always
+// want the same tile so not much is missed
+const int VIRTUAL_FEEDBACK_SCALE = 4;
+// Tiles uploaded each frame at most, so a sudden jump doesn't stall one frame with all of them
+const int VIRTUAL_UPLOADS_PER_FRAME = 8;
+ShaderPermutations virtualTextureShaders(shaderPreprocessor, "./shaders/virtual_texture.vert", "./shaders/virtual_texture.frag", { "FEEDBACK" });
+GLuint* virtualFeedbackProgram = nullptr;
+VirtualTexture virtualTexture;
+Framebuffer virtualFeedback;
+AsyncReadback virtualReadback;
+std::vector<uint8_t> virtualFeedbackPixels;
+// The shaders make their rectangle from gl_VertexID, but something still has to be bound
+GLVertexArray virtualTextureVAO;
+double virtualTextureSeconds = 0.0;
+
+// Cells of colour, each with a grid of lines finer than the last in it, so there's something new
+// to see at every zoom
+Image makeVirtualTextureImage(int size)
+{
+    Image image;
+    image.width = image.height = size;
+    image.rgba.resize((size_t)size * size * 4);
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            uint32_t cell = (uint32_t)(x / 256) * 7919u + (uint32_t)(y / 256) * 104729u;
+            cell ^= cell >> 7;
+            cell *= 0x9E3779B1u;
+            uint8_t* pixel = image.pixel(x, y);
+            pixel[0] = (uint8_t)(64 + (cell >> 8) % 160);
+            pixel[1] = (uint8_t)(64 + (cell >> 16) % 160);
+            pixel[2] = (uint8_t)(64 + (cell >> 24) % 160);
+            pixel[3] = 255;
+            for (int spacing = 64; spacing >= 4; spacing /= 4)
+            {
+                if (x % spacing == 0 || y % spacing == 0)
+                {
+                    for (int c = 0; c < 3; c++)
+                        pixel[c] = (uint8_t)(pixel[c] / 2);
+                    break;
+                }
+            }
+        }
+    }
+    return image;
+}
+
+void setupVirtualTexture(GLuint* &shaderProgram)
+{
+    shaderProgram = &virtualTextureShaders.get(0);
+    shaderReloader.watch(*shaderProgram, virtualTextureShaders.vertexPath, virtualTextureShaders.fragmentPath, virtualTextureShaders.definesFor(0));
+    virtualFeedbackProgram = &virtualTextureShaders.get(1);
+    shaderReloader.watch(*virtualFeedbackProgram, virtualTextureShaders.vertexPath, virtualTextureShaders.fragmentPath, virtualTextureShaders.definesFor(1));
+
+    std::string path = (std::filesystem::temp_directory_path() / "virtual_texture_demo.vtex").string();
+    std::error_code error;
+    if (!std::filesystem::exists(path, error))
+    {
+        std::cout << "Writing the virtual texture to " << path << std::endl;
+        VirtualTextureHeader header;
+        if (!writeVirtualTexture(path, makeVirtualTextureImage(VIRTUAL_TEXTURE_SIZE), header, VIRTUAL_TILE_SIZE))
+            return;
+    }
+    virtualTexture.create(path, VIRTUAL_TEXTURE_BUDGET, "Virtual texture");
+    virtualFeedback.destroy();
+    virtualReadback.destroy();
+    virtualTextureVAO = GLVertexArray::create();
+}
+
+void renderVirtualTexture(GLuint &shaderProgram)
+{
+    GL_DEBUG_GROUP("VirtualTexture");
+    if (!virtualTexture.slotCount())
+        return;
+    int width, height;
+    getFrameSize(width, height);
+
+    static double lastTime = 0.0;
+    double timeValue = glfwGetTime();
+    if (lastTime > 0.0 && timeValue > lastTime)
+        virtualTextureSeconds += timeValue - lastTime;
+    lastTime = timeValue;
+
+    // From the whole image down to 1/32 of it and back, wandering round as it goes
+    float zoom = 0.5f - 0.5f * cosf((float)timeValue * 0.4f);
+    float halfWidth = 0.5f * exp2f(-5.0f * zoom), halfHeight = halfWidth * height / width;
+    float centreX = 0.5f + 0.3f * zoom * cosf((float)timeValue * 0.23f), centreY = 0.5f + 0.3f * zoom * sinf((float)timeValue * 0.31f);
+    const VirtualTextureHeader& header = virtualTexture.header();
+    float virtualInfo[4] = { (float)header.size, (float)header.tilesAcross(0), (float)header.levels, 0.0f };
+
+    // What the feedback asked for a couple of frames ago, then whatever's finished loading since
+    while (virtualReadback.collect(virtualFeedbackPixels))
+        virtualTexture.processFeedback(virtualFeedbackPixels.data(), virtualFeedbackPixels.size() / 4);
+    virtualTexture.update(VIRTUAL_UPLOADS_PER_FRAME);
+
+    int feedbackWidth = std::max(1, width / VIRTUAL_FEEDBACK_SCALE), feedbackHeight = std::max(1, height / VIRTUAL_FEEDBACK_SCALE);
+    if (!virtualFeedback.framebuffer || feedbackWidth != virtualFeedback.width || feedbackHeight != virtualFeedback.height)
+    {
+        if (!virtualFeedback.create(feedbackWidth, feedbackHeight, false, "Virtual texture feedback"))
+            return;
+        virtualReadback.create(feedbackWidth, feedbackHeight, 3, "Virtual texture feedback");
+        virtualFeedbackPixels.reserve((size_t)feedbackWidth * feedbackHeight * 4);
+    }
+
+    static ProgramReflection feedbackUniforms, uniforms;
+    glBindVertexArray(virtualTextureVAO);
+    {
+        GL_DEBUG_GROUP("Feedback");
+        virtualFeedback.bind();
+        // Alpha 0 where nothing asks for anything
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        feedbackUniforms.use(*virtualFeedbackProgram);
+        feedbackUniforms.set("view"_uniform, centreX, centreY, halfWidth, halfHeight);
+        // Drawn smaller, so each pixel covers more texels and would ask for a coarser level
+        feedbackUniforms.set("virtualInfo"_uniform, virtualInfo[0], virtualInfo[1], virtualInfo[2], -log2f((float)VIRTUAL_FEEDBACK_SCALE));
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        virtualReadback.request(0, 0, feedbackWidth, feedbackHeight);
+        Framebuffer::unbind(width, height);
+    }
+
+    // Headless renders have to come out the same every time, so they wait for their own feedback
+    // and every tile it wants
+    if (captureWidth)
+    {
+        while (virtualReadback.collect(virtualFeedbackPixels, nullptr, nullptr, true))
+            virtualTexture.processFeedback(virtualFeedbackPixels.data(), virtualFeedbackPixels.size() / 4);
+        virtualTexture.finishLoads();
+    }
+
+    uniforms.use(shaderProgram);
+    uniforms.set("view"_uniform, centreX, centreY, halfWidth, halfHeight);
+    uniforms.set("virtualInfo"_uniform, virtualInfo[0], virtualInfo[1], virtualInfo[2], virtualInfo[3]);
+    uniforms.set("physicalInfo"_uniform, (float)header.tileSize, (float)header.border, 1.0f / virtualTexture.physicalSize(), (float)header.storedSize());
+    uniforms.set("physicalTexture"_uniform, 0);
+    uniforms.set("indirectionTexture"_uniform, 1);
+    virtualTexture.bind(0);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindVertexArray(0);
+}
+
+// Copies what the main window drew into source to every other window. Windows that have been
+// closed are destroyed along the way. Expects the main window's context to be current, and leaves
+// it current again.
+void presentViewports(ContextManager& contexts, std::vector<GLFWwindow*>& viewports, const Framebuffer& source)
+{
+    GLFWwindow* mainWindow = ContextManager::currentWindow();
+    // The other contexts mustn't read the texture until everything drawn into it has finished
+    GLsync drawn = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    for (size_t i = 0; i < viewports.size();)
+    {
+        GLFWwindow* viewport = viewports[i];
+        if (glfwWindowShouldClose(viewport))
+        {
+            contexts.destroy(viewport);
+            viewports.erase(viewports.begin() + i);
+            continue;
+        }
+        contexts.makeCurrent(viewport);
+        glWaitSync(drawn, 0, GL_TIMEOUT_IGNORED);
+        // The texture is shared but framebuffer objects aren't, so each window needs its own to read
+        // it through. Attached every frame, since resizing the main window makes a new texture.
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, contexts.framebuffer(&source));
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source.colourTexture, 0);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        int width, height;
+        glfwGetFramebufferSize(viewport, &width, &height);
+        glBlitFramebuffer(0, 0, source.width, source.height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glfwSwapBuffers(viewport);
+        i++;
+    }
+    contexts.makeCurrent(mainWindow);
+    glDeleteSync(drawn);
+}
+
+// Every demo by name, with the state main() keeps for it, so they can be rendered headlessly
+struct DemoState
+{
+    GLuint* shaderProgram = nullptr;
+    GLVertexArray VAO;
+    GLBuffer VBO;
+    GLBuffer EBO;
+};
+
+struct DemoScene
+{
+    const char* name;
+    void (*setup)(DemoState&);
+    void (*render)(DemoState&);
+};
+
+const DemoScene DEMO_SCENES[] = {
+    { "HelloTriangle", [](DemoState& s) { setupHelloTriangle(s.shaderProgram, s.VAO, s.VBO); }, [](DemoState& s) { renderHelloTriangle(*s.shaderProgram, s.VAO); } },
+    { "HelloRectangle", [](DemoState& s) { setupHelloRectangle(s.shaderProgram, s.VAO, s.VBO, s.EBO); }, [](DemoState& s) { renderHelloRectangle(*s.shaderProgram, s.VAO); } },
+    { "ObjectGrid", [](DemoState& s) { setupObjectGrid(s.shaderProgram, s.VAO, s.VBO); }, [](DemoState& s) { renderObjectGrid(*s.shaderProgram, s.VAO); } },
+    { "LodSpheres", [](DemoState& s) { setupLodSpheres(s.shaderProgram); }, [](DemoState& s) { renderLodSpheres(*s.shaderProgram); } },
+    { "OverdrawScene", [](DemoState& s) { setupOverdrawScene(s.shaderProgram); }, [](DemoState& s) { renderOverdrawScene(*s.shaderProgram); } },
+    { "Sprites", [](DemoState& s) { setupSprites(s.shaderProgram); }, [](DemoState& s) { renderSprites(*s.shaderProgram); } },
+    { "VirtualTexture", [](DemoState& s) { setupVirtualTexture(s.shaderProgram); }, [](DemoState& s) { renderVirtualTexture(*s.shaderProgram); } },
+    { "RGBTriangle", [](DemoState& s) { setupRGBTriangle(s.shaderProgram, s.VAO, s.VBO); }, [](DemoState& s) { renderRGBTriangle(*s.shaderProgram, s.VAO); } },
+};
+
+// The golden image checks render every demo at each of these sizes, with the clock stopped here
+const int GOLDEN_SIZES[][2] = { { 320, 240 }, { 800, 600 } };
+const double GOLDEN_TIME = 1.0;
+
+// Renders every demo offscreen and compares it with its golden image, goldenDir/<name>_<width>x<height>.png.
+// When one doesn't match, what was rendered and a diff image are saved next to it (.actual.png and
+// .diff.png). With update the renders are saved as the new golden images instead. The pixels come
+// back through AsyncReadback, so the next demo is drawing while the last one is being read.
+// A demo with no golden image counts as a failure too, with what it drew saved as .actual.png so it
+// can be looked over and kept, unless allowMissing says to just list it (for adding a new demo).
+// Returns how many didn't match or were missing.
+int runGoldenChecks(const std::string& goldenDir, bool update, bool allowMissing)
 {
+    AsyncReadback readback;
+    readback.create(GOLDEN_SIZES[1][0], GOLDEN_SIZES[1][1], 3, "Golden readback");
+    Framebuffer target;
+    std::vector<std::string> waiting;
+    int checked = 0, failed = 0;
+    std::vector<std::string> missing;
+
+    // Compares (or saves) the oldest read
+    auto finishOldest = [&](bool wait) {
+        Image actual;
+        if (!readback.collect(actual.rgba, &actual.width, &actual.height, wait))
+        {
+            // Dropped because it couldn't be read back, which is a failure as well
+            if (readback.pending() < waiting.size())
+            {
+                std::cerr << goldenDir << "/" << waiting.front() << ": couldn't read the render back" << std::endl;
+                waiting.erase(waiting.begin());
+                checked++;
+                failed++;
+            }
+            return false;
+        }
+        std::string name = waiting.front();
+        std::string path = goldenDir + "/" + name;
+        waiting.erase(waiting.begin());
+        std::error_code error;
+        if (!update && !std::filesystem::exists(path + ".png", error))
+        {
+            missing.push_back(name);
+            writePng(path + ".actual.png", actual);
+            return true;
+        }
+        checked++;
+        if (update)
+        {
+            failed += !writePng(path + ".png", actual);
+            return true;
+        }
+
+        Image expected, diff;
+        bool loaded = readPng(path + ".png", expected);
+        DiffResult result = loaded ? diffImages(expected, actual, DiffSettings(), &diff) : DiffResult();
+        if (result.matches)
+            return true;
+        failed++;
+        if (loaded && !result.sizeMatches)
+            std::cerr << path << ".png is " << expected.width << "x" << expected.height << ", not " << actual.width << "x" << actual.height << std::endl;
+        else if (loaded)
+            std::cerr << path << ".png: " << result.differentPixels << " pixels differ (biggest difference " << result.maxDifference << ")" << std::endl;
+        writePng(path + ".actual.png", actual);
+        if (result.sizeMatches && loaded)
+            writePng(path + ".diff.png", diff);
+        return true;
+    };
+
+    for (const DemoScene& scene : DEMO_SCENES)
+    {
+        DemoState state;
+        scene.setup(state);
+        for (const int* size : GOLDEN_SIZES)
+        {
+            int width = size[0], height = size[1];
+            if (!target.resize(width, height))
+                return -1;
+            captureWidth = width;
+            captureHeight = height;
+            Framebuffer::screen = target.framebuffer;
+            target.bind();
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            // Anything animated reads the time, so keep it the same for every run
+            glfwSetTime(GOLDEN_TIME);
+            scene.render(state);
+
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, target.framebuffer);
+            while (!readback.request(0, 0, width, height))
+                finishOldest(true);
+            waiting.push_back(std::string(scene.name) + "_" + std::to_string(width) + "x" + std::to_string(height));
+            while (finishOldest(false)) {}
+        }
+    }
+    while (readback.pending())
+        finishOldest(true);
+
+    Framebuffer::screen = 0;
+    captureWidth = captureHeight = 0;
+    target.destroy();
+    readback.destroy();
+    if (update)
+        std::cout << "Saved " << checked - failed << " golden images to " << goldenDir << std::endl;
+    else
+        std::cout << "Golden images: " << checked - failed << " of " << checked << " match" << std::endl;
+    if (!missing.empty())
+    {
+        std::cout << missing.size() << " with no golden image" << (allowMissing ? ", allowed" : "") << " (saved as .actual.png, --update to keep them):";
+        for (const std::string& name : missing)
+            std::cout << " " << name;
+        std::cout << std::endl;
+    }
+    return failed + (allowMissing ? 0 : (int)missing.size());
+}
+
+// The allocation checks let each demo settle for this many frames before counting
+const int ALLOCATION_WARMUP_FRAMES = 10;
+
+// Renders every demo offscreen for a few frames to warm up, then counts what this thread allocates
+// over the next frames. Once everything's been made a frame shouldn't allocate at all, anything per
+// frame goes in the FrameArena. Any demo that does is reported with how much.
+// Returns how many allocated.
+int runAllocationChecks(int frames)
+{
+    Framebuffer target;
+    if (!target.resize(GOLDEN_SIZES[1][0], GOLDEN_SIZES[1][1]))
+        return -1;
+    captureWidth = target.width;
+    captureHeight = target.height;
+    Framebuffer::screen = target.framebuffer;
+    int checked = 0, failed = 0;
+
+    for (const DemoScene& scene : DEMO_SCENES)
+    {
+        DemoState state;
+        scene.setup(state);
+        FrameAllocationStats stats;
+        for (int frame = 0; frame < ALLOCATION_WARMUP_FRAMES + frames; frame++)
+        {
+            if (frame == ALLOCATION_WARMUP_FRAMES)
+                stats.reset();
+            stats.beginFrame();
+            glfwSetTime(frame / 60.0);
+            target.bind();
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            scene.render(state);
+            // Otherwise the driver queues up frames until it runs out of room and has to wait anyway
+            glFinish();
+            FrameArena::resetAll();
+            stats.endFrame();
+        }
+        checked++;
+        if (stats.framesAllocating)
+        {
+            failed++;
+            std::cerr << scene.name << ": " << stats.framesAllocating << " of " << stats.frames << " frames allocated, "
+                << stats.totals.allocations << " allocations (" << stats.totals.bytes << " bytes), at most "
+                << stats.worst.allocations << " in one frame" << std::endl;
+        }
+        else
+            std::cout << scene.name << ": no allocations in " << stats.frames << " frames" << std::endl;
+    }
+
+    Framebuffer::screen = 0;
+    captureWidth = captureHeight = 0;
+    target.destroy();
+    std::cout << "Allocation checks: " << checked - failed << " of " << checked << " demos don't allocate once warmed up" << std::endl;
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    // --golden [folder] checks every demo against its golden image (see runGoldenChecks) and exits,
+    // --update as well saves new ones, --allow-missing doesn't fail on demos without one
+    const char* goldenDir = nullptr;
+    bool updateGolden = false, allowMissingGolden = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--golden") == 0)
+            goldenDir = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : "./golden";
+        else if (strcmp(argv[i], "--update") == 0)
+            updateGolden = true;
+        else if (strcmp(argv[i], "--allow-missing") == 0)
+            allowMissingGolden = true;
+    }
+
+    // --check-allocs [frames] checks that no demo allocates once it's warmed up (see
+    // runAllocationChecks) and exits
+    int allocationCheckFrames = 0;
+    for (int i = 1; i < argc; i++)
+        if (strcmp(argv[i], "--check-allocs") == 0)
+            allocationCheckFrames = i + 1 < argc && argv[i + 1][0] != '-' ? std::max(1, atoi(argv[++i])) : 100;
+    // Both of these render offscreen and exit
+    bool headless = goldenDir || allocationCheckFrames;
+
+    // --windows N opens N - 1 more windows showing the same picture as the main one, sharing its
+    // context (see ContextManager)
+    int windowCount = 1;
+    for (int i = 1; i + 1 < argc; i++)
+        if (strcmp(argv[i], "--windows") == 0)
+            windowCount = std::max(1, atoi(argv[i + 1]));
+
+    // --capture [folder] saves every frame (see FrameCapture) as --capture-format png, raw or y4m.
+    // Time moves on by exactly 1/--capture-fps a frame, however long saving takes, so the frames
+    // play back at the right speed. --capture-frames stops after that many.
+    const char* captureDir = nullptr;
+    CaptureFormat captureFormat = CaptureFormat::Png;
+    int captureFps = 60;
+    size_t captureFrameLimit = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--capture") == 0)
+            captureDir = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : "./capture";
+        else if (strcmp(argv[i], "--capture-format") == 0 && i + 1 < argc && !parseCaptureFormat(argv[++i], captureFormat))
+            std::cerr << "Unknown capture format " << argv[i] << ", use png, raw or y4m" << std::endl;
+        else if (strcmp(argv[i], "--capture-fps") == 0 && i + 1 < argc)
+            captureFps = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--capture-frames") == 0 && i + 1 < argc)
+            captureFrameLimit = (size_t)atoll(argv[++i]);
+    }
+
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    // Ask for a debug context so the driver reports errors and performance problems (debug builds only)
+    debugWindowHints();
+    glfwWindowHint(GLFW_DEPTH_BITS, 24);
+    // Every captured frame has to be the same size
+    glfwWindowHint(GLFW_RESIZABLE, captureDir ? GLFW_FALSE : GLFW_TRUE);
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "Hello You~", NULL, NULL);
+    // Nothing needs to be seen for the golden image or allocation checks
+    ContextManager contexts;
+    GLFWwindow* window = contexts.createWindow(800, 600, "Hello You~", !headless);
 
     if (window == NULL)
     {
@@ -298,7 +1185,10 @@ int main()
     }
 
     // Makes the created window the context for the current thread
-    glfwMakeContextCurrent(window);
+    contexts.makeCurrent(window);
+    // Time from here to the first frame on screen, to compare lazy and eager GL loading
+    auto contextStart = std::chrono::steady_clock::now();
+    bool firstFrame = true;
 
     // Load OpenGL functions for the OS
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
@@ -313,50 +1203,268 @@ int main()
     glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxVertexAttribs);
     std::cout << "Maximum number of vertex attributes supported: " << maxVertexAttribs << std::endl;
     // My computer had 16! (minimum)
+    // Which of the optional faster paths we can use
+    glFeatures.detect();
+    glFeatures.print();
+    setupDebugOutput();
+
+#ifdef GLAD_TRACE
+    // Record every GL call from here on, tools/gl_replay can play the capture back
+    gladTraceBegin("gl_capture.bin");
+#endif
 
     // This configures the viewport transform, which maps OpenGL's -1 to 1 world space to window coordinates
     // The transformation occurs just before OpenGL makes the fragments for the fragment shader
     glViewport(0, 0, 800, 600);
 
+    // Depth test everything. LEQUAL rather than LESS so flat things drawn at the same depth (all the
+    // 2D demos) still cover whatever was drawn before them.
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
+
     // Register handler for when window is resized to update the viewport
     glfwSetFramebufferSizeCallback(window, onWindowResize);
     glfwSetKeyCallback(window, onKey);
 
+    // Watch the shader folder so edits show up without restarting
+    shaderReloader.start("./shaders", shaderPreprocessor, &contexts);
+
+    // The golden image and allocation checks skip the render loop and go straight to cleaning up
+    int exitCode = 0;
+    if (goldenDir && runGoldenChecks(goldenDir, updateGolden, allowMissingGolden) != 0)
+        exitCode = 1;
+    if (allocationCheckFrames && runAllocationChecks(allocationCheckFrames) != 0)
+        exitCode = 1;
+    if (headless)
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+
     //Init
-    GLuint shaderProgram = 0;
-    GLuint VAO = 0;
-    GLuint VBO = 0;
-    GLuint EBO = 0;
+    GLuint* shaderProgram = nullptr;
+    GLVertexArray VAO;
+    GLBuffer VBO;
+    GLBuffer EBO;
     //setupHelloTriangle(shaderProgram, VAO, VBO);
     //setupHelloRectangle(shaderProgram, VAO, VBO, EBO);
+    //setupObjectGrid(shaderProgram, VAO, VBO);
+    //setupLodSpheres(shaderProgram);
+    //setupOverdrawScene(shaderProgram);
+    //setupSprites(shaderProgram);
+    //setupVirtualTexture(shaderProgram);
     setupRGBTriangle(shaderProgram, VAO, VBO);
 
+    // The other windows share everything the main one made, apart from VAOs and framebuffer objects
+    std::vector<GLFWwindow*> viewports;
+    for (int i = 1; i < windowCount && !headless; i++)
+    {
+        std::string title = "Viewport " + std::to_string(i + 1);
+        GLFWwindow* viewport = contexts.createWindow(400, 300, title.c_str());
+        if (!viewport)
+            break;
+        // Otherwise every window would wait for vsync in turn
+        contexts.makeCurrent(viewport);
+        glfwSwapInterval(0);
+        viewports.push_back(viewport);
+    }
+    contexts.makeCurrent(window);
+    // With other windows open the main one draws into this, and they all copy from it
+    Framebuffer viewportSource;
+
+    FrameCapture frameCapture;
+    if (captureDir && !headless)
+    {
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+        if (frameCapture.start(captureDir, captureFormat, width, height, captureFps))
+            std::cout << "Capturing " << width << "x" << height << " frames to " << captureDir << std::endl;
+    }
+
+    // What the render thread allocates each frame, which should be nothing once it's warmed up
+    FrameAllocationStats frameAllocations;
+
     // Main render loop
     while (!glfwWindowShouldClose(window))
     {
+        frameAllocations.beginFrame();
+        // Swap in any shader programs that finished rebuilding
+        shaderReloader.update();
+        if (frameCapture.active())
+            glfwSetTime((double)frameCapture.stats.captured / captureFps);
+
+        int windowWidth, windowHeight;
+        glfwGetFramebufferSize(window, &windowWidth, &windowHeight);
+        bool sharing = !viewports.empty() && viewportSource.resize(windowWidth, windowHeight);
+        if (sharing)
+        {
+            Framebuffer::screen = viewportSource.framebuffer;
+            viewportSource.bind();
+        }
+
         // Clear the frame buffer by filling it with a colour
         //glClearColor(0.5f, 0.0f, 0.5f, 1.0f);
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // Render Stuff goes here
-        //renderHelloTriangle(shaderProgram, VAO);
-        //renderHelloRectangle(shaderProgram, VAO);
-        renderRGBTriangle(shaderProgram, VAO);
+        //renderHelloTriangle(*shaderProgram, VAO);
+        //renderHelloRectangle(*shaderProgram, VAO);
+        //renderObjectGrid(*shaderProgram, VAO);
+        //renderLodSpheres(*shaderProgram);
+        //renderOverdrawScene(*shaderProgram);
+        //renderSprites(*shaderProgram);
+        //renderVirtualTexture(*shaderProgram);
+        renderRGBTriangle(*shaderProgram, VAO);
+
+        if (sharing)
+        {
+            Framebuffer::screen = 0;
+            viewportSource.blitToScreen(windowWidth, windowHeight);
+        }
+
+        // Saving the frame has to happen before the swap, after it the back buffer's contents are undefined
+        if (frameCapture.active())
+        {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+            frameCapture.captureFrame();
+            if (captureFrameLimit && frameCapture.stats.captured >= captureFrameLimit)
+                glfwSetWindowShouldClose(window, GLFW_TRUE);
+        }
+
+        if (sharing)
+            presentViewports(contexts, viewports, viewportSource);
 
         // Display what was rendered in the current loop
         glfwSwapBuffers(window);
+        shaderReloader.framePresented();
+#ifdef GLAD_TRACE
+        gladTraceFrame();
+#endif
+        if (firstFrame)
+        {
+            float startupMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - contextStart).count();
+            std::cout << "Context to first frame: " << startupMs << "ms (" << (gladIsLazy() ? "lazy" : "eager") << " loading, "
+                << gladResolvedCount() << " of " << gladFunctionCount() << " GL functions looked up)" << std::endl;
+            firstFrame = false;
+        }
 
         // Check for events that have been raised and runs the callbacks
         glfwPollEvents();
+
+        // Everything put in the frame arenas this frame is finished with
+        FrameArena::resetAll();
+        frameAllocations.endFrame();
+    }
+
+    if (frameCapture.active())
+    {
+        // Still has to wait for the last few frames to be read back and saved
+        auto stopStart = std::chrono::steady_clock::now();
+        frameCapture.stop();
+        const CaptureStats& stats = frameCapture.stats;
+        double frames = (double)std::max<size_t>(stats.captured, 1);
+        std::cout << "Capture: " << stats.written << " frames saved to " << captureDir << " (" << stats.failed << " failed), "
+            << stats.captureMs / frames << "ms per frame on the render thread, " << stats.encodeMs / frames << "ms per frame encoding, "
+            << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stopStart).count() << "ms to finish at exit" << std::endl;
+    }
+#ifdef GLAD_TRACE
+    gladTracePrintFrame(10);
+    gladTraceEnd();
+#endif
+    printDebugSummary();
+    if (frameAllocations.frames)
+        std::cout << "Allocations: " << frameAllocations.framesAllocating << " of " << frameAllocations.frames << " frames allocated, "
+            << (double)frameAllocations.totals.allocations / frameAllocations.frames << " allocations (" << (double)frameAllocations.totals.bytes / frameAllocations.frames
+            << " bytes) per frame, at most " << frameAllocations.worst.allocations << " in one frame, frame arena peak " << FrameArena::local().peakBytes() << " bytes" << std::endl;
+    std::cout << "Uniform uploads: " << uniformStats.issued << " issued, " << uniformStats.skipped << " skipped (unchanged)" << std::endl;
+    if (frustumCuller.frames)
+    {
+        double frames = (double)frustumCuller.frames;
+        std::cout << "Frustum culling, per frame: " << frustumCuller.totals.tested / frames << " tested, "
+            << frustumCuller.totals.culled() / frames << " culled, " << frustumCuller.totals.ms / frames << "ms" << std::endl;
+    }
+    for (const LodStats* stats : { &lodOnStats, &lodOffStats })
+    {
+        if (stats->frames)
+            std::cout << "LOD " << (stats == &lodOnStats ? "on" : "off") << ": " << stats->triangles / stats->frames << " triangles per frame, "
+                << stats->ms / stats->frames << "ms per frame (" << stats->frames << " frames)" << std::endl;
+    }
+    for (int mode = 0; mode < 8; mode++)
+    {
+        const FragmentCounter& counter = fragmentCounters[mode];
+        if (counter.frames)
+            std::cout << "Prepass " << (mode & 1 ? "on" : "off") << ", front to back " << (mode & 2 ? "on" : "off")
+                << (mode & 4 ? ", overdraw view" : "") << ": " << counter.totalFragments / counter.frames << " fragments shaded per frame ("
+                << counter.frames << " frames, " << counter.skipped << " not counted)" << std::endl;
+    }
+    if (occlusionCuller.frames)
+    {
+        double frames = (double)occlusionCuller.frames;
+        const OcclusionStats& totals = occlusionCuller.totals;
+        std::cout << "Occlusion culling, per frame: " << totals.occluderTriangles / frames << " occluder triangles, " << totals.tested / frames << " tested, "
+            << totals.occluded / frames << " occluded, " << (totals.rasterMs + totals.pyramidMs + totals.testMs) / frames << "ms (raster "
+            << totals.rasterMs / frames << "ms, pyramid " << totals.pyramidMs / frames << "ms, test " << totals.testMs / frames << "ms)" << std::endl;
+    }
+    for (int enabled = 1; enabled >= 0; enabled--)
+    {
+        if (occlusionFrames[enabled])
+            std::cout << "Occlusion culling " << (enabled ? "on" : "off") << ": " << occlusionFrameMs[enabled] / occlusionFrames[enabled]
+                << "ms per frame (" << occlusionFrames[enabled] << " frames)" << std::endl;
+    }
+    if (spriteAtlas.count())
+        std::cout << "Sprite atlas: " << spriteAtlas.count() << " images, " << spriteAtlas.occupancy() * 100.0 << "% images, "
+            << spriteAtlas.packedOccupancy() * 100.0 << "% used with their padding, " << spriteAtlas.uploadedTexels << " texels uploaded" << std::endl;
+    for (int enabled = 1; enabled >= 0; enabled--)
+    {
+        if (spriteFrames[enabled])
+        {
+            double frames = (double)spriteFrames[enabled];
+            std::cout << "Sprite atlas " << (enabled ? "on" : "off") << ": " << spriteTotals[enabled].sprites / frames << " sprites, "
+                << spriteTotals[enabled].drawCalls / frames << " draw calls, " << spriteTotals[enabled].textureBinds / frames << " texture binds, "
+                << spriteFrameMs[enabled] / frames << "ms per frame (" << spriteFrames[enabled] << " frames)" << std::endl;
+        }
+    }
+    if (spriteFrames[0] && spriteFrames[1] && spriteTotals[1].drawCalls)
+        std::cout << "Sprite atlas: " << ((double)spriteTotals[0].drawCalls / spriteFrames[0]) / ((double)spriteTotals[1].drawCalls / spriteFrames[1])
+            << "x fewer draw calls" << std::endl;
+
+    if (virtualTexture.stats.feedbackFrames)
+    {
+        const VirtualTextureStats& stats = virtualTexture.stats;
+        double frames = (double)stats.feedbackFrames, megabytes = stats.uploadedBytes / (1024.0 * 1024.0);
+        std::cout << "Virtual texture: " << stats.hitRate() * 100.0 << "% of " << stats.requested / frames << " tiles wanted per frame already there, "
+            << stats.uploads << " tiles uploaded (" << megabytes << "MB, " << (virtualTextureSeconds > 0.0 ? megabytes / virtualTextureSeconds : 0.0) << "MB/s, "
+            << stats.uploadMs / frames << "ms per frame), " << stats.evictions << " evicted, " << stats.dropped << " loads dropped" << std::endl;
+        std::cout << "Virtual texture memory: " << virtualTexture.residentBytes / 1024 << "KB of a " << virtualTexture.budgetBytes / 1024 << "KB budget for "
+            << virtualTexture.fullBytes() / 1024 << "KB of tiles, " << virtualTexture.residentTiles() << " of " << virtualTexture.slotCount() << " slots full, "
+            << stats.overBudget << " uploads put off because the view wanted more than fits" << std::endl;
     }
 
     // Clean up
-    if (VAO) glDeleteVertexArrays(1, &VAO);
-    if (VBO) glDeleteBuffers(1, &VBO);
-    if (EBO) glDeleteBuffers(1, &EBO);
-    if (shaderProgram) glDeleteProgram(shaderProgram);
+    for (GLFWwindow* viewport : viewports)
+        contexts.destroy(viewport);
+    contexts.makeCurrent(window);
+    viewportSource.destroy();
+    shaderReloader.stop();
+    // These would otherwise be deleted after glfwTerminate, with no context left
+    VAO.reset();
+    VBO.reset();
+    EBO.reset();
+    perFrameBuffer.destroy();
+    perObjectBuffer.destroy();
+    sharedGeometry.destroy();
+    sceneTarget.destroy();
+    spriteBatch.destroy();
+    spriteAtlas.destroy();
+    spriteImages.clear();
+    virtualTexture.destroy();
+    virtualFeedback.destroy();
+    virtualReadback.destroy();
+    virtualTextureVAO.reset();
+    for (FragmentCounter& counter : fragmentCounters)
+        counter.destroy();
+    basicShaders.clear();
+    spriteShaders.clear();
+    virtualTextureShaders.clear();
     //glfwDestroyWindow(window); // glfwTerminate() should destroy all windows so this isn't really needed
     glfwTerminate();
-    return 0;
+    return exitCode;
 }
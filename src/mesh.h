@@ -0,0 +1,116 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "simd_math.h"
+
+// Triangles over shared vertices. Only positions for now, which is all the simplifier and the
+// basic shaders need.
+struct Mesh
+{
+    std::vector<Vec3> vertices;
+    std::vector<uint32_t> indices;
+
+    size_t triangleCount() const
+    {
+        return indices.size() / 3;
+    }
+};
+
+// A sphere of radius 1 made of rings of quads, with one vertex at each pole and no seam, so it's
+// closed all the way round
+inline Mesh makeSphere(int rings, int segments)
+{
+    Mesh mesh;
+    const float PI = 3.14159265f;
+    mesh.vertices.push_back({ 0.0f, 1.0f, 0.0f });
+    for (int ring = 1; ring < rings; ring++)
+    {
+        float phi = PI * ring / rings;
+        for (int segment = 0; segment < segments; segment++)
+        {
+            float theta = 2.0f * PI * segment / segments;
+            mesh.vertices.push_back({ sinf(phi) * cosf(theta), cosf(phi), sinf(phi) * sinf(theta) });
+        }
+    }
+    mesh.vertices.push_back({ 0.0f, -1.0f, 0.0f });
+    uint32_t bottom = (uint32_t)mesh.vertices.size() - 1;
+
+    auto ringVertex = [&](int ring, int segment) { return (uint32_t)(1 + (ring - 1) * segments + segment % segments); };
+    for (int segment = 0; segment < segments; segment++)
+    {
+        // Anticlockwise from outside
+        mesh.indices.insert(mesh.indices.end(), { 0, ringVertex(1, segment + 1), ringVertex(1, segment) });
+        for (int ring = 1; ring < rings - 1; ring++)
+        {
+            uint32_t a = ringVertex(ring, segment), b = ringVertex(ring, segment + 1);
+            uint32_t c = ringVertex(ring + 1, segment), d = ringVertex(ring + 1, segment + 1);
+            mesh.indices.insert(mesh.indices.end(), { a, b, c, b, d, c });
+        }
+        mesh.indices.insert(mesh.indices.end(), { bottom, ringVertex(rings - 1, segment), ringVertex(rings - 1, segment + 1) });
+    }
+    return mesh;
+}
+
+// Reads the positions and faces out of a Wavefront .obj, splitting polygons into fans. Texture
+// coordinates and normals are skipped, so vertices that only differed by those end up shared.
+inline bool loadObj(const char* path, Mesh& mesh)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        std::cerr << "Failed to read " << path << std::endl;
+        return false;
+    }
+    mesh = Mesh();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+        std::istringstream words(line);
+        std::string type;
+        words >> type;
+        if (type == "v")
+        {
+            Vec3 v;
+            words >> v.x >> v.y >> v.z;
+            mesh.vertices.push_back(v);
+        }
+        else if (type == "f")
+        {
+            // Each corner is v, v/vt, v//vn or v/vt/vn, and negative numbers count back from the end
+            std::vector<uint32_t> corners;
+            std::string corner;
+            while (words >> corner)
+            {
+                long index = std::strtol(corner.c_str(), nullptr, 10);
+                index = index < 0 ? (long)mesh.vertices.size() + index : index - 1;
+                if (index < 0 || index >= (long)mesh.vertices.size())
+                {
+                    std::cerr << path << ":" << lineNumber << ": face uses a vertex that doesn't exist" << std::endl;
+                    return false;
+                }
+                corners.push_back((uint32_t)index);
+            }
+            for (size_t i = 2; i < corners.size(); i++)
+                mesh.indices.insert(mesh.indices.end(), { corners[0], corners[i - 1], corners[i] });
+        }
+    }
+    return true;
+}
+
+// Radius of a sphere around the origin that holds every vertex
+inline float boundingRadius(const std::vector<Vec3>& vertices)
+{
+    float radius = 0.0f;
+    for (Vec3 v : vertices)
+        radius = std::max(radius, length(v));
+    return radius;
+}
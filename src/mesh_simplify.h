@@ -0,0 +1,306 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include "mesh.h"
+#include "simd_math.h"
+
+// Mesh simplification with quadric error metrics (Garland & Heckbert), and the LOD chains built from it.
+//
+// Every vertex keeps a quadric: the sum of the squared distances to the planes of the triangles
+// around it, weighted by their area. Collapsing an edge merges one end into the other and adds their
+// quadrics together, so the quadric always measures how far the vertex is from the original surface
+// it now stands in for. Edges are collapsed cheapest first until there are few enough triangles.
+//
+// Collapses always move a vertex onto one of its neighbours rather than to a new position, so every
+// LOD can index the original vertex buffer and only needs its own indices.
+
+// A 4x4 symmetric matrix kept as its 10 distinct entries. Doubles, because the terms get large and
+// the differences between them small.
+struct Quadric
+{
+    double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+    // Total area that went in, to turn the cost back into a distance
+    double weight = 0;
+
+    // The plane ax + by + cz + d = 0, with (a, b, c) normalised
+    static Quadric fromPlane(double a, double b, double c, double d, double weight)
+    {
+        Quadric q;
+        q.a2 = a * a * weight; q.ab = a * b * weight; q.ac = a * c * weight; q.ad = a * d * weight;
+        q.b2 = b * b * weight; q.bc = b * c * weight; q.bd = b * d * weight;
+        q.c2 = c * c * weight; q.cd = c * d * weight;
+        q.d2 = d * d * weight;
+        q.weight = weight;
+        return q;
+    }
+
+    Quadric& operator+=(const Quadric& q)
+    {
+        a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+        b2 += q.b2; bc += q.bc; bd += q.bd;
+        c2 += q.c2; cd += q.cd;
+        d2 += q.d2;
+        weight += q.weight;
+        return *this;
+    }
+
+    // Area weighted sum of squared distances from p to the planes
+    double evaluate(Vec3 p) const
+    {
+        double x = p.x, y = p.y, z = p.z;
+        return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+             + b2 * y * y + 2 * bc * y * z + 2 * bd * y
+             + c2 * z * z + 2 * cd * z
+             + d2;
+    }
+};
+
+struct SimplifyResult
+{
+    std::vector<uint32_t> indices;
+    // Roughly how far the surface moved, in the mesh's units (the worst collapse's RMS distance from
+    // the planes it replaced)
+    float error = 0.0f;
+};
+
+// Collapses edges until there are at most targetTriangles left, or nothing more can go without the
+// error passing maxError. Border edges are held in place by extra planes standing up from them.
+inline SimplifyResult simplifyMesh(const std::vector<Vec3>& vertices, const std::vector<uint32_t>& indices, size_t targetTriangles, float maxError = FLT_MAX)
+{
+    // How strongly borders resist being moved, compared to the surface itself
+    const double BORDER_WEIGHT = 10.0;
+
+    size_t triangleCount = indices.size() / 3;
+    std::vector<uint32_t> triangles = indices;
+    std::vector<bool> triangleAlive(triangleCount, true);
+    std::vector<std::vector<uint32_t>> vertexTriangles(vertices.size());
+    std::vector<Quadric> quadrics(vertices.size());
+
+    auto faceNormal = [&](uint32_t a, uint32_t b, uint32_t c) {
+        return cross(vertices[b] - vertices[a], vertices[c] - vertices[a]);
+    };
+
+    // Each undirected edge, and how many triangles use it. Borders are the ones with only one.
+    std::unordered_map<uint64_t, uint32_t> edges;
+    auto edgeKey = [](uint32_t a, uint32_t b) { return a < b ? (uint64_t)a << 32 | b : (uint64_t)b << 32 | a; };
+
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        uint32_t* corner = &triangles[t * 3];
+        Vec3 normal = faceNormal(corner[0], corner[1], corner[2]);
+        float doubleArea = length(normal);
+        if (doubleArea > 0.0f)
+        {
+            normal = normal * (1.0f / doubleArea);
+            Quadric plane = Quadric::fromPlane(normal.x, normal.y, normal.z, -dot(normal, vertices[corner[0]]), doubleArea * 0.5);
+            for (int i = 0; i < 3; i++)
+                quadrics[corner[i]] += plane;
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            vertexTriangles[corner[i]].push_back((uint32_t)t);
+            edges[edgeKey(corner[i], corner[(i + 1) % 3])]++;
+        }
+    }
+
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        uint32_t* corner = &triangles[t * 3];
+        Vec3 normal = normalize(faceNormal(corner[0], corner[1], corner[2]));
+        for (int i = 0; i < 3; i++)
+        {
+            uint32_t a = corner[i], b = corner[(i + 1) % 3];
+            if (edges[edgeKey(a, b)] != 1)
+                continue;
+            Vec3 edge = vertices[b] - vertices[a];
+            Vec3 side = normalize(cross(edge, normal));
+            Quadric border = Quadric::fromPlane(side.x, side.y, side.z, -dot(side, vertices[a]), dot(edge, edge) * BORDER_WEIGHT);
+            // Only the plane matters here, not the area
+            border.weight = 0;
+            quadrics[a] += border;
+            quadrics[b] += border;
+        }
+    }
+
+    // Candidate collapses, cheapest first. The versions go up whenever a vertex changes, so entries
+    // that were pushed before then can be spotted and thrown away when they come off the queue.
+    struct Collapse
+    {
+        double cost;
+        uint32_t from, to;
+        uint32_t fromVersion, toVersion;
+
+        bool operator>(const Collapse& other) const
+        {
+            return cost > other.cost;
+        }
+    };
+    std::vector<uint32_t> versions(vertices.size(), 0);
+    std::vector<bool> vertexAlive(vertices.size(), true);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue;
+
+    auto collapseCost = [&](uint32_t from, uint32_t to) {
+        Quadric merged = quadrics[from];
+        merged += quadrics[to];
+        return std::max(0.0, merged.evaluate(vertices[to]));
+    };
+    // Whichever way round is cheaper
+    auto pushEdge = [&](uint32_t a, uint32_t b) {
+        double ab = collapseCost(a, b), ba = collapseCost(b, a);
+        if (ab <= ba)
+            queue.push({ ab, a, b, versions[a], versions[b] });
+        else
+            queue.push({ ba, b, a, versions[b], versions[a] });
+    };
+    for (const auto& edge : edges)
+        pushEdge((uint32_t)(edge.first >> 32), (uint32_t)edge.first);
+
+    std::vector<uint32_t> fromNeighbours, toNeighbours;
+    auto neighbours = [&](uint32_t v, std::vector<uint32_t>& out) {
+        out.clear();
+        for (uint32_t t : vertexTriangles[v])
+            if (triangleAlive[t])
+                for (int i = 0; i < 3; i++)
+                    if (triangles[t * 3 + i] != v)
+                        out.push_back(triangles[t * 3 + i]);
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    };
+
+    SimplifyResult result;
+    size_t aliveTriangles = triangleCount;
+    while (aliveTriangles > targetTriangles && !queue.empty())
+    {
+        Collapse collapse = queue.top();
+        queue.pop();
+        uint32_t from = collapse.from, to = collapse.to;
+        if (!vertexAlive[from] || !vertexAlive[to] || collapse.fromVersion != versions[from] || collapse.toVersion != versions[to])
+            continue;
+        Quadric merged = quadrics[from];
+        merged += quadrics[to];
+        float error = merged.weight > 0.0 ? (float)sqrt(collapse.cost / merged.weight) : 0.0f;
+        if (error > maxError)
+            break;
+
+        // Only collapse if the neighbourhood stays a proper surface: the two ends should share no
+        // neighbours apart from the corners of the triangles on the edge itself
+        neighbours(from, fromNeighbours);
+        neighbours(to, toNeighbours);
+        size_t shared = 0, edgeTriangles = 0;
+        for (uint32_t v : fromNeighbours)
+            shared += std::binary_search(toNeighbours.begin(), toNeighbours.end(), v);
+        for (uint32_t t : vertexTriangles[from])
+        {
+            if (!triangleAlive[t])
+                continue;
+            const uint32_t* corner = &triangles[t * 3];
+            edgeTriangles += corner[0] == to || corner[1] == to || corner[2] == to;
+        }
+        if (shared != edgeTriangles)
+            continue;
+
+        // And no triangle that survives gets turned inside out
+        bool flips = false;
+        for (uint32_t t : vertexTriangles[from])
+        {
+            const uint32_t* corner = &triangles[t * 3];
+            if (!triangleAlive[t] || corner[0] == to || corner[1] == to || corner[2] == to)
+                continue;
+            uint32_t moved[3] = { corner[0], corner[1], corner[2] };
+            for (uint32_t& v : moved)
+                if (v == from)
+                    v = to;
+            if (dot(faceNormal(corner[0], corner[1], corner[2]), faceNormal(moved[0], moved[1], moved[2])) <= 0.0f)
+            {
+                flips = true;
+                break;
+            }
+        }
+        if (flips)
+            continue;
+
+        for (uint32_t t : vertexTriangles[from])
+        {
+            if (!triangleAlive[t])
+                continue;
+            uint32_t* corner = &triangles[t * 3];
+            if (corner[0] == to || corner[1] == to || corner[2] == to)
+            {
+                triangleAlive[t] = false;
+                aliveTriangles--;
+                continue;
+            }
+            for (int i = 0; i < 3; i++)
+                if (corner[i] == from)
+                    corner[i] = to;
+            vertexTriangles[to].push_back(t);
+        }
+        vertexTriangles[from].clear();
+        vertexAlive[from] = false;
+        quadrics[to] = merged;
+        versions[to]++;
+        result.error = std::max(result.error, error);
+
+        // Everything touching the vertex that stayed has a new cost now
+        neighbours(to, toNeighbours);
+        for (uint32_t v : toNeighbours)
+            pushEdge(to, v);
+    }
+
+    for (size_t t = 0; t < triangleCount; t++)
+        if (triangleAlive[t])
+            result.indices.insert(result.indices.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+    return result;
+}
+
+// One level of detail: a range of a LodMesh's indices
+struct MeshLod
+{
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    // How far this LOD strays from the full mesh, in the mesh's units. 0 for the full mesh.
+    float error;
+};
+
+// A mesh with every LOD's indices one after the other over the same vertices, finest first
+struct LodMesh
+{
+    std::vector<Vec3> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<MeshLod> lods;
+    float radius = 0.0f;
+};
+
+// Makes up to lodCount LODs, each with about `reduction` times the triangles of the one before.
+// Each is simplified from the last, which is much quicker than starting from the full mesh every
+// time, so the errors are added up to stay on the safe side. Stops early once the mesh won't get
+// any smaller.
+inline LodMesh buildLods(const Mesh& mesh, int lodCount = 5, float reduction = 0.5f)
+{
+    LodMesh lodMesh;
+    lodMesh.vertices = mesh.vertices;
+    lodMesh.indices = mesh.indices;
+    lodMesh.lods.push_back({ 0, (uint32_t)mesh.indices.size(), 0.0f });
+    lodMesh.radius = boundingRadius(mesh.vertices);
+
+    std::vector<uint32_t> previous = mesh.indices;
+    float error = 0.0f;
+    for (int lod = 1; lod < lodCount; lod++)
+    {
+        size_t previousTriangles = previous.size() / 3;
+        SimplifyResult simplified = simplifyMesh(mesh.vertices, previous, (size_t)(previousTriangles * reduction));
+        size_t triangles = simplified.indices.size() / 3;
+        if (triangles > previousTriangles * 0.9 || triangles < 4)
+            break;
+        error += simplified.error;
+        lodMesh.lods.push_back({ (uint32_t)lodMesh.indices.size(), (uint32_t)simplified.indices.size(), error });
+        lodMesh.indices.insert(lodMesh.indices.end(), simplified.indices.begin(), simplified.indices.end());
+        previous = std::move(simplified.indices);
+    }
+    return lodMesh;
+}
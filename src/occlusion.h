@@ -0,0 +1,256 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "culling.h"
+#include "job_system.h"
+#include "simd_math.h"
+#include "software_rasteriser.h"
+
+// Occlusion culling against a hierarchical depth buffer (Hi-Z), all on the CPU.
+//
+// A few big, simple occluders (walls, terrain, simplified versions of large objects) are drawn into
+// a small depth buffer with the SoftwareRasteriser (depth only). Then a pyramid is built over it where each texel holds the farthest depth of the 2x2 texels under it. An object
+// is hidden if the nearest point of its bounding box is behind the farthest occluder depth over the
+// area it covers on screen, which only takes a handful of texels from the right pyramid level.
+//
+// Doing it on the CPU means no waiting on the GPU to read the depth buffer back, and no compute
+// shaders, which GL 3.3 doesn't have. Occluders have to sit inside the objects they stand in for
+// (e.g. a mesh with vertices on the surface of a sphere) or things behind them get wrongly culled.
+//
+// Depths are 0 (near) to 1 (far), the same as the GL depth buffer with the default depth range.
+struct OcclusionStats
+{
+    size_t occluderTriangles = 0;
+    size_t tested = 0;
+    size_t occluded = 0;
+    double rasterMs = 0.0;
+    double pyramidMs = 0.0;
+    double testMs = 0.0;
+};
+
+class OcclusionCuller
+{
+public:
+    // Starts a new frame: clears the depth buffer to far and remembers the camera
+    void beginFrame(const Mat4& viewProjection, int width = 256, int height = 128)
+    {
+        if (width != this->width || height != this->height)
+        {
+            this->width = width;
+            this->height = height;
+            rasteriser.resize(width, height, false);
+        }
+        rasteriser.clearDepth();
+        occluderPositions.clear();
+        occluderIndices.clear();
+        this->viewProjection = viewProjection;
+        frameStats = OcclusionStats();
+        frameStart = std::chrono::steady_clock::now();
+    }
+
+    // Queues an occluder's triangles to be drawn into the depth buffer by buildPyramid()
+    void addOccluder(const std::vector<Vec3>& vertices, const uint32_t* indices, size_t indexCount, const Mat4& model)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Mat4 transform = viewProjection * model;
+        uint32_t firstVertex = (uint32_t)occluderPositions.size();
+        for (const Vec3& vertex : vertices)
+            occluderPositions.push_back(combineColumns(transform, { vertex.x, vertex.y, vertex.z, 1.0f }));
+        for (size_t i = 0; i < indexCount; i++)
+            occluderIndices.push_back(firstVertex + indices[i]);
+        frameStats.rasterMs += msSince(start);
+    }
+
+    // Draws the occluders and builds the pyramid. Call after the last addOccluder() and before
+    // testing anything.
+    void buildPyramid(JobSystem* jobs = nullptr)
+    {
+        rasteriser.drawTriangles(occluderPositions.data(), nullptr, occluderIndices.data(), occluderIndices.size(), jobs);
+        frameStats.occluderTriangles += rasteriser.stats.triangles;
+        frameStats.rasterMs += rasteriser.stats.setupMs + rasteriser.stats.rasterMs;
+
+        auto start = std::chrono::steady_clock::now();
+        // The levels are kept from frame to frame and only remade when the size changes, so
+        // building the pyramid doesn't allocate
+        if (levels.empty() || levels[0].width != width || levels[0].height != height)
+        {
+            levels.clear();
+            int levelWidth = width, levelHeight = height;
+            for (;;)
+            {
+                levels.push_back({ levelWidth, levelHeight, std::vector<float>((size_t)levelWidth * levelHeight) });
+                if (levelWidth == 1 && levelHeight == 1)
+                    break;
+                levelWidth = (levelWidth + 1) / 2;
+                levelHeight = (levelHeight + 1) / 2;
+            }
+        }
+        for (int y = 0; y < height; y++)
+            std::copy_n(rasteriser.depth() + (size_t)y * rasteriser.rowStride(), width, &levels[0].depth[(size_t)y * width]);
+
+        for (size_t i = 1; i < levels.size(); i++)
+        {
+            const Level& below = levels[i - 1];
+            Level& level = levels[i];
+            for (int y = 0; y < level.height; y++)
+            {
+                int y0 = y * 2, y1 = std::min(y * 2 + 1, below.height - 1);
+                for (int x = 0; x < level.width; x++)
+                {
+                    int x0 = x * 2, x1 = std::min(x * 2 + 1, below.width - 1);
+                    level.depth[(size_t)y * level.width + x] = std::max(std::max(below.at(x0, y0), below.at(x1, y0)), std::max(below.at(x0, y1), below.at(x1, y1)));
+                }
+            }
+        }
+        frameStats.pyramidMs += msSince(start);
+    }
+
+    // Could anything inside the box be seen past the occluders?
+    bool isVisible(Vec3 center, Vec3 extent) const
+    {
+        // Project the corners to find the box's rectangle on screen and its nearest depth
+        // The corners are the centre plus or minus each axis, which only need transforming once
+        Vec4 clipCenter = combineColumns(viewProjection, { center.x, center.y, center.z, 1.0f });
+        Vec4 axisX = viewProjection.columns[0] * extent.x;
+        Vec4 axisY = viewProjection.columns[1] * extent.y;
+        Vec4 axisZ = viewProjection.columns[2] * extent.z;
+        float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, nearest = FLT_MAX;
+        for (int corner = 0; corner < 8; corner++)
+        {
+            Vec4 clip = clipCenter + (corner & 1 ? axisX : axisX * -1.0f) + (corner & 2 ? axisY : axisY * -1.0f) + (corner & 4 ? axisZ : axisZ * -1.0f);
+            // Part of the box is behind the camera, so it could cover anything
+            if (clip.w < NEAR_W)
+                return true;
+            Vec3 screen = toScreen(clip);
+            minX = std::min(minX, screen.x); maxX = std::max(maxX, screen.x);
+            minY = std::min(minY, screen.y); maxY = std::max(maxY, screen.y);
+            nearest = std::min(nearest, screen.z);
+        }
+        if (levels.empty() || maxX < 0.0f || maxY < 0.0f || minX > width || minY > height)
+            return true;
+
+        int x0 = std::max(0, (int)minX), x1 = std::min(width - 1, (int)maxX);
+        int y0 = std::max(0, (int)minY), y1 = std::min(height - 1, (int)maxY);
+        // The level where the rectangle is at most 2 texels across in each direction
+        int size = std::max(x1 - x0, y1 - y0);
+        int levelIndex = 0;
+        while ((size >> levelIndex) > 1 && levelIndex + 1 < (int)levels.size())
+            levelIndex++;
+        const Level& level = levels[levelIndex];
+
+        float farthest = 0.0f;
+        for (int y = y0 >> levelIndex; y <= (y1 >> levelIndex); y++)
+            for (int x = x0 >> levelIndex; x <= (x1 >> levelIndex); x++)
+                farthest = std::max(farthest, level.at(x, y));
+        return nearest <= farthest;
+    }
+
+    // Keeps the candidates (e.g. what frustum culling let through) that aren't hidden, in order
+    void cull(const BoundsArray& bounds, const std::vector<uint32_t>& candidates, std::vector<uint32_t>& visible, JobSystem* jobs = nullptr)
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto test = [&](size_t begin, size_t end, std::vector<uint32_t>& out) {
+            for (size_t i = begin; i < end; i++)
+            {
+                uint32_t object = candidates[i];
+                if (isVisible({ bounds.centerX[object], bounds.centerY[object], bounds.centerZ[object] },
+                              { bounds.extentX[object], bounds.extentY[object], bounds.extentZ[object] }))
+                    out.push_back(object);
+            }
+        };
+        visible.clear();
+        if (!jobs || candidates.size() <= TEST_CHUNK)
+        {
+            test(0, candidates.size(), visible);
+        }
+        else
+        {
+            size_t chunks = (candidates.size() + TEST_CHUNK - 1) / TEST_CHUNK;
+            if (chunkResults.size() < chunks)
+                chunkResults.resize(chunks);
+            jobs->parallelFor(candidates.size(), TEST_CHUNK, [&](size_t begin, size_t end) {
+                std::vector<uint32_t>& result = chunkResults[begin / TEST_CHUNK];
+                result.clear();
+                test(begin, end, result);
+            });
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+                visible.insert(visible.end(), chunkResults[chunk].begin(), chunkResults[chunk].end());
+        }
+        frameStats.tested += candidates.size();
+        frameStats.occluded += candidates.size() - visible.size();
+        frameStats.testMs += msSince(start);
+    }
+
+    // Everything for the frame is done, adds it to the totals. Returns the whole frame's time in ms.
+    double endFrame()
+    {
+        totals.occluderTriangles += frameStats.occluderTriangles;
+        totals.tested += frameStats.tested;
+        totals.occluded += frameStats.occluded;
+        totals.rasterMs += frameStats.rasterMs;
+        totals.pyramidMs += frameStats.pyramidMs;
+        totals.testMs += frameStats.testMs;
+        frames++;
+        stats = frameStats;
+        return msSince(frameStart);
+    }
+
+    // The depth buffer after the occluders were drawn, rowStride() floats per row, for debugging
+    const float* depth() const
+    {
+        return rasteriser.depth();
+    }
+
+    int rowStride() const
+    {
+        return rasteriser.rowStride();
+    }
+
+    // The last finished frame, and everything added up since the start
+    OcclusionStats stats;
+    OcclusionStats totals;
+    size_t frames = 0;
+
+private:
+    struct Level
+    {
+        int width, height;
+        std::vector<float> depth;
+
+        float at(int x, int y) const
+        {
+            return depth[(size_t)y * width + x];
+        }
+    };
+
+    // Anything closer to the camera than this (in clip space w) is treated as crossing the near plane
+    static constexpr float NEAR_W = 1e-5f;
+    static constexpr size_t TEST_CHUNK = 1024;
+
+    static double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Pixels across and up from the bottom left, and depth from 0 to 1
+    Vec3 toScreen(const Vec4& clip) const
+    {
+        float inverseW = 1.0f / clip.w;
+        return { (clip.x * inverseW * 0.5f + 0.5f) * width, (clip.y * inverseW * 0.5f + 0.5f) * height, clip.z * inverseW * 0.5f + 0.5f };
+    }
+
+    int width = 0;
+    int height = 0;
+    SoftwareRasteriser rasteriser;
+    std::vector<Vec4> occluderPositions;
+    std::vector<uint32_t> occluderIndices;
+    std::vector<Level> levels;
+    Mat4 viewProjection = identity();
+    std::vector<std::vector<uint32_t>> chunkResults;
+    OcclusionStats frameStats;
+    std::chrono::steady_clock::time_point frameStart;
+};
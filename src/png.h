@@ -0,0 +1,563 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Just enough PNG to save screenshots and load them back for comparing, with no libraries.
+//  - Writes 8 bit RGBA, picking a filter per row and compressing with fixed Huffman codes
+//  - Reads 8 bit RGB and RGBA (not interlaced), which covers anything saved from here or by
+//    the usual image editors with default settings
+//
+// Images are RGBA with the bottom row first, the same as glReadPixels gives them, and get flipped
+// on the way to and from the file.
+struct Image
+{
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> rgba;
+
+    uint8_t* pixel(int x, int y)
+    {
+        return &rgba[((size_t)y * width + x) * 4];
+    }
+
+    const uint8_t* pixel(int x, int y) const
+    {
+        return &rgba[((size_t)y * width + x) * 4];
+    }
+};
+
+namespace png_detail
+{
+    inline uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0)
+    {
+        static const std::vector<uint32_t> table = [] {
+            std::vector<uint32_t> values(256);
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t c = i;
+                for (int bit = 0; bit < 8; bit++)
+                    c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                values[i] = c;
+            }
+            return values;
+        }();
+        crc = ~crc;
+        for (size_t i = 0; i < length; i++)
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    inline uint32_t adler32(const uint8_t* data, size_t length)
+    {
+        // 5552 bytes is the most that can be added up before b could overflow, so only take the
+        // remainder once per block rather than every byte
+        uint32_t a = 1, b = 0;
+        while (length > 0)
+        {
+            size_t block = std::min<size_t>(length, 5552);
+            for (size_t i = 0; i < block; i++)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += block;
+            length -= block;
+        }
+        return b << 16 | a;
+    }
+
+    inline void putBigEndian(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.insert(out.end(), { (uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value });
+    }
+
+    inline uint32_t getBigEndian(const uint8_t* data)
+    {
+        return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+    }
+
+    // Deflate writes its bits from the lowest up, apart from Huffman codes which go highest bit first
+    struct BitWriter
+    {
+        std::vector<uint8_t>& out;
+        uint32_t buffer = 0;
+        int count = 0;
+
+        void bits(uint32_t value, int length)
+        {
+            buffer |= value << count;
+            count += length;
+            while (count >= 8)
+            {
+                out.push_back((uint8_t)buffer);
+                buffer >>= 8;
+                count -= 8;
+            }
+        }
+
+        void code(uint32_t value, int length)
+        {
+            uint32_t reversed = 0;
+            for (int i = 0; i < length; i++)
+                reversed |= ((value >> i) & 1) << (length - 1 - i);
+            bits(reversed, length);
+        }
+
+        void flush()
+        {
+            if (count > 0)
+                out.push_back((uint8_t)buffer);
+            buffer = 0;
+            count = 0;
+        }
+    };
+
+    // Lengths 3 to 258 and distances 1 to 32768 as a code plus extra bits, from the deflate spec
+    const uint16_t LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const uint8_t LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const uint16_t DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const uint8_t DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    // A literal byte or end of block (256) with the fixed Huffman codes, reversed once up front
+    // rather than a bit at a time for every symbol
+    inline void writeLiteral(BitWriter& writer, int symbol)
+    {
+        struct Code { uint16_t bits; uint8_t length; };
+        static const std::vector<Code> codes = [] {
+            std::vector<Code> table(288);
+            for (int i = 0; i < 288; i++)
+            {
+                uint32_t value = i < 144 ? 0x30 + i : i < 256 ? 0x190 + i - 144 : i < 280 ? i - 256 : 0xC0 + i - 280;
+                int length = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+                uint32_t reversed = 0;
+                for (int bit = 0; bit < length; bit++)
+                    reversed |= ((value >> bit) & 1) << (length - 1 - bit);
+                table[i] = { (uint16_t)reversed, (uint8_t)length };
+            }
+            return table;
+        }();
+        writer.bits(codes[symbol].bits, codes[symbol].length);
+    }
+
+    // zlib stream of the data as one fixed Huffman block. Matches are found with a hash of the next
+    // 3 bytes, keeping only the latest position for each, which is plenty for screenshots.
+    inline std::vector<uint8_t> zlibCompress(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> out = { 0x78, 0x01 };
+        BitWriter writer{ out };
+        writer.bits(1, 1); // Last block
+        writer.bits(1, 2); // Fixed Huffman codes
+
+        const size_t HASH_SIZE = 1 << 15;
+        std::vector<int64_t> lastSeen(HASH_SIZE, -1);
+        auto hashAt = [&](size_t i) { return ((data[i] << 10) ^ (data[i + 1] << 5) ^ data[i + 2]) & (HASH_SIZE - 1); };
+        size_t i = 0;
+        while (i < data.size())
+        {
+            size_t length = 0, distance = 0;
+            if (i + 3 <= data.size())
+            {
+                size_t hash = hashAt(i);
+                int64_t candidate = lastSeen[hash];
+                lastSeen[hash] = (int64_t)i;
+                if (candidate >= 0 && i - candidate <= 32768)
+                {
+                    size_t limit = std::min<size_t>(258, data.size() - i);
+                    while (length < limit && data[candidate + length] == data[i + length])
+                        length++;
+                    distance = i - candidate;
+                }
+            }
+            if (length < 3)
+            {
+                writeLiteral(writer, data[i]);
+                i++;
+                continue;
+            }
+
+            int lengthCode = 28;
+            while (LENGTH_BASE[lengthCode] > length)
+                lengthCode--;
+            writeLiteral(writer, 257 + lengthCode);
+            writer.bits((uint32_t)(length - LENGTH_BASE[lengthCode]), LENGTH_EXTRA[lengthCode]);
+            int distanceCode = 29;
+            while (DISTANCE_BASE[distanceCode] > distance)
+                distanceCode--;
+            writer.code(distanceCode, 5);
+            writer.bits((uint32_t)(distance - DISTANCE_BASE[distanceCode]), DISTANCE_EXTRA[distanceCode]);
+            // Keep the hash table going through the match so later data can refer back into it
+            for (size_t j = i + 1; j < i + length && j + 3 <= data.size(); j++)
+                lastSeen[hashAt(j)] = (int64_t)j;
+            i += length;
+        }
+        writeLiteral(writer, 256);
+        writer.flush();
+        putBigEndian(out, adler32(data.data(), data.size()));
+        return out;
+    }
+
+    // Reads deflate data, any block type. Returns false if it's broken.
+    class Inflater
+    {
+    public:
+        Inflater(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+        bool run(std::vector<uint8_t>& out)
+        {
+            bool last = false;
+            while (!last)
+            {
+                last = bits(1) == 1;
+                uint32_t type = bits(2);
+                if (failed)
+                    return false;
+                if (type == 0)
+                {
+                    // Stored: skip to the byte boundary, then a length and its complement
+                    bitCount = 0;
+                    if (position + 4 > size)
+                        return false;
+                    uint32_t length = data[position] | data[position + 1] << 8;
+                    position += 4;
+                    if (position + length > size)
+                        return false;
+                    out.insert(out.end(), data + position, data + position + length);
+                    position += length;
+                }
+                else if (type == 1 || type == 2)
+                {
+                    Huffman literals, distances;
+                    if (type == 1)
+                    {
+                        uint8_t lengths[288 + 30];
+                        std::fill(lengths, lengths + 144, 8);
+                        std::fill(lengths + 144, lengths + 256, 9);
+                        std::fill(lengths + 256, lengths + 280, 7);
+                        std::fill(lengths + 280, lengths + 288, 8);
+                        std::fill(lengths + 288, lengths + 318, 5);
+                        literals.build(lengths, 288);
+                        distances.build(lengths + 288, 30);
+                    }
+                    else if (!readDynamicTables(literals, distances))
+                    {
+                        return false;
+                    }
+                    if (!inflateBlock(literals, distances, out))
+                        return false;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            return !failed;
+        }
+
+    private:
+        // Canonical Huffman codes as counts per length and the symbols in code order
+        struct Huffman
+        {
+            uint16_t counts[16] = {};
+            uint16_t symbols[320] = {};
+
+            void build(const uint8_t* lengths, int count)
+            {
+                std::fill(counts, counts + 16, 0);
+                for (int i = 0; i < count; i++)
+                    counts[lengths[i]]++;
+                counts[0] = 0;
+                uint16_t offsets[16] = {};
+                for (int length = 1; length < 16; length++)
+                    offsets[length] = offsets[length - 1] + counts[length - 1];
+                for (int i = 0; i < count; i++)
+                    if (lengths[i])
+                        symbols[offsets[lengths[i]]++] = (uint16_t)i;
+            }
+        };
+
+        uint32_t bits(int count)
+        {
+            uint32_t value = 0;
+            for (int i = 0; i < count; i++)
+            {
+                if (bitCount == 0)
+                {
+                    if (position >= size)
+                    {
+                        failed = true;
+                        return 0;
+                    }
+                    bitBuffer = data[position++];
+                    bitCount = 8;
+                }
+                value |= (bitBuffer & 1) << i;
+                bitBuffer >>= 1;
+                bitCount--;
+            }
+            return value;
+        }
+
+        int decode(const Huffman& huffman)
+        {
+            int code = 0, first = 0, index = 0;
+            for (int length = 1; length < 16; length++)
+            {
+                code |= (int)bits(1);
+                int count = huffman.counts[length];
+                if (code - first < count)
+                    return huffman.symbols[index + code - first];
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            failed = true;
+            return -1;
+        }
+
+        bool readDynamicTables(Huffman& literals, Huffman& distances)
+        {
+            static const uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+            int literalCount = (int)bits(5) + 257, distanceCount = (int)bits(5) + 1, codeLengthCount = (int)bits(4) + 4;
+            uint8_t lengths[288 + 32] = {};
+            for (int i = 0; i < codeLengthCount; i++)
+                lengths[ORDER[i]] = (uint8_t)bits(3);
+            Huffman codeLengths;
+            codeLengths.build(lengths, 19);
+
+            std::fill(lengths, lengths + 19, 0);
+            int count = 0;
+            while (count < literalCount + distanceCount && !failed)
+            {
+                int symbol = decode(codeLengths);
+                if (symbol < 16)
+                {
+                    lengths[count++] = (uint8_t)symbol;
+                    continue;
+                }
+                uint8_t repeated = 0;
+                int times;
+                if (symbol == 16)
+                {
+                    if (count == 0)
+                        return false;
+                    repeated = lengths[count - 1];
+                    times = 3 + (int)bits(2);
+                }
+                else
+                {
+                    times = symbol == 17 ? 3 + (int)bits(3) : 11 + (int)bits(7);
+                }
+                if (count + times > literalCount + distanceCount)
+                    return false;
+                while (times--)
+                    lengths[count++] = repeated;
+            }
+            literals.build(lengths, literalCount);
+            distances.build(lengths + literalCount, distanceCount);
+            return !failed;
+        }
+
+        bool inflateBlock(const Huffman& literals, const Huffman& distances, std::vector<uint8_t>& out)
+        {
+            for (;;)
+            {
+                int symbol = decode(literals);
+                if (failed || symbol > 285)
+                    return false;
+                if (symbol < 256)
+                {
+                    out.push_back((uint8_t)symbol);
+                    continue;
+                }
+                if (symbol == 256)
+                    return true;
+                size_t length = LENGTH_BASE[symbol - 257] + bits(LENGTH_EXTRA[symbol - 257]);
+                int distanceCode = decode(distances);
+                if (failed || distanceCode > 29)
+                    return false;
+                size_t distance = DISTANCE_BASE[distanceCode] + bits(DISTANCE_EXTRA[distanceCode]);
+                if (distance > out.size())
+                    return false;
+                // Byte by byte, since the match can overlap what it's writing
+                size_t from = out.size() - distance;
+                for (size_t i = 0; i < length; i++)
+                    out.push_back(out[from + i]);
+            }
+        }
+
+        const uint8_t* data;
+        size_t size;
+        size_t position = 0;
+        uint32_t bitBuffer = 0;
+        int bitCount = 0;
+        bool failed = false;
+    };
+
+    inline uint8_t paeth(int a, int b, int c)
+    {
+        int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+        return (uint8_t)(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+    }
+}
+
+inline bool writePng(const std::string& path, const Image& image)
+{
+    using namespace png_detail;
+    // Each row gets whichever of none, sub and up leaves the smallest numbers, which compress best
+    size_t rowBytes = (size_t)image.width * 4;
+    std::vector<uint8_t> filtered;
+    filtered.reserve((rowBytes + 1) * image.height);
+    std::vector<uint8_t> candidate(rowBytes);
+    for (int row = 0; row < image.height; row++)
+    {
+        const uint8_t* line = image.pixel(0, image.height - 1 - row);
+        const uint8_t* above = row > 0 ? image.pixel(0, image.height - row) : nullptr;
+        int bestFilter = 0;
+        uint64_t bestScore = UINT64_MAX;
+        for (int filter = 0; filter < 3; filter++)
+        {
+            if (filter == 2 && !above)
+                continue;
+            // A loop per filter so the compiler can vectorise them
+            uint64_t score = 0;
+            auto add = [&](uint8_t value) { score += (uint64_t)abs((int8_t)value); };
+            if (filter == 0)
+                for (size_t i = 0; i < rowBytes; i++) add(line[i]);
+            else if (filter == 1)
+            {
+                for (size_t i = 0; i < std::min<size_t>(4, rowBytes); i++) add(line[i]);
+                for (size_t i = 4; i < rowBytes; i++) add((uint8_t)(line[i] - line[i - 4]));
+            }
+            else
+                for (size_t i = 0; i < rowBytes; i++) add((uint8_t)(line[i] - above[i]));
+            if (score < bestScore)
+            {
+                bestScore = score;
+                bestFilter = filter;
+            }
+        }
+        filtered.push_back((uint8_t)bestFilter);
+        for (size_t i = 0; i < rowBytes; i++)
+        {
+            uint8_t predicted = bestFilter == 1 ? (i >= 4 ? line[i - 4] : 0) : bestFilter == 2 ? above[i] : 0;
+            filtered.push_back((uint8_t)(line[i] - predicted));
+        }
+    }
+
+    std::vector<uint8_t> file = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    auto chunk = [&](const char* type, const std::vector<uint8_t>& body) {
+        putBigEndian(file, (uint32_t)body.size());
+        size_t start = file.size();
+        file.insert(file.end(), type, type + 4);
+        file.insert(file.end(), body.begin(), body.end());
+        putBigEndian(file, crc32(&file[start], file.size() - start));
+    };
+    std::vector<uint8_t> header;
+    putBigEndian(header, (uint32_t)image.width);
+    putBigEndian(header, (uint32_t)image.height);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 }); // 8 bits per channel, RGBA, deflate, no interlacing
+    chunk("IHDR", header);
+    chunk("IDAT", zlibCompress(filtered));
+    chunk("IEND", {});
+
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.write((const char*)file.data(), file.size()))
+    {
+        std::cerr << "Couldn't write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+inline bool readPng(const std::string& path, Image& image)
+{
+    using namespace png_detail;
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        std::cerr << "Couldn't open " << path << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if (file.size() < 8 || memcmp(file.data(), SIGNATURE, 8) != 0)
+    {
+        std::cerr << path << " isn't a PNG" << std::endl;
+        return false;
+    }
+
+    int channels = 0;
+    std::vector<uint8_t> compressed;
+    for (size_t position = 8; position + 12 <= file.size();)
+    {
+        uint32_t length = getBigEndian(&file[position]);
+        if (position + 12 + (size_t)length > file.size())
+            break;
+        const uint8_t* type = &file[position + 4];
+        const uint8_t* body = &file[position + 8];
+        if (memcmp(type, "IHDR", 4) == 0 && length >= 13)
+        {
+            image.width = (int)getBigEndian(body);
+            image.height = (int)getBigEndian(body + 4);
+            int depth = body[8], colourType = body[9], interlace = body[12];
+            channels = colourType == 6 ? 4 : colourType == 2 ? 3 : 0;
+            if (depth != 8 || channels == 0 || interlace != 0)
+            {
+                std::cerr << path << ": only 8 bit RGB or RGBA without interlacing is supported" << std::endl;
+                return false;
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0)
+        {
+            compressed.insert(compressed.end(), body, body + length);
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            break;
+        }
+        position += 12 + length;
+    }
+
+    // Skip the 2 byte zlib header, the checksum at the end isn't needed
+    std::vector<uint8_t> filtered;
+    size_t rowBytes = (size_t)image.width * channels;
+    if (channels == 0 || compressed.size() < 2 || !Inflater(compressed.data() + 2, compressed.size() - 2).run(filtered)
+        || filtered.size() < (rowBytes + 1) * image.height)
+    {
+        std::cerr << path << ": couldn't decompress the image" << std::endl;
+        return false;
+    }
+
+    image.rgba.resize((size_t)image.width * image.height * 4);
+    std::vector<uint8_t> line(rowBytes), previous(rowBytes, 0);
+    for (int row = 0; row < image.height; row++)
+    {
+        const uint8_t* source = &filtered[row * (rowBytes + 1)];
+        uint8_t filter = source[0];
+        for (size_t i = 0; i < rowBytes; i++)
+        {
+            int left = i >= (size_t)channels ? line[i - channels] : 0;
+            int up = previous[i];
+            int upLeft = i >= (size_t)channels ? previous[i - channels] : 0;
+            uint8_t predicted = filter == 1 ? left : filter == 2 ? up : filter == 3 ? (left + up) / 2 : filter == 4 ? paeth(left, up, upLeft) : 0;
+            line[i] = (uint8_t)(source[1 + i] + predicted);
+        }
+        uint8_t* out = image.pixel(0, image.height - 1 - row);
+        for (int x = 0; x < image.width; x++)
+        {
+            for (int channel = 0; channel < 3; channel++)
+                out[x * 4 + channel] = line[x * channels + channel];
+            out[x * 4 + 3] = channels == 4 ? line[x * 4 + 3] : 255;
+        }
+        std::swap(line, previous);
+    }
+    return true;
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <glad/glad.h>
+#include "hash.h"
+#include "shader_data.h"
+
+// Uniform names are turned into numbers at compile time: "ourColor"_uniform
+constexpr uint32_t uniformHash(const char* name, size_t length)
+{
+    return fnv1a(name, length);
+}
+
+constexpr uint32_t operator""_uniform(const char* name, size_t length)
+{
+    return uniformHash(name, length);
+}
+
+// How many glUniform* calls actually went to the driver, and how many were skipped because the value hadn't changed
+struct UniformStats
+{
+    uint64_t issued = 0;
+    uint64_t skipped = 0;
+};
+inline UniformStats uniformStats;
+
+// Everything the linker kept in a program: the active uniforms, their locations and types.
+// It's built by asking GL right after linking, so there's no glGetUniformLocation when drawing.
+// Each uniform also keeps a copy of the last value we uploaded, and setting the same value again
+// doesn't call glUniform at all.
+//
+// Programs get rebuilt by the shader reloader, so use() compares the handle with the one the table
+// was built from and rebuilds it (forgetting the old values) when it changed.
+// Building the table is also when the program's uniform blocks get attached to their binding points.
+class ProgramReflection
+{
+public:
+    struct Uniform
+    {
+        uint32_t hash;
+        std::string name;
+        GLint location;
+        GLenum type;
+        GLint size;
+        bool warned = false;
+        // Last uploaded value, big enough for a mat4
+        bool hasValue = false;
+        uint8_t value[16 * sizeof(float)];
+    };
+
+    void build(GLuint shaderProgram)
+    {
+        program = shaderProgram;
+        uniforms.clear();
+        if (!program)
+            return;
+
+        GLint count = 0;
+        GLint maxLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::string name(maxLength, '\0');
+        for (GLint i = 0; i < count; i++)
+        {
+            GLsizei length = 0;
+            Uniform uniform;
+            glGetActiveUniform(program, i, maxLength, &length, &uniform.size, &uniform.type, &name[0]);
+            uniform.name = name.substr(0, length);
+            // Arrays are reported as "name[0]", but we want to look them up by "name"
+            size_t bracket = uniform.name.find('[');
+            if (bracket != std::string::npos)
+                uniform.name.resize(bracket);
+            uniform.location = glGetUniformLocation(program, uniform.name.c_str());
+            // Members of uniform blocks don't have locations, they live in buffers instead
+            if (uniform.location < 0)
+                continue;
+            uniform.hash = uniformHash(uniform.name.c_str(), uniform.name.size());
+            uniforms.push_back(uniform);
+        }
+        // Hook the uniform blocks up to their binding points, and make sure the shader doesn't expect more data than we send
+        for (const UniformBlockInfo& block : shaderBlocks)
+        {
+            GLuint index = glGetUniformBlockIndex(program, block.name);
+            if (index == GL_INVALID_INDEX)
+                continue;
+            glUniformBlockBinding(program, index, block.binding);
+            GLint size = 0;
+            glGetActiveUniformBlockiv(program, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+            if ((size_t)size > block.size)
+                std::cerr << "Uniform block " << block.name << " is " << size << " bytes in the shader but " << block.size << " in C++" << std::endl;
+        }
+
+        std::sort(uniforms.begin(), uniforms.end(), [](const Uniform& a, const Uniform& b) { return a.hash < b.hash; });
+        for (size_t i = 1; i < uniforms.size(); i++)
+            if (uniforms[i].hash == uniforms[i - 1].hash)
+                std::cerr << "Uniforms " << uniforms[i - 1].name << " and " << uniforms[i].name << " have the same hash, rename one of them" << std::endl;
+    }
+
+    // glUseProgram, but also picks up programs that were swapped by the reloader
+    void use(GLuint shaderProgram)
+    {
+        if (shaderProgram != program)
+            build(shaderProgram);
+        glUseProgram(shaderProgram);
+    }
+
+    const Uniform* find(uint32_t hash) const
+    {
+        auto it = std::lower_bound(uniforms.begin(), uniforms.end(), hash, [](const Uniform& uniform, uint32_t hash) { return uniform.hash < hash; });
+        return it != uniforms.end() && it->hash == hash ? &*it : nullptr;
+    }
+
+    // The setters below expect the program to be in use. Setting a uniform the program doesn't have
+    // (or that the compiler optimised away) does nothing, same as a -1 location.
+    void set(uint32_t hash, float x)
+    {
+        float value[] = { x };
+        if (Uniform* uniform = changed(hash, GL_FLOAT, value, sizeof(value)))
+            glUniform1f(uniform->location, x);
+    }
+
+    void set(uint32_t hash, float x, float y)
+    {
+        float value[] = { x, y };
+        if (Uniform* uniform = changed(hash, GL_FLOAT_VEC2, value, sizeof(value)))
+            glUniform2f(uniform->location, x, y);
+    }
+
+    void set(uint32_t hash, float x, float y, float z)
+    {
+        float value[] = { x, y, z };
+        if (Uniform* uniform = changed(hash, GL_FLOAT_VEC3, value, sizeof(value)))
+            glUniform3f(uniform->location, x, y, z);
+    }
+
+    void set(uint32_t hash, float x, float y, float z, float w)
+    {
+        float value[] = { x, y, z, w };
+        if (Uniform* uniform = changed(hash, GL_FLOAT_VEC4, value, sizeof(value)))
+            glUniform4f(uniform->location, x, y, z, w);
+    }
+
+    // Also used for samplers, which are set with the texture unit number
+    void set(uint32_t hash, int x)
+    {
+        int value[] = { x };
+        if (Uniform* uniform = changed(hash, GL_INT, value, sizeof(value)))
+            glUniform1i(uniform->location, x);
+    }
+
+    // Column major, the same as glUniformMatrix4fv with transpose off
+    void setMatrix(uint32_t hash, const float* matrix)
+    {
+        if (Uniform* uniform = changed(hash, GL_FLOAT_MAT4, matrix, 16 * sizeof(float)))
+            glUniformMatrix4fv(uniform->location, 1, GL_FALSE, matrix);
+    }
+
+    GLuint program = 0;
+    std::vector<Uniform> uniforms;
+
+private:
+    static bool isSampler(GLenum type)
+    {
+        switch (type)
+        {
+        case GL_SAMPLER_1D: case GL_SAMPLER_2D: case GL_SAMPLER_3D: case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_2D_ARRAY: case GL_SAMPLER_2D_SHADOW: case GL_SAMPLER_BUFFER:
+        case GL_INT_SAMPLER_2D: case GL_UNSIGNED_INT_SAMPLER_2D:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Returns the uniform if the value needs uploading, and remembers the new value
+    Uniform* changed(uint32_t hash, GLenum type, const void* value, size_t size)
+    {
+        Uniform* uniform = const_cast<Uniform*>(find(hash));
+        if (!uniform)
+            return nullptr;
+        if (uniform->type != type && !(type == GL_INT && isSampler(uniform->type)))
+        {
+            if (!uniform->warned)
+                std::cerr << "Uniform " << uniform->name << " was set with the wrong type" << std::endl;
+            uniform->warned = true;
+            return nullptr;
+        }
+        if (uniform->hasValue && memcmp(uniform->value, value, size) == 0)
+        {
+            uniformStats.skipped++;
+            return nullptr;
+        }
+        memcpy(uniform->value, value, size);
+        uniform->hasValue = true;
+        uniformStats.issued++;
+        return uniform;
+    }
+};
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+
+// Reading pixels back without stalling. glReadPixels into client memory makes the CPU wait until
+// the GPU has finished drawing the frame. Into a pixel buffer object it just queues a copy, and a
+// fence says when that copy is done, so the pixels can be picked up a frame or two later when
+// they're ready. A small ring of buffers keeps a few reads in flight at once.
+//
+//   readback.create(width, height);
+//   readback.request(0, 0, width, height);   // after drawing, reads the bound read framebuffer
+//   ...
+//   while (readback.collect(pixels)) ...     // whatever has finished, oldest first
+class AsyncReadback
+{
+public:
+    // Room for reads up to width x height, with ringSize of them in flight
+    void create(int width, int height, int ringSize = 3, const char* label = "readback")
+    {
+        destroy();
+        capacity = (size_t)width * height * 4;
+        slots.resize(ringSize);
+        for (Slot& slot : slots)
+        {
+            glGenBuffers(1, &slot.buffer);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+            glBufferData(GL_PIXEL_PACK_BUFFER, capacity, NULL, GL_STREAM_READ);
+            GL_DEBUG_LABEL(GL_BUFFER, slot.buffer, label);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    void destroy()
+    {
+        for (Slot& slot : slots)
+        {
+            if (slot.fence) glDeleteSync(slot.fence);
+            if (slot.buffer) glDeleteBuffers(1, &slot.buffer);
+        }
+        slots.clear();
+        next = 0;
+        inFlight = 0;
+    }
+
+    // Starts reading a rectangle of the current read framebuffer as RGBA bytes. Returns false if
+    // every buffer is still waiting to be collected.
+    bool request(int x, int y, int width, int height)
+    {
+        if (inFlight == slots.size() || (size_t)width * height * 4 > capacity)
+            return false;
+        Slot& slot = slots[next];
+        slot.width = width;
+        slot.height = height;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        next = (next + 1) % slots.size();
+        inFlight++;
+        return true;
+    }
+
+    // Copies out the oldest read if it's finished, or waits for it with wait. Rows go bottom up.
+    // If the buffer can't be mapped the read is dropped and this returns false too, pending() says
+    // which it was.
+    bool collect(std::vector<uint8_t>& rgba, int* width = nullptr, int* height = nullptr, bool wait = false)
+    {
+        if (inFlight == 0)
+            return false;
+        Slot& slot = slots[(next + slots.size() - inFlight) % slots.size()];
+        // Flushing makes sure the fence actually gets to the GPU, otherwise waiting on it could hang
+        GLenum status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? WAIT_NANOSECONDS : 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            return false;
+        glDeleteSync(slot.fence);
+        slot.fence = 0;
+
+        size_t size = (size_t)slot.width * slot.height * 4;
+        rgba.resize(size);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+        if (mapped)
+        {
+            memcpy(rgba.data(), mapped, size);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        inFlight--;
+        if (!mapped)
+        {
+            std::cerr << "Couldn't map a readback buffer, dropped a " << slot.width << "x" << slot.height << " read" << std::endl;
+            return false;
+        }
+        if (width) *width = slot.width;
+        if (height) *height = slot.height;
+        return true;
+    }
+
+    size_t pending() const
+    {
+        return inFlight;
+    }
+
+private:
+    // A second is far longer than any copy takes, if it runs out something has gone wrong
+    static constexpr GLuint64 WAIT_NANOSECONDS = 1000000000ull;
+
+    struct Slot
+    {
+        GLuint buffer = 0;
+        GLsync fence = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    std::vector<Slot> slots;
+    size_t capacity = 0;
+    size_t next = 0;
+    size_t inFlight = 0;
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "gl_features.h"
+#include "gl_objects.h"
+
+// How a texture is filtered and wrapped, kept apart from the texture itself in a sampler object.
+// The same texture can then be read with different settings, and every texture drawn the same way
+// shares one sampler instead of each carrying its own copy of the parameters.
+struct SamplerState
+{
+    GLenum minFilter = GL_LINEAR_MIPMAP_LINEAR;
+    GLenum magFilter = GL_LINEAR;
+    GLenum wrapS = GL_REPEAT;
+    GLenum wrapT = GL_REPEAT;
+    // 1 is off. Clamped to what the driver allows, and ignored without the extension.
+    float anisotropy = 1.0f;
+
+    bool operator==(const SamplerState& other) const
+    {
+        return minFilter == other.minFilter && magFilter == other.magFilter && wrapS == other.wrapS && wrapT == other.wrapT && anisotropy == other.anisotropy;
+    }
+
+    static SamplerState clamped(GLenum minFilter = GL_LINEAR_MIPMAP_LINEAR, GLenum magFilter = GL_LINEAR)
+    {
+        return { minFilter, magFilter, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE };
+    }
+};
+
+// Binds made (or skipped as already bound) since the cache was made or the stats were reset
+struct SamplerStats
+{
+    uint64_t created = 0;
+    uint64_t binds = 0;
+    uint64_t skipped = 0;
+};
+
+// One sampler object per distinct SamplerState, made the first time it's asked for, and binds
+// to texture units that already have the right one are skipped. There are only ever a handful
+// of states so they're just searched in order.
+class SamplerCache
+{
+public:
+    // The sampler for state, made if it's new. Needs a context.
+    GLuint get(const SamplerState& state)
+    {
+        for (const Entry& entry : entries)
+        {
+            if (entry.state == state)
+                return entry.sampler;
+        }
+        GLSampler sampler = GLSampler::create();
+        glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, state.minFilter);
+        glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, state.magFilter);
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, state.wrapS);
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, state.wrapT);
+        if (state.anisotropy > 1.0f && glFeatures.maxAnisotropy > 1.0f)
+            glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, std::min(state.anisotropy, glFeatures.maxAnisotropy));
+        GL_DEBUG_LABEL(GL_SAMPLER, sampler, "Cached sampler");
+        stats.created++;
+        entries.push_back({ state, std::move(sampler) });
+        return entries.back().sampler;
+    }
+
+    // Reads textures on unit with state, overriding the textures' own parameters
+    void bind(GLuint unit, const SamplerState& state)
+    {
+        GLuint sampler = get(state);
+        if (unit >= bound.size())
+            bound.resize(unit + 1, 0);
+        if (bound[unit] == sampler)
+        {
+            stats.skipped++;
+            return;
+        }
+        glBindSampler(unit, sampler);
+        bound[unit] = sampler;
+        stats.binds++;
+    }
+
+    // Back to the textures' own parameters
+    void unbind(GLuint unit)
+    {
+        if (unit < bound.size() && bound[unit])
+        {
+            glBindSampler(unit, 0);
+            bound[unit] = 0;
+        }
+    }
+
+    // Forget what's bound, for when something else may have bound samplers behind the cache's back
+    void invalidate()
+    {
+        std::fill(bound.begin(), bound.end(), 0);
+    }
+
+    size_t count() const
+    {
+        return entries.size();
+    }
+
+    void destroy()
+    {
+        entries.clear();
+        bound.clear();
+    }
+
+    SamplerStats stats;
+
+private:
+    struct Entry
+    {
+        SamplerState state;
+        GLSampler sampler;
+    };
+
+    std::vector<Entry> entries;
+    // The sampler on each texture unit, as far as the cache knows
+    std::vector<GLuint> bound;
+};
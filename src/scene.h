@@ -0,0 +1,196 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "job_system.h"
+#include "simd_math.h"
+
+// Objects and their transforms. Every node has a position, rotation (a unit quaternion) and scale
+// relative to its parent, and update() turns those into world matrices for drawing.
+//
+// The data is stored as structure of arrays, one array per component, rather than one struct per
+// node, so a pass over the nodes reads memory in a straight line. Nodes are kept sorted by their
+// depth in the tree, which means:
+//  - a node's parent always comes before it, so one pass front to back is enough
+//  - all the nodes at one depth only depend on the depth above, so each depth can be split up across
+//    the job system
+// Only nodes that were changed (or whose parent moved) get recomputed.
+//
+// Node ids returned by addNode() stay the same, even though nodes move around when they're sorted.
+class Scene
+{
+public:
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFF;
+
+    // Parents have to be added before their children. New nodes start at the origin with no rotation.
+    uint32_t addNode(uint32_t parent = NO_PARENT)
+    {
+        uint32_t id = (uint32_t)slotOf.size();
+        uint32_t slot = (uint32_t)idOf.size();
+        slotOf.push_back(slot);
+        idOf.push_back(id);
+        parents.push_back(parent == NO_PARENT ? NO_PARENT : slotOf[parent]);
+        positionX.push_back(0.0f); positionY.push_back(0.0f); positionZ.push_back(0.0f);
+        rotationX.push_back(0.0f); rotationY.push_back(0.0f); rotationZ.push_back(0.0f); rotationW.push_back(1.0f);
+        scaleX.push_back(1.0f); scaleY.push_back(1.0f); scaleZ.push_back(1.0f);
+        world.resize(world.size() + 16);
+        dirty.push_back(1);
+        sorted = false;
+        return id;
+    }
+
+    void setPosition(uint32_t node, float x, float y, float z)
+    {
+        uint32_t slot = slotOf[node];
+        positionX[slot] = x; positionY[slot] = y; positionZ[slot] = z;
+        dirty[slot] = 1;
+    }
+
+    void setRotation(uint32_t node, float x, float y, float z, float w)
+    {
+        uint32_t slot = slotOf[node];
+        rotationX[slot] = x; rotationY[slot] = y; rotationZ[slot] = z; rotationW[slot] = w;
+        dirty[slot] = 1;
+    }
+
+    void setScale(uint32_t node, float x, float y, float z)
+    {
+        uint32_t slot = slotOf[node];
+        scaleX[slot] = x; scaleY[slot] = y; scaleZ[slot] = z;
+        dirty[slot] = 1;
+    }
+
+    // Column major 4x4, the same layout glUniformMatrix4fv wants
+    const float* worldMatrix(uint32_t node) const
+    {
+        return &world[slotOf[node] * 16];
+    }
+
+    size_t size() const
+    {
+        return idOf.size();
+    }
+
+    // Recomputes the world matrix of everything that changed. Pass a job system to spread each level
+    // of the tree over its threads.
+    void update(JobSystem* jobs = nullptr)
+    {
+        if (!sorted)
+            sortByDepth();
+
+        std::atomic<size_t> updated{ 0 };
+        for (size_t level = 0; level + 1 < levelStarts.size(); level++)
+        {
+            size_t begin = levelStarts[level];
+            size_t count = levelStarts[level + 1] - begin;
+            auto work = [&](size_t first, size_t last) { updated += updateRange(begin + first, begin + last); };
+            if (jobs)
+                jobs->parallelFor(count, UPDATE_CHUNK, work);
+            else
+                work(0, count);
+        }
+        memset(dirty.data(), 0, dirty.size());
+        lastUpdated = updated;
+    }
+
+    // How many world matrices the last update() recomputed
+    size_t lastUpdated = 0;
+
+private:
+    // Nodes per job, big enough that handing out chunks doesn't cost more than the work in them
+    static constexpr size_t UPDATE_CHUNK = 2048;
+
+    size_t updateRange(size_t begin, size_t end)
+    {
+        size_t updated = 0;
+        for (size_t i = begin; i < end; i++)
+        {
+            uint32_t parent = parents[i];
+            // Parents are a level up and already done, so their flag says whether they moved this update
+            if (parent != NO_PARENT && dirty[parent])
+                dirty[i] = 1;
+            if (!dirty[i])
+                continue;
+
+            Mat4 local = compose({ positionX[i], positionY[i], positionZ[i] }, { rotationX[i], rotationY[i], rotationZ[i], rotationW[i] },
+                                 { scaleX[i], scaleY[i], scaleZ[i] });
+            if (parent == NO_PARENT)
+                memcpy(&world[i * 16], &local, sizeof(local));
+            else
+                multiplyMatrix(&world[parent * 16], &local.columns[0].x, &world[i * 16]);
+            updated++;
+        }
+        return updated;
+    }
+
+    template <typename T>
+    static void reorder(std::vector<T>& values, const std::vector<uint32_t>& order, size_t stride = 1)
+    {
+        std::vector<T> result(values.size());
+        for (size_t i = 0; i < order.size(); i++)
+            for (size_t k = 0; k < stride; k++)
+                result[i * stride + k] = values[order[i] * stride + k];
+        values.swap(result);
+    }
+
+    // Stable counting sort by depth. Parents are always added first, so their slot is always lower and
+    // the depths can be worked out in one pass.
+    void sortByDepth()
+    {
+        size_t count = idOf.size();
+        std::vector<uint32_t> depth(count);
+        uint32_t maxDepth = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            depth[i] = parents[i] == NO_PARENT ? 0 : depth[parents[i]] + 1;
+            maxDepth = depth[i] > maxDepth ? depth[i] : maxDepth;
+        }
+
+        levelStarts.assign(maxDepth + 2, 0);
+        for (size_t i = 0; i < count; i++)
+            levelStarts[depth[i] + 1]++;
+        for (size_t level = 1; level < levelStarts.size(); level++)
+            levelStarts[level] += levelStarts[level - 1];
+
+        std::vector<uint32_t> order(count);
+        std::vector<uint32_t> newSlot(count);
+        std::vector<uint32_t> fill(levelStarts.begin(), levelStarts.end() - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t slot = fill[depth[i]]++;
+            order[slot] = (uint32_t)i;
+            newSlot[i] = slot;
+        }
+
+        reorder(parents, order);
+        for (uint32_t& parent : parents)
+            if (parent != NO_PARENT)
+                parent = newSlot[parent];
+        reorder(positionX, order); reorder(positionY, order); reorder(positionZ, order);
+        reorder(rotationX, order); reorder(rotationY, order); reorder(rotationZ, order); reorder(rotationW, order);
+        reorder(scaleX, order); reorder(scaleY, order); reorder(scaleZ, order);
+        reorder(world, order, 16);
+        reorder(dirty, order);
+        reorder(idOf, order);
+        for (size_t slot = 0; slot < count; slot++)
+            slotOf[idOf[slot]] = (uint32_t)slot;
+        sorted = true;
+    }
+
+    // Indexed by slot
+    std::vector<uint32_t> parents;
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> rotationX, rotationY, rotationZ, rotationW;
+    std::vector<float> scaleX, scaleY, scaleZ;
+    std::vector<float> world;
+    std::vector<uint8_t> dirty;
+    std::vector<uint32_t> idOf;
+
+    // Indexed by node id
+    std::vector<uint32_t> slotOf;
+
+    // Where each depth starts, plus one past the end
+    std::vector<size_t> levelStarts;
+    bool sorted = true;
+};
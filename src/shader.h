@@ -0,0 +1,150 @@
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <glad/glad.h>
+#include "gl_debug.h"
+
+// "method C++" from: http://insanecoding.blogspot.com/2011/11/how-to-read-in-file-in-c.html
+inline std::string get_file_contents(const char *filename)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if (in)
+    {
+        std::string contents;
+        in.seekg(0, std::ios::end);
+        contents.resize(in.tellg());
+        in.seekg(0, std::ios::beg);
+        in.read(&contents[0], contents.size());
+        in.close();
+        return(contents);
+    }
+    else
+    {
+        std::cerr << "Failed to read " << filename << std::endl;
+        return "";
+    }
+}
+
+// Creates a shader object and hands the source to the driver, but doesn't wait for the result.
+// Most drivers will happily keep compiling in the background until someone asks for GL_COMPILE_STATUS.
+inline GLuint startShaderCompile(GLenum type, const std::string& source)
+{
+    GLuint shader = glCreateShader(type);
+    const GLchar* shaderSource = source.c_str();
+    glShaderSource(shader, 1, &shaderSource, NULL);
+    glCompileShader(shader);
+    return shader;
+}
+
+// Same idea as above: attach, link and return straight away, the shaders are flagged for deletion
+// and will go away with the program
+inline GLuint startProgramLink(GLuint vertexShader, GLuint fragmentShader)
+{
+    GLuint shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return shaderProgram;
+}
+
+// Checks the link status (this is the call that actually blocks if the driver isn't done yet)
+// and dumps the logs of anything that went wrong. Returns false if the program is unusable.
+inline bool finishProgramLink(GLuint shaderProgram, const char* name)
+{
+    int success;
+    int length;
+    std::string infoLog;
+
+    GL_DEBUG_LABEL(GL_PROGRAM, shaderProgram, name);
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (success)
+        return true;
+
+    // The shaders are still attached, so we can ask them why
+    GLuint shaders[2];
+    GLsizei count = 0;
+    glGetAttachedShaders(shaderProgram, 2, &count, shaders);
+    for (GLsizei i = 0; i < count; i++)
+    {
+        glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &success);
+        if (!success)
+        {
+            glGetShaderiv(shaders[i], GL_INFO_LOG_LENGTH, &length);
+            infoLog.resize(length);
+            glGetShaderInfoLog(shaders[i], length, NULL, &infoLog[0]);
+            std::cerr << name << ": Shader failed to compile!" << std::endl << infoLog << std::endl;
+        }
+    }
+    glGetProgramiv(shaderProgram, GL_INFO_LOG_LENGTH, &length);
+    infoLog.resize(length);
+    glGetProgramInfoLog(shaderProgram, length, NULL, &infoLog[0]);
+    std::cerr << name << ": Shader Program linking failed!" << std::endl << infoLog << std::endl;
+    return false;
+}
+
+inline GLuint makeShaderProgram(const char* vertexShaderPath, const char* fragmentShaderPath)
+{
+    int success;
+    std::string infoLog;
+    int length;
+
+    // Create Vertex Shader
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    std::string vertexShaderString = get_file_contents(vertexShaderPath);
+    const GLchar* vertexShaderSource = vertexShaderString.c_str();
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+
+    // Check for errors
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &length);
+        infoLog.resize(length);
+        glGetShaderInfoLog(vertexShader, length, NULL, &infoLog[0]);
+        std::cerr << "Vertex Shader failed to compile!" << std::endl << infoLog << std::endl;
+    }
+
+    // Create Fragment Shader
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    std::string fragmentShaderString = get_file_contents(fragmentShaderPath);
+    const GLchar* fragmentShaderSource = fragmentShaderString.c_str();
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+
+    // Check for errors
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &length);
+        infoLog.resize(length);
+        glGetShaderInfoLog(fragmentShader, length, NULL, &infoLog[0]);
+        std::cerr << "Fragment Shader failed to compile!" << std::endl << infoLog << std::endl;
+    }
+
+    // Combine the Vertex Shader and Fragment Shader into a Shader Program
+    GLuint shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+    GL_DEBUG_LABEL(GL_PROGRAM, shaderProgram, vertexShaderPath);
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+
+    // Check for linking errors
+    if (!success)
+    {
+        glGetProgramiv(shaderProgram, GL_INFO_LOG_LENGTH, &length);
+        infoLog.resize(length);
+        glGetProgramInfoLog(shaderProgram, length, NULL, &infoLog[0]);
+        std::cerr << "Shader Program linking failed!" << std::endl << infoLog << std::endl;
+    }
+
+    //Delete the shaders
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    return shaderProgram;
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "uniform_buffer.h"
+
+// Things the C++ side and the shaders in res/shaders have to agree on.
+
+// Variants of basic.vert + basic.frag, bit n turns on the nth define in basicShaderFeatures
+enum BasicShaderFeatures
+{
+    BASIC_VERTEX_COLOUR = 1 << 0,
+    BASIC_GLOBAL_COLOUR = 1 << 1,
+    BASIC_OBJECT_BLOCK = 1 << 2,
+    BASIC_OBJECT_UNIFORMS = 1 << 3,
+    BASIC_DEPTH_ONLY = 1 << 4,
+    BASIC_OVERDRAW = 1 << 5,
+};
+inline const std::vector<std::string> basicShaderFeatures = { "VERTEX_COLOUR", "GLOBAL_COLOUR", "OBJECT_BLOCK", "OBJECT_UNIFORMS", "DEPTH_ONLY", "OVERDRAW" };
+
+// Variants of textured.vert + textured.frag, for where each quad's texture comes from. Without
+// either it's the texture bound to unit 0.
+enum TexturedShaderFeatures
+{
+    TEXTURED_ARRAY = 1 << 0,
+    TEXTURED_BINDLESS = 1 << 1,
+};
+inline const std::vector<std::string> texturedShaderFeatures = { "TEXTURE_ARRAY", "BINDLESS" };
+
+// What textured.vert reads for each vertex
+struct TexturedVertex
+{
+    float x, y;
+    float u, v;
+    // The layer in the first, or a bindless handle split into its low and high halves
+    uint32_t texture[2];
+};
+
+// The uniform blocks from blocks.glsl. GL 3.3 can't say layout(binding = n) in the shader, so the
+// blocks are hooked up to these binding points by name whenever a program is (re)built.
+enum UniformBlockBinding
+{
+    PER_FRAME_BINDING = 0,
+    PER_OBJECT_BINDING = 1,
+};
+
+struct PerFrame
+{
+    float time;
+    std140::vec4 tint;
+};
+using PerFrameLayout = BlockLayout<BlockPacking::Std140, float, std140::vec4>;
+CHECK_BLOCK_MEMBER(PerFrameLayout, PerFrame, 0, time);
+CHECK_BLOCK_MEMBER(PerFrameLayout, PerFrame, 1, tint);
+CHECK_BLOCK_SIZE(PerFrameLayout, PerFrame);
+
+struct PerObject
+{
+    std140::vec4 objectOffset; // xy = position, z = scale, w = depth
+    std140::vec4 objectColour;
+};
+using PerObjectLayout = BlockLayout<BlockPacking::Std140, std140::vec4, std140::vec4>;
+CHECK_BLOCK_MEMBER(PerObjectLayout, PerObject, 0, objectOffset);
+CHECK_BLOCK_MEMBER(PerObjectLayout, PerObject, 1, objectColour);
+CHECK_BLOCK_SIZE(PerObjectLayout, PerObject);
+
+struct UniformBlockInfo
+{
+    const char* name;
+    GLuint binding;
+    size_t size;
+};
+inline const UniformBlockInfo shaderBlocks[] = {
+    { "PerFrame", PER_FRAME_BINDING, sizeof(PerFrame) },
+    { "PerObject", PER_OBJECT_BINDING, sizeof(PerObject) },
+};
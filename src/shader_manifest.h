@@ -0,0 +1,64 @@
+#pragma once
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// What tools/shader_check found in each program: the attributes, what gets passed between the stages
+// and the uniforms. It's written to res/shaders/reflection.txt, one line per thing:
+//
+//   program basic/2
+//   attribute 0 vec3 aPos
+//   varying vec4 vertexColor
+//   uniform -1 vec4 ourColor 1
+//   end
+//
+// Uniform locations are only known offline when the shader gives them explicitly
+// (layout(location = n), GL 4.3), otherwise they're -1 and assigned by the driver at link time.
+// The app doesn't read it back, it asks the driver what each program has (see ProgramReflection),
+// so this is a record for reviewing what a shader change did to the interface.
+struct ShaderVariable
+{
+    int location = -1;
+    std::string type;
+    std::string name;
+    int arraySize = 1;
+};
+
+struct ShaderProgramInfo
+{
+    std::vector<ShaderVariable> attributes;
+    std::vector<ShaderVariable> varyings;
+    std::vector<ShaderVariable> uniforms;
+};
+
+class ShaderManifest
+{
+public:
+    bool save(const char* path) const
+    {
+        // Binary with CRLF written out, like the rest of res/shaders, so it's the same on every platform
+        std::ofstream out(path, std::ios::binary);
+        if (!out)
+        {
+            std::cerr << "Failed to write " << path << std::endl;
+            return false;
+        }
+        out << "# Generated by tools/shader_check from programs.txt, don't edit by hand\r\n";
+        for (const auto& program : programs)
+        {
+            out << "program " << program.first << "\r\n";
+            for (const ShaderVariable& attribute : program.second.attributes)
+                out << "attribute " << attribute.location << " " << attribute.type << " " << attribute.name << "\r\n";
+            for (const ShaderVariable& varying : program.second.varyings)
+                out << "varying " << varying.type << " " << varying.name << "\r\n";
+            for (const ShaderVariable& uniform : program.second.uniforms)
+                out << "uniform " << uniform.location << " " << uniform.type << " " << uniform.name << " " << uniform.arraySize << "\r\n";
+            out << "end\r\n";
+        }
+        return true;
+    }
+
+    std::map<std::string, ShaderProgramInfo> programs;
+};
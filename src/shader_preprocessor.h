@@ -0,0 +1,289 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glad/glad.h>
+#include "shader.h"
+
+// The result of running a shader file through the preprocessor
+struct PreprocessedShader
+{
+    std::string source;
+    // Every file that went into the source, the first is the shader itself. The index of a file in here
+    // is also its source string number in the #line directives, so "2:14(3)" in a driver log means files[2] line 14.
+    std::vector<std::string> files;
+};
+
+// A small GLSL preprocessor that runs before the driver's one. It handles:
+//  - #include "file", relative to the including file. Each file is only included once, so common headers
+//    don't need guards.
+//  - Injecting #defines straight after the #version line (which has to stay first).
+// Only the defines a file actually mentions are injected. That way two variants that only differ in
+// fragment shader features end up with identical vertex shader text, and the permutation cache below
+// can share the compiled vertex shader between them.
+//
+// Results are cached by path + defines. The hot reloader calls invalidate() with the name of the file
+// that changed, which drops every cached result that included it.
+// It's safe to use from several threads, the shader watcher runs it off the render thread.
+class ShaderPreprocessor
+{
+public:
+    PreprocessedShader preprocess(const std::string& path, const std::vector<std::string>& defines = {})
+    {
+        std::string key = path;
+        for (const std::string& define : defines)
+            key += '\n' + define;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto cached = results.find(key);
+        if (cached != results.end())
+            return cached->second;
+
+        PreprocessedShader result;
+        std::set<std::string> included;
+        std::string body;
+        expand(path, result, included, body);
+
+        // Put the defines after #version, then reset the line numbering so errors still point at the right line
+        std::string& source = result.source;
+        size_t versionEnd = 0;
+        size_t version = body.find("#version");
+        if (version != std::string::npos)
+        {
+            versionEnd = body.find('\n', version);
+            versionEnd = versionEnd == std::string::npos ? body.size() : versionEnd + 1;
+        }
+        source = body.substr(0, versionEnd);
+        for (const std::string& define : defines)
+        {
+            std::string name = define.substr(0, define.find_first_of(" ="));
+            if (!mentions(body, name))
+                continue;
+            size_t equals = define.find('=');
+            if (equals == std::string::npos)
+                source += "#define " + define + "\n";
+            else
+                source += "#define " + define.substr(0, equals) + " " + define.substr(equals + 1) + "\n";
+        }
+        if (versionEnd)
+            source += "#line 2 0\n";
+        source += body.substr(versionEnd);
+
+        results[key] = result;
+        return result;
+    }
+
+    // Forgets everything cached that depends on a file. Only the file name is compared, since inotify doesn't give us the directory.
+    void invalidate(const std::string& changedFile)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = files.begin(); it != files.end(); )
+        {
+            if (fileName(it->first) == changedFile)
+                it = files.erase(it);
+            else
+                ++it;
+        }
+        for (auto it = results.begin(); it != results.end(); )
+        {
+            bool depends = false;
+            for (const std::string& file : it->second.files)
+                depends |= fileName(file) == changedFile;
+            if (depends)
+                it = results.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    static std::string fileName(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+private:
+    // Is the identifier used as a whole word somewhere in the source?
+    static bool mentions(const std::string& source, const std::string& name)
+    {
+        if (name.empty())
+            return false;
+        for (size_t at = source.find(name); at != std::string::npos; at = source.find(name, at + 1))
+        {
+            bool startOk = at == 0 || !(isalnum((unsigned char)source[at - 1]) || source[at - 1] == '_');
+            size_t end = at + name.size();
+            bool endOk = end >= source.size() || !(isalnum((unsigned char)source[end]) || source[end] == '_');
+            if (startOk && endOk)
+                return true;
+        }
+        return false;
+    }
+
+    const std::string& contents(const std::string& path)
+    {
+        auto it = files.find(path);
+        if (it == files.end())
+            it = files.emplace(path, get_file_contents(path.c_str())).first;
+        return it->second;
+    }
+
+    void expand(const std::string& path, PreprocessedShader& result, std::set<std::string>& included, std::string& out)
+    {
+        included.insert(path);
+        int fileIndex = (int)result.files.size();
+        result.files.push_back(path);
+
+        std::string directory = path.substr(0, path.find_last_of("/\\") + 1);
+        const std::string& text = contents(path);
+        int lineNumber = 0;
+        size_t lineStart = 0;
+        while (lineStart < text.size())
+        {
+            size_t lineEnd = text.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = text.size();
+            std::string line = text.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+            lineNumber++;
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            size_t first = line.find_first_not_of(" \t");
+            bool directive = first != std::string::npos && line[first] == '#';
+            if (directive && line.compare(first, 8, "#include") == 0)
+            {
+                size_t open = line.find('"', first);
+                size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+                if (close == std::string::npos)
+                {
+                    std::cerr << path << ":" << lineNumber << ": malformed #include" << std::endl;
+                    continue;
+                }
+                std::string includePath = directory + line.substr(open + 1, close - open - 1);
+                if (included.count(includePath))
+                    continue;
+                out += "#line 1 " + std::to_string(result.files.size()) + "\n";
+                expand(includePath, result, included, out);
+                out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(fileIndex) + "\n";
+                continue;
+            }
+            // Only the top level file gets to say which version it is
+            if (directive && fileIndex != 0 && line.compare(first, 8, "#version") == 0)
+            {
+                out += "\n";
+                continue;
+            }
+            out += line;
+            out += '\n';
+        }
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::string, std::string> files;
+    std::unordered_map<std::string, PreprocessedShader> results;
+};
+
+// Compiles variants of one vertex + fragment shader pair, picked by a mask of feature bits.
+// Bit n of the mask turns on the nth define in the feature list. Variants are only built the first
+// time they're asked for.
+//
+// Identical preprocessed text is only ever compiled once: the shader objects are cached by their
+// source, so if a feature only touches the fragment shader, all those variants share the one vertex
+// shader. Every variant still gets a program (and handle) of its own, even when its shaders are
+// the same as another's today, since the reloader rebuilds each handle with its own defines and
+// an edit can make two variants differ.
+class ShaderPermutations
+{
+public:
+    ShaderPermutations(ShaderPreprocessor& preprocessor, const char* vertexPath, const char* fragmentPath, std::vector<std::string> features)
+        : vertexPath(vertexPath), fragmentPath(fragmentPath), preprocessor(preprocessor), features(std::move(features))
+    {
+    }
+
+    ~ShaderPermutations()
+    {
+        clear();
+    }
+
+    // Returns a reference to the program handle for the variant, which stays valid for the life of this object.
+    // Hand it to the shader reloader if you want the variant kept up to date.
+    GLuint& get(uint32_t mask)
+    {
+        auto existing = variants.find(mask);
+        if (existing != variants.end())
+            return *existing->second;
+
+        std::vector<std::string> defines = definesFor(mask);
+        GLuint vertexShader = shader(GL_VERTEX_SHADER, preprocessor.preprocess(vertexPath, defines).source);
+        GLuint fragmentShader = shader(GL_FRAGMENT_SHADER, preprocessor.preprocess(fragmentPath, defines).source);
+
+        GLuint shaderProgram = glCreateProgram();
+        glAttachShader(shaderProgram, vertexShader);
+        glAttachShader(shaderProgram, fragmentShader);
+        glLinkProgram(shaderProgram);
+        std::string name = vertexPath + " + " + fragmentPath + " (mask " + std::to_string(mask) + ")";
+        finishProgramLink(shaderProgram, name.c_str());
+        // Detach so the cached shader objects can be deleted independently later
+        glDetachShader(shaderProgram, vertexShader);
+        glDetachShader(shaderProgram, fragmentShader);
+        linked++;
+        std::unique_ptr<GLuint>& program = variants[mask];
+        program = std::make_unique<GLuint>(shaderProgram);
+        return *program;
+    }
+
+    std::vector<std::string> definesFor(uint32_t mask) const
+    {
+        std::vector<std::string> defines;
+        for (size_t i = 0; i < features.size(); i++)
+            if (mask & (1u << i))
+                defines.push_back(features[i]);
+        return defines;
+    }
+
+    void clear()
+    {
+        for (auto& variant : variants)
+            glDeleteProgram(*variant.second);
+        for (auto& shader : shaders)
+            glDeleteShader(shader.second);
+        shaders.clear();
+        variants.clear();
+    }
+
+    const std::string vertexPath;
+    const std::string fragmentPath;
+
+    // How many shaders were actually compiled vs handed out from the cache, and programs linked
+    int compiled = 0;
+    int reused = 0;
+    int linked = 0;
+
+private:
+    GLuint shader(GLenum type, const std::string& source)
+    {
+        // Keyed by stage too, just in case a vertex and fragment shader ever end up with the same text
+        GLuint& shader = shaders[std::to_string(type) + source];
+        if (shader)
+        {
+            reused++;
+            return shader;
+        }
+        shader = startShaderCompile(type, source);
+        compiled++;
+        return shader;
+    }
+
+    ShaderPreprocessor& preprocessor;
+    std::vector<std::string> features;
+    std::unordered_map<std::string, GLuint> shaders;
+    // Owned through pointers so the handles don't move when the map grows
+    std::map<uint32_t, std::unique_ptr<GLuint>> variants;
+};
@@ -0,0 +1,460 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "context_manager.h"
+#include "gl_features.h"
+#include "shader.h"
+#include "shader_preprocessor.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Watches the shader directory and rebuilds any program whose sources were saved.
+//
+// There are two threads involved:
+//  - The watcher thread blocks on inotify, and when a file changes it preprocesses the sources again for
+//    every program using that file (including through an #include). That way the render thread never
+//    touches the disk.
+//  - The render thread calls update() once a frame. It hands the sources to the driver, and on later
+//    frames checks if the driver is done. Only once the new program linked does it replace the handle,
+//    so a frame either draws with the old program or the new one, never something half built.
+//    If the new program fails, the old one just keeps going and the error is printed.
+//
+// GL_KHR_parallel_shader_compile lets us ask "are you done yet?" without blocking. Without it,
+// asking blocks until the driver has finished, which can be a long stall on the render thread. So
+// given a ContextManager, the watcher thread gets a headless context sharing with the others and
+// compiles and links there itself. It puts in a fence once the program is built, and the render
+// thread swaps it in once that fence has passed. Without the extension or a ContextManager the
+// render thread still waits at least one frame before asking, which gives threaded drivers a chance
+// to finish, but then it does stall for whatever's left.
+class ShaderReloader
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ~ShaderReloader()
+    {
+        stop();
+    }
+
+    // Must be called with the context current and after glFeatures.detect(), since it uses the parallel compile extension.
+    // contexts is only used without it, for the watcher thread's compile context, and has to outlive stop().
+    bool start(const char* directory, ShaderPreprocessor& preprocessor, ContextManager* contexts = nullptr)
+    {
+        this->preprocessor = &preprocessor;
+        this->directory = directory;
+        if (!this->directory.empty() && this->directory.back() != '/')
+            this->directory += '/';
+
+        parallelCompile = glFeatures.parallelShaderCompile;
+        if (parallelCompile)
+        {
+            // Let the driver use as many threads as it likes, it picks a sensible number by itself
+            typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+            PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads =
+                (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+            if (maxShaderCompilerThreads)
+                maxShaderCompilerThreads(0xFFFFFFFF);
+        }
+        else if (contexts)
+        {
+            // Made here since GLFW only makes windows on the main thread, the watcher makes it current
+            this->contexts = contexts;
+            compileContext = contexts->createHeadless("Shader compiles");
+        }
+
+#ifdef __linux__
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0)
+        {
+            std::cerr << "Shader reload disabled: inotify_init1 failed" << std::endl;
+            return false;
+        }
+        // Editors either write the file in place (IN_CLOSE_WRITE) or write a temp file and rename it over (IN_MOVED_TO)
+        if (inotify_add_watch(inotifyFd, this->directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            std::cerr << "Shader reload disabled: can't watch " << this->directory << std::endl;
+            close(inotifyFd);
+            inotifyFd = -1;
+            return false;
+        }
+        if (pipe(stopPipe) != 0)
+        {
+            close(inotifyFd);
+            inotifyFd = -1;
+            return false;
+        }
+        running = true;
+        watcher = std::thread(&ShaderReloader::watchLoop, this);
+        return true;
+#else
+        std::cerr << "Shader reload is only implemented with inotify (Linux)" << std::endl;
+        return false;
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        if (running)
+        {
+            running = false;
+            // Wake the watcher up out of poll()
+            char byte = 0;
+            if (write(stopPipe[1], &byte, 1) < 0) {}
+            watcher.join();
+            close(stopPipe[0]);
+            close(stopPipe[1]);
+        }
+        if (compileContext)
+        {
+            contexts->destroy(compileContext);
+            compileContext = NULL;
+        }
+        if (inotifyFd >= 0)
+        {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+#endif
+        // Anything still compiling is of no use to anyone now
+        for (Entry& entry : entries)
+        {
+            if (entry.pendingProgram)
+                glDeleteProgram(entry.pendingProgram);
+            if (entry.builtFence)
+                glDeleteSync(entry.builtFence);
+            entry.pendingProgram = 0;
+            entry.builtFence = 0;
+        }
+    }
+
+    // Registers a program to be rebuilt when any of its files change. The handle is updated in place,
+    // so whoever owns it must outlive the reloader (or call unwatch). The paths are the ones that were
+    // given to makeShaderProgram, relative to the working directory, and the defines are the ones
+    // the program was preprocessed with.
+    void watch(GLuint& program, const std::string& vertexPath, const std::string& fragmentPath, const std::vector<std::string>& defines = {})
+    {
+        // Cached by whoever built the program already, so this is just a lookup
+        std::vector<std::string> files;
+        if (preprocessor)
+        {
+            files = preprocessor->preprocess(vertexPath, defines).files;
+            std::vector<std::string> fragmentFiles = preprocessor->preprocess(fragmentPath, defines).files;
+            files.insert(files.end(), fragmentFiles.begin(), fragmentFiles.end());
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry* entry = nullptr;
+        for (Entry& existing : entries)
+            if (existing.program == &program)
+                entry = &existing;
+        if (!entry)
+        {
+            entries.emplace_back();
+            entry = &entries.back();
+            entry->program = &program;
+        }
+        entry->vertexPath = vertexPath;
+        entry->fragmentPath = fragmentPath;
+        entry->defines = defines;
+        entry->files = files;
+    }
+
+    void unwatch(GLuint& program)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            if (entries[i].program == &program)
+            {
+                if (entries[i].pendingProgram)
+                    glDeleteProgram(entries[i].pendingProgram);
+                if (entries[i].builtFence)
+                    glDeleteSync(entries[i].builtFence);
+                entries.erase(entries.begin() + i);
+                return;
+            }
+        }
+    }
+
+    // Call once per frame on the render thread, before drawing.
+    // Returns true if any program handle was swapped this frame.
+    bool update()
+    {
+        bool swapped = false;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Entry& entry : entries)
+        {
+            // Kick off the compile of freshly read sources. If we were already building an older version
+            // of this program there's no point finishing it.
+            if (entry.sourcesReady)
+            {
+                if (entry.pendingProgram)
+                    glDeleteProgram(entry.pendingProgram);
+                GLuint vertexShader = startShaderCompile(GL_VERTEX_SHADER, entry.vertexSource);
+                GLuint fragmentShader = startShaderCompile(GL_FRAGMENT_SHADER, entry.fragmentSource);
+                entry.pendingProgram = startProgramLink(vertexShader, fragmentShader);
+                entry.pendingSince = entry.changedAt;
+                entry.sourcesReady = false;
+                entry.vertexSource.clear();
+                entry.fragmentSource.clear();
+                continue;
+            }
+
+            if (!entry.pendingProgram)
+                continue;
+
+            // Built and linked by the watcher thread, it just has to have got to the GPU
+            if (entry.builtFence)
+            {
+                GLenum status = glClientWaitSync(entry.builtFence, 0, 0);
+                if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                    continue;
+                glDeleteSync(entry.builtFence);
+                entry.builtFence = 0;
+                GLuint old = *entry.program;
+                *entry.program = entry.pendingProgram;
+                if (old)
+                    glDeleteProgram(old);
+                swappedThisFrame.push_back({ entry.vertexPath + " + " + entry.fragmentPath, entry.pendingSince });
+                swapped = true;
+                entry.pendingProgram = 0;
+                continue;
+            }
+
+            // We're at least a frame past the kick off now, but if the driver can tell us it isn't done
+            // yet then there's no reason to block on it
+            if (parallelCompile)
+            {
+                GLint done = GL_FALSE;
+                glGetProgramiv(entry.pendingProgram, GL_COMPLETION_STATUS_KHR, &done);
+                if (!done)
+                    continue;
+            }
+
+            std::string name = entry.vertexPath + " + " + entry.fragmentPath;
+            if (finishProgramLink(entry.pendingProgram, name.c_str()))
+            {
+                GLuint old = *entry.program;
+                *entry.program = entry.pendingProgram;
+                // The old program may still be referenced by commands in flight, the driver keeps it alive until they're done
+                if (old)
+                    glDeleteProgram(old);
+                swappedThisFrame.push_back({ name, entry.pendingSince });
+                swapped = true;
+            }
+            else
+            {
+                std::cerr << "Keeping the previous version of " << name << std::endl;
+                glDeleteProgram(entry.pendingProgram);
+            }
+            entry.pendingProgram = 0;
+        }
+        return swapped;
+    }
+
+    // Call right after glfwSwapBuffers, so the latency covers the first frame that used the new program
+    void framePresented()
+    {
+        if (swappedThisFrame.empty())
+            return;
+        Clock::time_point now = Clock::now();
+        for (const Swap& swap : swappedThisFrame)
+        {
+            double ms = std::chrono::duration<double, std::milli>(now - swap.changedAt).count();
+            std::cout << "Reloaded " << swap.name << " in " << ms << "ms (file save to first frame)" << std::endl;
+        }
+        swappedThisFrame.clear();
+    }
+
+private:
+    struct Entry
+    {
+        GLuint* program = nullptr;
+        std::string vertexPath;
+        std::string fragmentPath;
+        std::vector<std::string> defines;
+        std::vector<std::string> files;
+
+        // Filled in by the watcher thread
+        bool sourcesReady = false;
+        std::string vertexSource;
+        std::string fragmentSource;
+        Clock::time_point changedAt;
+
+        // Owned by the render thread, unless the watcher thread built the program, in which case
+        // builtFence says when it can be used
+        GLuint pendingProgram = 0;
+        GLsync builtFence = 0;
+        Clock::time_point pendingSince;
+    };
+
+    struct Swap
+    {
+        std::string name;
+        Clock::time_point changedAt;
+    };
+
+#ifdef __linux__
+    void watchLoop()
+    {
+        // inotify events are variable length, this is enough for plenty of them at once
+        alignas(struct inotify_event) char buffer[4096];
+        pollfd fds[2] = {
+            { inotifyFd, POLLIN, 0 },
+            { stopPipe[0], POLLIN, 0 },
+        };
+        bool building = compileContext && contexts->makeCurrent(compileContext);
+        while (running)
+        {
+            if (poll(fds, 2, -1) <= 0 || (fds[1].revents & POLLIN))
+                continue;
+
+            Clock::time_point changedAt = Clock::now();
+            std::vector<std::string> changed;
+            ssize_t length;
+            while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+            {
+                for (char* ptr = buffer; ptr < buffer + length; )
+                {
+                    const struct inotify_event* event = (const struct inotify_event*)ptr;
+                    if (event->len)
+                        changed.push_back(event->name);
+                    ptr += sizeof(struct inotify_event) + event->len;
+                }
+            }
+            if (changed.empty())
+                continue;
+
+            for (const std::string& name : changed)
+                preprocessor->invalidate(name);
+
+            // Copy out which programs need rebuilding, then do the reading without holding the lock
+            std::vector<Entry> affected;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (const Entry& entry : entries)
+                {
+                    bool uses = false;
+                    for (const std::string& file : entry.files)
+                        for (const std::string& name : changed)
+                            uses |= ShaderPreprocessor::fileName(file) == name;
+                    if (uses)
+                    {
+                        affected.push_back(entry);
+                        // Those are the render thread's, the copy gets its own if it's built here
+                        affected.back().pendingProgram = 0;
+                        affected.back().builtFence = 0;
+                    }
+                }
+            }
+            for (Entry& entry : affected)
+            {
+                PreprocessedShader vertex = preprocessor->preprocess(entry.vertexPath, entry.defines);
+                PreprocessedShader fragment = preprocessor->preprocess(entry.fragmentPath, entry.defines);
+                entry.vertexSource = std::move(vertex.source);
+                entry.fragmentSource = std::move(fragment.source);
+                // An #include may have been added or removed
+                entry.files = std::move(vertex.files);
+                entry.files.insert(entry.files.end(), fragment.files.begin(), fragment.files.end());
+                if (building && !entry.vertexSource.empty() && !entry.fragmentSource.empty())
+                    buildOnWatcher(entry);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            for (Entry& source : affected)
+            {
+                // The entry may have been unwatched in the meantime
+                for (Entry& entry : entries)
+                {
+                    if (entry.program != source.program)
+                        continue;
+                    // Half written files read back empty, wait for the next event instead
+                    if (source.vertexSource.empty() || source.fragmentSource.empty())
+                        break;
+                    entry.files = std::move(source.files);
+                    if (building)
+                    {
+                        // Replaces a build the render thread hasn't picked up yet. If this one failed
+                        // the error's been printed and whatever was there stays.
+                        if (!source.pendingProgram)
+                            break;
+                        if (entry.pendingProgram)
+                            glDeleteProgram(entry.pendingProgram);
+                        if (entry.builtFence)
+                            glDeleteSync(entry.builtFence);
+                        entry.pendingProgram = source.pendingProgram;
+                        entry.builtFence = source.builtFence;
+                        entry.pendingSince = changedAt;
+                        source.pendingProgram = 0;
+                        break;
+                    }
+                    entry.vertexSource = std::move(source.vertexSource);
+                    entry.fragmentSource = std::move(source.fragmentSource);
+                    entry.changedAt = changedAt;
+                    entry.sourcesReady = true;
+                    break;
+                }
+                // Built for an entry that's been unwatched since
+                if (source.pendingProgram)
+                {
+                    glDeleteProgram(source.pendingProgram);
+                    glDeleteSync(source.builtFence);
+                }
+            }
+        }
+        if (building)
+            contexts->release();
+    }
+
+    // Compiles and links entry's sources on the watcher thread's context, blocking there rather than
+    // on the render thread. Leaves the program and a fence after it in entry, or nothing if it failed.
+    void buildOnWatcher(Entry& entry)
+    {
+        std::string name = entry.vertexPath + " + " + entry.fragmentPath;
+        GLuint vertexShader = startShaderCompile(GL_VERTEX_SHADER, entry.vertexSource);
+        GLuint fragmentShader = startShaderCompile(GL_FRAGMENT_SHADER, entry.fragmentSource);
+        GLuint program = startProgramLink(vertexShader, fragmentShader);
+        if (!finishProgramLink(program, name.c_str()))
+        {
+            std::cerr << "Keeping the previous version of " << name << std::endl;
+            glDeleteProgram(program);
+            return;
+        }
+        entry.pendingProgram = program;
+        entry.builtFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // Otherwise the fence might never get to the GPU for the render thread to see it pass
+        glFlush();
+    }
+
+    int inotifyFd = -1;
+    int stopPipe[2] = { -1, -1 };
+#endif
+
+    std::string directory;
+    ShaderPreprocessor* preprocessor = nullptr;
+    bool parallelCompile = false;
+    // Only without parallel compiles, see above
+    ContextManager* contexts = nullptr;
+    GLFWwindow* compileContext = NULL;
+    std::atomic<bool> running{ false };
+    std::thread watcher;
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    std::vector<Swap> swappedThisFrame;
+};
@@ -0,0 +1,338 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+// Vectors, matrices and quaternions for transforms, cameras and culling.
+//
+// Everything small (vector maths, building matrices) is plain constexpr code, so it can run at compile
+// time and the compiler is free to vectorise it however it likes. The parts that run over lots of data
+// each frame use SIMD directly:
+//  - Mat4 * Mat4, and the batched multiplyMatrices()
+//  - transformPoints() for arrays of points, with a faster version for points stored as separate
+//    x, y and z arrays (structure of arrays), 8 at a time with AVX or 4 with SSE/NEON
+// Every SIMD function has a constexpr ...Scalar twin that gives the same answer, which is what
+// tools/bench_math compares against. Define MATH_SCALAR to use those everywhere.
+//
+// Matrices are column major like GL: columns[3] is the translation and they can go straight to
+// glUniformMatrix4fv. They multiply column vectors, so a * b applies b first.
+#if !defined(MATH_SCALAR)
+#if defined(__AVX__)
+#define MATH_AVX 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SSE 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MATH_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+struct Vec3
+{
+    float x, y, z;
+};
+
+struct alignas(16) Vec4
+{
+    float x, y, z, w;
+};
+
+struct alignas(16) Mat4
+{
+    Vec4 columns[4];
+};
+
+// x, y, z is the axis scaled by sin(angle / 2), w is cos(angle / 2)
+struct Quat
+{
+    float x, y, z, w;
+};
+
+constexpr Vec3 operator+(Vec3 a, Vec3 b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+constexpr Vec3 operator-(Vec3 a, Vec3 b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+constexpr Vec3 operator-(Vec3 a) { return { -a.x, -a.y, -a.z }; }
+constexpr Vec3 operator*(Vec3 a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+constexpr Vec3 operator*(float s, Vec3 a) { return a * s; }
+constexpr float dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr Vec3 cross(Vec3 a, Vec3 b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+inline float length(Vec3 a) { return sqrtf(dot(a, a)); }
+inline Vec3 normalize(Vec3 a) { float l = length(a); return l > 0.0f ? a * (1.0f / l) : a; }
+
+constexpr Vec4 operator+(Vec4 a, Vec4 b) { return { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
+constexpr Vec4 operator-(Vec4 a, Vec4 b) { return { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; }
+constexpr Vec4 operator*(Vec4 a, float s) { return { a.x * s, a.y * s, a.z * s, a.w * s }; }
+constexpr float dot(Vec4 a, Vec4 b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+constexpr Mat4 identity()
+{
+    return { { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } } };
+}
+
+constexpr Mat4 translation(Vec3 t)
+{
+    return { { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { t.x, t.y, t.z, 1 } } };
+}
+
+constexpr Mat4 scaling(Vec3 s)
+{
+    return { { { s.x, 0, 0, 0 }, { 0, s.y, 0, 0 }, { 0, 0, s.z, 0 }, { 0, 0, 0, 1 } } };
+}
+
+// Scale, then rotate, then translate, all in one go
+constexpr Mat4 compose(Vec3 t, Quat q, Vec3 s)
+{
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    return { {
+        { (1 - 2 * (yy + zz)) * s.x, 2 * (xy + wz) * s.x, 2 * (xz - wy) * s.x, 0 },
+        { 2 * (xy - wz) * s.y, (1 - 2 * (xx + zz)) * s.y, 2 * (yz + wx) * s.y, 0 },
+        { 2 * (xz + wy) * s.z, 2 * (yz - wx) * s.z, (1 - 2 * (xx + yy)) * s.z, 0 },
+        { t.x, t.y, t.z, 1 },
+    } };
+}
+
+constexpr Mat4 rotation(Quat q)
+{
+    return compose({ 0, 0, 0 }, q, { 1, 1, 1 });
+}
+
+// GL style projection, depth ends up in -1 to 1. fovY is in radians.
+inline Mat4 perspective(float fovY, float aspect, float zNear, float zFar)
+{
+    float f = 1.0f / tanf(fovY / 2.0f);
+    return { {
+        { f / aspect, 0, 0, 0 },
+        { 0, f, 0, 0 },
+        { 0, 0, (zFar + zNear) / (zNear - zFar), -1 },
+        { 0, 0, 2 * zFar * zNear / (zNear - zFar), 0 },
+    } };
+}
+
+// A view matrix for a camera at eye looking at target
+inline Mat4 lookAt(Vec3 eye, Vec3 target, Vec3 up)
+{
+    Vec3 f = normalize(target - eye);
+    Vec3 s = normalize(cross(f, up));
+    Vec3 u = cross(s, f);
+    return { {
+        { s.x, u.x, -f.x, 0 },
+        { s.y, u.y, -f.y, 0 },
+        { s.z, u.z, -f.z, 0 },
+        { -dot(s, eye), -dot(u, eye), dot(f, eye), 1 },
+    } };
+}
+
+constexpr Quat operator*(Quat a, Quat b)
+{
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+    };
+}
+
+inline Quat axisAngle(Vec3 axis, float angle)
+{
+    Vec3 a = normalize(axis) * sinf(angle / 2.0f);
+    return { a.x, a.y, a.z, cosf(angle / 2.0f) };
+}
+
+inline Quat normalize(Quat q)
+{
+    float l = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    return l > 0.0f ? Quat{ q.x / l, q.y / l, q.z / l, q.w / l } : q;
+}
+
+constexpr Vec3 rotate(Quat q, Vec3 v)
+{
+    Vec3 axis = { q.x, q.y, q.z };
+    Vec3 t = cross(axis, v) * 2.0f;
+    return v + t * q.w + cross(axis, t);
+}
+
+// Blends between two rotations, good enough when they're close (like between animation keys)
+inline Quat nlerp(Quat a, Quat b, float t)
+{
+    float sign = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f ? -1.0f : 1.0f;
+    return normalize(Quat{ a.x + (b.x * sign - a.x) * t, a.y + (b.y * sign - a.y) * t, a.z + (b.z * sign - a.z) * t, a.w + (b.w * sign - a.w) * t });
+}
+
+// ---- Matrix multiply ----
+
+// a's columns weighted by the components of v, which is a * v
+constexpr Vec4 combineColumns(const Mat4& a, Vec4 v)
+{
+    return a.columns[0] * v.x + a.columns[1] * v.y + a.columns[2] * v.z + a.columns[3] * v.w;
+}
+
+constexpr Mat4 multiplyScalar(const Mat4& a, const Mat4& b)
+{
+    return { { combineColumns(a, b.columns[0]), combineColumns(a, b.columns[1]), combineColumns(a, b.columns[2]), combineColumns(a, b.columns[3]) } };
+}
+
+// a * b on raw column major arrays of 16 floats, which don't need to be aligned. out can't be a or b.
+inline void multiplyMatrix(const float* a, const float* b, float* out)
+{
+#if defined(MATH_AVX)
+    // Two columns of the result at a time, one in each half of the register
+    __m256 a0 = _mm256_broadcast_ps((const __m128*)a), a1 = _mm256_broadcast_ps((const __m128*)(a + 4));
+    __m256 a2 = _mm256_broadcast_ps((const __m128*)(a + 8)), a3 = _mm256_broadcast_ps((const __m128*)(a + 12));
+    for (int column = 0; column < 4; column += 2)
+    {
+        __m256 bc = _mm256_loadu_ps(b + column * 4);
+        __m256 r = _mm256_add_ps(_mm256_mul_ps(a0, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0))),
+                                 _mm256_mul_ps(a1, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm256_add_ps(r, _mm256_add_ps(_mm256_mul_ps(a2, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2))),
+                                           _mm256_mul_ps(a3, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3)))));
+        _mm256_storeu_ps(out + column * 4, r);
+    }
+#elif defined(MATH_SSE)
+    __m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4), a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+    for (int column = 0; column < 4; column++)
+    {
+        __m128 bc = _mm_loadu_ps(b + column * 4);
+        __m128 r = _mm_add_ps(_mm_mul_ps(a0, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0))),
+                              _mm_mul_ps(a1, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm_add_ps(r, _mm_add_ps(_mm_mul_ps(a2, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2))),
+                                     _mm_mul_ps(a3, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3)))));
+        _mm_storeu_ps(out + column * 4, r);
+    }
+#elif defined(MATH_NEON)
+    float32x4_t a0 = vld1q_f32(a), a1 = vld1q_f32(a + 4), a2 = vld1q_f32(a + 8), a3 = vld1q_f32(a + 12);
+    for (int column = 0; column < 4; column++)
+    {
+        float32x4_t bc = vld1q_f32(b + column * 4);
+        float32x4_t r = vmulq_lane_f32(a0, vget_low_f32(bc), 0);
+        r = vmlaq_lane_f32(r, a1, vget_low_f32(bc), 1);
+        r = vmlaq_lane_f32(r, a2, vget_high_f32(bc), 0);
+        r = vmlaq_lane_f32(r, a3, vget_high_f32(bc), 1);
+        vst1q_f32(out + column * 4, r);
+    }
+#else
+    Mat4 ma, mb;
+    memcpy(&ma, a, sizeof(Mat4));
+    memcpy(&mb, b, sizeof(Mat4));
+    Mat4 result = multiplyScalar(ma, mb);
+    memcpy(out, &result, sizeof(Mat4));
+#endif
+}
+
+static_assert(sizeof(Mat4) == 16 * sizeof(float), "Mat4 has to be exactly 16 floats for the raw array functions");
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b)
+{
+    Mat4 result;
+    multiplyMatrix(&a.columns[0].x, &b.columns[0].x, &result.columns[0].x);
+    return result;
+}
+
+// out[i] = a[i] * b[i]
+inline void multiplyMatrices(const Mat4* a, const Mat4* b, Mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        multiplyMatrix(&a[i].columns[0].x, &b[i].columns[0].x, &out[i].columns[0].x);
+}
+
+inline void multiplyMatricesScalar(const Mat4* a, const Mat4* b, Mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = multiplyScalar(a[i], b[i]);
+}
+
+// ---- Transforming points ----
+
+constexpr Vec3 transformPointScalar(const Mat4& m, Vec3 p)
+{
+    return {
+        m.columns[0].x * p.x + m.columns[1].x * p.y + m.columns[2].x * p.z + m.columns[3].x,
+        m.columns[0].y * p.x + m.columns[1].y * p.y + m.columns[2].y * p.z + m.columns[3].y,
+        m.columns[0].z * p.x + m.columns[1].z * p.y + m.columns[2].z * p.z + m.columns[3].z,
+    };
+}
+
+inline void transformPointsScalar(const Mat4& m, const Vec3* points, Vec3* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = transformPointScalar(m, points[i]);
+}
+
+// One point per SIMD register. Handy when the points are already in an array of Vec3, but the
+// structure of arrays version below is a lot faster.
+inline void transformPoints(const Mat4& m, const Vec3* points, Vec3* out, size_t count)
+{
+#if defined(MATH_SSE)
+    __m128 c0 = _mm_load_ps(&m.columns[0].x), c1 = _mm_load_ps(&m.columns[1].x);
+    __m128 c2 = _mm_load_ps(&m.columns[2].x), c3 = _mm_load_ps(&m.columns[3].x);
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(points[i].x)), _mm_mul_ps(c1, _mm_set1_ps(points[i].y))),
+                              _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(points[i].z)), c3));
+        alignas(16) float result[4];
+        _mm_store_ps(result, r);
+        memcpy(&out[i], result, sizeof(Vec3));
+    }
+#else
+    transformPointsScalar(m, points, out, count);
+#endif
+}
+
+inline void transformPointsScalar(const Mat4& m, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        Vec3 p = transformPointScalar(m, { x[i], y[i], z[i] });
+        outX[i] = p.x;
+        outY[i] = p.y;
+        outZ[i] = p.z;
+    }
+}
+
+// Points stored as separate x, y and z arrays, so each register holds the same component of several points
+inline void transformPoints(const Mat4& m, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ, size_t count)
+{
+    size_t i = 0;
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    const float* v = &m.columns[0].x;
+#endif
+#if defined(MATH_AVX)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+        for (int row = 0; row < 3; row++)
+        {
+            __m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(v[row]), px), _mm256_mul_ps(_mm256_set1_ps(v[4 + row]), py));
+            r = _mm256_add_ps(r, _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(v[8 + row]), pz), _mm256_set1_ps(v[12 + row])));
+            _mm256_storeu_ps((row == 0 ? outX : row == 1 ? outY : outZ) + i, r);
+        }
+    }
+#endif
+#if defined(MATH_SSE)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+        for (int row = 0; row < 3; row++)
+        {
+            __m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(v[row]), px), _mm_mul_ps(_mm_set1_ps(v[4 + row]), py));
+            r = _mm_add_ps(r, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(v[8 + row]), pz), _mm_set1_ps(v[12 + row])));
+            _mm_storeu_ps((row == 0 ? outX : row == 1 ? outY : outZ) + i, r);
+        }
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t px = vld1q_f32(x + i), py = vld1q_f32(y + i), pz = vld1q_f32(z + i);
+        for (int row = 0; row < 3; row++)
+        {
+            float32x4_t r = vmlaq_n_f32(vdupq_n_f32(v[12 + row]), px, v[row]);
+            r = vmlaq_n_f32(r, py, v[4 + row]);
+            r = vmlaq_n_f32(r, pz, v[8 + row]);
+            vst1q_f32((row == 0 ? outX : row == 1 ? outY : outZ) + i, r);
+        }
+    }
+#endif
+    transformPointsScalar(m, x + i, y + i, z + i, outX + i, outY + i, outZ + i, count - i);
+}
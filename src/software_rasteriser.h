@@ -0,0 +1,596 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "job_system.h"
+#include "simd_math.h"
+
+// Draws triangles on the CPU into a colour and depth buffer, following the same rules as GL closely
+// enough to check GPU output against (and to get pictures on machines without a GPU at all).
+//  - Positions are in clip space. Triangles are clipped against the near and far planes, everything
+//    else just gets cut off at the edges of the buffer.
+//  - A pixel is covered when its centre is inside the triangle. Centres exactly on an edge go to the
+//    triangle on the top or left of it, so pixels on a shared edge are only ever drawn once.
+//  - Colours are interpolated with perspective correction, depth is tested with LEQUAL and written,
+//    both sides of a triangle are drawn (no face culling, like the demos).
+//  - Colour is stored as RGBA8, with (0, 0) at the bottom left like glReadPixels.
+//
+// The screen is cut into tiles. Triangles are set up and dropped into the bins of the tiles they
+// touch, then each tile draws its bin in submission order, 4 pixels at a time with SSE/NEON. Both
+// steps can be split across a JobSystem, and since every tile is drawn the same way whichever thread
+// gets it, the result is identical for any number of threads.
+//
+// Leave the colour buffer out (withColour = false in resize) for depth only, e.g. for occluders.
+struct RasterStats
+{
+    size_t triangles = 0;
+    // Pixels that passed the depth test and were written
+    size_t pixels = 0;
+    double setupMs = 0.0;
+    double rasterMs = 0.0;
+};
+
+class SoftwareRasteriser
+{
+public:
+    static constexpr int TILE_SIZE = 32;
+
+    void resize(int width, int height, bool withColour = true)
+    {
+        this->width = width;
+        this->height = height;
+        // Rows padded to a multiple of 4 so the SIMD loop can always read and write 4 pixels
+        stride = (width + 3) & ~3;
+        tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+        tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+        depthBuffer.assign((size_t)stride * height, 1.0f);
+        colourBuffer.assign(withColour ? (size_t)stride * height : 0, 0);
+        tilePixels.assign((size_t)tilesX * tilesY, 0);
+        // The bins are per tile, so they're all the wrong shape now
+        bins.clear();
+    }
+
+    void clear(Vec4 colour, float depth = 1.0f)
+    {
+        std::fill(colourBuffer.begin(), colourBuffer.end(), packColour(colour.x, colour.y, colour.z, colour.w));
+        clearDepth(depth);
+    }
+
+    void clearDepth(float depth = 1.0f)
+    {
+        std::fill(depthBuffer.begin(), depthBuffer.end(), depth);
+    }
+
+    // Draws indexCount / 3 triangles. colours can be null when there's no colour buffer.
+    void drawTriangles(const Vec4* positions, const Vec4* colours, const uint32_t* indices, size_t indexCount, JobSystem* jobs = nullptr)
+    {
+        auto start = std::chrono::steady_clock::now();
+        size_t triangleCount = indexCount / 3;
+        stats = RasterStats();
+        stats.triangles = triangleCount;
+        if (triangleCount == 0 || width <= 0 || height <= 0)
+            return;
+
+        // Enough triangles per chunk to be worth a job, but never so many chunks that the bins
+        // (one set per chunk, so they can be filled without locking) get out of hand
+        size_t chunkSize = std::max(SETUP_CHUNK, (triangleCount + MAX_SETUP_CHUNKS - 1) / MAX_SETUP_CHUNKS);
+        size_t chunkCount = (triangleCount + chunkSize - 1) / chunkSize;
+        size_t tileCount = (size_t)tilesX * tilesY;
+        if (chunkTriangles.size() < chunkCount)
+            chunkTriangles.resize(chunkCount);
+        if (bins.size() < chunkCount * tileCount)
+            bins.resize(chunkCount * tileCount);
+
+        auto setup = [&](size_t begin, size_t end) {
+            size_t chunk = begin / chunkSize;
+            std::vector<Triangle>& triangles = chunkTriangles[chunk];
+            triangles.clear();
+            for (size_t tile = 0; tile < tileCount; tile++)
+                bins[chunk * tileCount + tile].clear();
+            for (size_t i = begin; i < end; i++)
+            {
+                ClipVertex corners[3];
+                for (int corner = 0; corner < 3; corner++)
+                {
+                    uint32_t index = indices[i * 3 + corner];
+                    corners[corner] = { positions[index], colours ? colours[index] : Vec4{ 1.0f, 1.0f, 1.0f, 1.0f } };
+                }
+                setupClipped(corners, triangles);
+            }
+            binTriangles(triangles, &bins[chunk * tileCount]);
+        };
+        if (jobs)
+            jobs->parallelFor(triangleCount, chunkSize, setup);
+        else
+            for (size_t begin = 0; begin < triangleCount; begin += chunkSize)
+                setup(begin, std::min(begin + chunkSize, triangleCount));
+        auto setupEnd = std::chrono::steady_clock::now();
+        stats.setupMs = std::chrono::duration<double, std::milli>(setupEnd - start).count();
+
+        auto raster = [&](size_t begin, size_t end) {
+            for (size_t tile = begin; tile < end; tile++)
+                rasteriseTile(tile, chunkCount);
+        };
+        if (jobs)
+            jobs->parallelFor(tileCount, 1, raster);
+        else
+            raster(0, tileCount);
+        for (size_t tile = 0; tile < tileCount; tile++)
+            stats.pixels += tilePixels[tile];
+        stats.rasterMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - setupEnd).count();
+
+        totals.triangles += stats.triangles;
+        totals.pixels += stats.pixels;
+        totals.setupMs += stats.setupMs;
+        totals.rasterMs += stats.rasterMs;
+    }
+
+    // For vertex data laid out the way the demos hand it to GL: floatsPerVertex floats per vertex with
+    // the position (x, y, z) first and an RGB colour at colourOffset, or -1 to give every vertex
+    // constantColour like the fixed colour shaders do. With no indices the vertices are drawn in
+    // order, like glDrawArrays.
+    void drawInterleaved(const float* vertices, size_t vertexCount, int floatsPerVertex, int colourOffset, Vec4 constantColour,
+        const uint32_t* indices = nullptr, size_t indexCount = 0, JobSystem* jobs = nullptr)
+    {
+        vertexPositions.resize(vertexCount);
+        vertexColours.resize(vertexCount);
+        for (size_t i = 0; i < vertexCount; i++)
+        {
+            const float* vertex = vertices + i * floatsPerVertex;
+            vertexPositions[i] = { vertex[0], vertex[1], vertex[2], 1.0f };
+            vertexColours[i] = colourOffset >= 0 ? Vec4{ vertex[colourOffset], vertex[colourOffset + 1], vertex[colourOffset + 2], 1.0f } : constantColour;
+        }
+        if (!indices)
+        {
+            vertexIndices.resize(vertexCount);
+            for (size_t i = 0; i < vertexCount; i++)
+                vertexIndices[i] = (uint32_t)i;
+            indices = vertexIndices.data();
+            indexCount = vertexCount;
+        }
+        drawTriangles(vertexPositions.data(), hasColour() ? vertexColours.data() : nullptr, indices, indexCount, jobs);
+    }
+
+    // Tightly packed RGBA bytes from the bottom row up, the same as glReadPixels with GL_RGBA and GL_UNSIGNED_BYTE
+    void readColour(std::vector<uint8_t>& rgba) const
+    {
+        rgba.resize((size_t)width * height * 4);
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                uint32_t colour = colourAt(x, y);
+                uint8_t* out = &rgba[((size_t)y * width + x) * 4];
+                out[0] = colour & 0xFF;
+                out[1] = (colour >> 8) & 0xFF;
+                out[2] = (colour >> 16) & 0xFF;
+                out[3] = colour >> 24;
+            }
+        }
+    }
+
+    // Red in the low byte up to alpha in the high byte
+    uint32_t colourAt(int x, int y) const
+    {
+        return hasColour() ? colourBuffer[(size_t)y * stride + x] : 0;
+    }
+
+    float depthAt(int x, int y) const
+    {
+        return depthBuffer[(size_t)y * stride + x];
+    }
+
+    // The depth buffer, rowStride() floats per row
+    const float* depth() const
+    {
+        return depthBuffer.data();
+    }
+
+    int rowStride() const
+    {
+        return stride;
+    }
+
+    int bufferWidth() const
+    {
+        return width;
+    }
+
+    int bufferHeight() const
+    {
+        return height;
+    }
+
+    bool hasColour() const
+    {
+        return !colourBuffer.empty();
+    }
+
+    // The last draw, and everything added up since the start
+    RasterStats stats;
+    RasterStats totals;
+
+private:
+    // Depth, 1/w, then colour/w for red, green, blue and alpha
+    static constexpr int PLANE_COUNT = 6;
+    static constexpr size_t SETUP_CHUNK = 256;
+    static constexpr size_t MAX_SETUP_CHUNKS = 64;
+    // Anything closer to the camera than this (in clip space w) gets clipped off
+    static constexpr float NEAR_W = 1e-5f;
+
+    struct ClipVertex
+    {
+        Vec4 position;
+        Vec4 colour;
+    };
+
+    // Everything needed to draw one triangle, worked out once and shared by every tile it touches
+    struct Triangle
+    {
+        // Each edge as edgeX * x + edgeY * y + edgeOffset, positive on the inside
+        float edgeX[3], edgeY[3], edgeOffset[3];
+        // Whether pixel centres exactly on the edge count as inside (top and left edges do)
+        bool inclusive[3];
+        // The values to interpolate as planes: value = planeX * x + planeY * y + planeOffset
+        float planeX[PLANE_COUNT], planeY[PLANE_COUNT], planeOffset[PLANE_COUNT];
+        int minX, minY, maxX, maxY;
+    };
+
+    static uint32_t packColour(float r, float g, float b, float a)
+    {
+        auto channel = [](float value) { return (uint32_t)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f); };
+        return channel(r) | channel(g) << 8 | channel(b) << 16 | channel(a) << 24;
+    }
+
+    // Clips against the near and far planes (and w > 0, which they imply apart from right at the
+    // eye), then sets up whatever is left as a fan of triangles
+    void setupClipped(const ClipVertex (&corners)[3], std::vector<Triangle>& out) const
+    {
+        auto distance = [](const Vec4& p, int plane) {
+            return plane == 0 ? p.z + p.w : plane == 1 ? p.w - p.z : p.w - NEAR_W;
+        };
+        bool inside = true;
+        for (const ClipVertex& corner : corners)
+            for (int plane = 0; plane < 3; plane++)
+                inside = inside && distance(corner.position, plane) >= 0.0f;
+        if (inside)
+        {
+            setupTriangle(corners[0], corners[1], corners[2], out);
+            return;
+        }
+
+        // Sutherland-Hodgman, each plane can add at most one corner
+        ClipVertex polygon[9], clipped[9];
+        int count = 3;
+        std::copy(corners, corners + 3, polygon);
+        for (int plane = 0; plane < 3 && count > 0; plane++)
+        {
+            int clippedCount = 0;
+            for (int i = 0; i < count; i++)
+            {
+                const ClipVertex& from = polygon[i];
+                const ClipVertex& to = polygon[(i + 1) % count];
+                float fromDistance = distance(from.position, plane), toDistance = distance(to.position, plane);
+                if (fromDistance >= 0.0f)
+                    clipped[clippedCount++] = from;
+                if ((fromDistance >= 0.0f) != (toDistance >= 0.0f))
+                {
+                    float t = fromDistance / (fromDistance - toDistance);
+                    clipped[clippedCount++] = { from.position + (to.position - from.position) * t, from.colour + (to.colour - from.colour) * t };
+                }
+            }
+            std::copy(clipped, clipped + clippedCount, polygon);
+            count = clippedCount;
+        }
+        for (int i = 1; i + 1 < count; i++)
+            setupTriangle(polygon[0], polygon[i], polygon[i + 1], out);
+    }
+
+    void setupTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, std::vector<Triangle>& out) const
+    {
+        // To the window: x and y in pixels from the bottom left, depth from 0 to 1
+        struct ScreenVertex
+        {
+            float x, y, z, inverseW;
+            Vec4 colour;
+        };
+        auto toScreen = [&](const ClipVertex& v) {
+            float inverseW = 1.0f / v.position.w;
+            return ScreenVertex{ (v.position.x * inverseW * 0.5f + 0.5f) * width, (v.position.y * inverseW * 0.5f + 0.5f) * height,
+                                 v.position.z * inverseW * 0.5f + 0.5f, inverseW, v.colour * inverseW };
+        };
+        ScreenVertex s0 = toScreen(a), s1 = toScreen(b), s2 = toScreen(c);
+
+        float area = (s1.x - s0.x) * (s2.y - s0.y) - (s1.y - s0.y) * (s2.x - s0.x);
+        if (!(area != 0.0f))
+            return;
+        // Both sides get drawn, so just flip the clockwise ones round
+        if (area < 0.0f)
+        {
+            std::swap(s1, s2);
+            area = -area;
+        }
+
+        Triangle triangle;
+        triangle.minX = std::max(0, (int)floorf(std::min({ s0.x, s1.x, s2.x })));
+        triangle.maxX = std::min(width - 1, (int)ceilf(std::max({ s0.x, s1.x, s2.x })));
+        triangle.minY = std::max(0, (int)floorf(std::min({ s0.y, s1.y, s2.y })));
+        triangle.maxY = std::min(height - 1, (int)ceilf(std::max({ s0.y, s1.y, s2.y })));
+        if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+            return;
+
+        // Edge i is opposite corner i, so its value over the area is that corner's barycentric weight
+        const ScreenVertex* corners[3] = { &s0, &s1, &s2 };
+        for (int i = 0; i < 3; i++)
+        {
+            const ScreenVertex& from = *corners[(i + 1) % 3];
+            const ScreenVertex& to = *corners[(i + 2) % 3];
+            triangle.edgeX[i] = from.y - to.y;
+            triangle.edgeY[i] = to.x - from.x;
+            triangle.edgeOffset[i] = from.x * to.y - from.y * to.x;
+            // Going down is a left edge, going left along a flat edge is a top edge
+            triangle.inclusive[i] = triangle.edgeX[i] > 0.0f || (triangle.edgeX[i] == 0.0f && triangle.edgeY[i] < 0.0f);
+        }
+
+        float inverseArea = 1.0f / area;
+        for (int plane = 0; plane < PLANE_COUNT; plane++)
+        {
+            auto value = [plane](const ScreenVertex& v) {
+                switch (plane)
+                {
+                case 0: return v.z;
+                case 1: return v.inverseW;
+                case 2: return v.colour.x;
+                case 3: return v.colour.y;
+                case 4: return v.colour.z;
+                default: return v.colour.w;
+                }
+            };
+            float v0 = value(s0), v1 = value(s1), v2 = value(s2);
+            triangle.planeX[plane] = (triangle.edgeX[0] * v0 + triangle.edgeX[1] * v1 + triangle.edgeX[2] * v2) * inverseArea;
+            triangle.planeY[plane] = (triangle.edgeY[0] * v0 + triangle.edgeY[1] * v1 + triangle.edgeY[2] * v2) * inverseArea;
+            triangle.planeOffset[plane] = (triangle.edgeOffset[0] * v0 + triangle.edgeOffset[1] * v1 + triangle.edgeOffset[2] * v2) * inverseArea;
+        }
+        out.push_back(triangle);
+    }
+
+#if defined(MATH_NEON)
+    // 32 bit ARM has no across-lanes instructions or divide, so these stick to what both have
+    static bool anyLane(uint32x4_t mask)
+    {
+        uint32x2_t half = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+        return (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) != 0;
+    }
+
+    static float32x4_t reciprocal(float32x4_t value)
+    {
+#if defined(__aarch64__)
+        return vdivq_f32(vdupq_n_f32(1.0f), value);
+#else
+        float32x4_t estimate = vrecpeq_f32(value);
+        estimate = vmulq_f32(vrecpsq_f32(value, estimate), estimate);
+        return vmulq_f32(vrecpsq_f32(value, estimate), estimate);
+#endif
+    }
+#endif
+
+    // Adds each triangle to the bins of the tiles it might cover. A tile is skipped when all of its
+    // pixel centres are outside one of the edges.
+    void binTriangles(const std::vector<Triangle>& triangles, std::vector<uint32_t>* chunkBins) const
+    {
+        for (size_t i = 0; i < triangles.size(); i++)
+        {
+            const Triangle& triangle = triangles[i];
+            for (int tileY = triangle.minY / TILE_SIZE; tileY <= triangle.maxY / TILE_SIZE; tileY++)
+            {
+                for (int tileX = triangle.minX / TILE_SIZE; tileX <= triangle.maxX / TILE_SIZE; tileX++)
+                {
+                    float x0 = tileX * TILE_SIZE + 0.5f, x1 = (tileX + 1) * TILE_SIZE - 0.5f;
+                    float y0 = tileY * TILE_SIZE + 0.5f, y1 = (tileY + 1) * TILE_SIZE - 0.5f;
+                    bool touches = true;
+                    for (int edge = 0; edge < 3 && touches; edge++)
+                    {
+                        // The corner furthest inside this edge
+                        float x = triangle.edgeX[edge] > 0.0f ? x1 : x0;
+                        float y = triangle.edgeY[edge] > 0.0f ? y1 : y0;
+                        touches = triangle.edgeX[edge] * x + (triangle.edgeY[edge] * y + triangle.edgeOffset[edge]) >= 0.0f;
+                    }
+                    if (touches)
+                        chunkBins[(size_t)tileY * tilesX + tileX].push_back((uint32_t)i);
+                }
+            }
+        }
+    }
+
+    void rasteriseTile(size_t tile, size_t chunkCount)
+    {
+        size_t tileCount = (size_t)tilesX * tilesY;
+        int tileX = (int)(tile % tilesX) * TILE_SIZE;
+        int tileY = (int)(tile / tilesX) * TILE_SIZE;
+        size_t pixels = 0;
+        for (size_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            const std::vector<Triangle>& triangles = chunkTriangles[chunk];
+            for (uint32_t index : bins[chunk * tileCount + tile])
+            {
+                const Triangle& triangle = triangles[index];
+                int minX = std::max(triangle.minX, tileX), maxX = std::min(triangle.maxX, tileX + TILE_SIZE - 1);
+                int minY = std::max(triangle.minY, tileY), maxY = std::min(triangle.maxY, tileY + TILE_SIZE - 1);
+                pixels += rasteriseRect(triangle, minX, minY, maxX, maxY);
+            }
+        }
+        tilePixels[tile] = pixels;
+    }
+
+    // Draws the part of the triangle inside the rectangle, returns how many pixels were written
+    size_t rasteriseRect(const Triangle& t, int minX, int minY, int maxX, int maxY)
+    {
+        size_t pixels = 0;
+        bool writeColour = hasColour();
+        // 4 pixels at a time from a multiple of 4, which is still inside the tile
+        minX &= ~3;
+#if defined(MATH_SSE)
+        const __m128 laneCentres = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+        const __m128 end = _mm_set1_ps((float)(maxX + 1));
+        __m128 inclusive[3];
+        for (int i = 0; i < 3; i++)
+            inclusive[i] = _mm_castsi128_ps(_mm_set1_epi32(t.inclusive[i] ? -1 : 0));
+#elif defined(MATH_NEON)
+        const float laneValues[4] = { 0.5f, 1.5f, 2.5f, 3.5f };
+        const float32x4_t laneCentres = vld1q_f32(laneValues);
+        const float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f);
+        const float32x4_t end = vdupq_n_f32((float)(maxX + 1));
+        uint32x4_t inclusive[3];
+        for (int i = 0; i < 3; i++)
+            inclusive[i] = vdupq_n_u32(t.inclusive[i] ? 0xFFFFFFFFu : 0u);
+#endif
+        for (int y = minY; y <= maxY; y++)
+        {
+            float py = y + 0.5f;
+            float* depthRow = &depthBuffer[(size_t)y * stride];
+            uint32_t* colourRow = writeColour ? &colourBuffer[(size_t)y * stride] : nullptr;
+            // The parts that are the same all along the row
+            float edgeRow[3], planeRow[PLANE_COUNT];
+            for (int i = 0; i < 3; i++)
+                edgeRow[i] = t.edgeY[i] * py + t.edgeOffset[i];
+            for (int i = 0; i < PLANE_COUNT; i++)
+                planeRow[i] = t.planeY[i] * py + t.planeOffset[i];
+            // Roughly where the row crosses the triangle, with a pixel to spare either side since the
+            // edge tests below are what decide exactly
+            float spanStart = (float)minX, spanEnd = (float)maxX;
+            for (int i = 0; i < 3; i++)
+            {
+                if (t.edgeX[i] > 0.0f)
+                    spanStart = std::max(spanStart, -edgeRow[i] / t.edgeX[i] - 1.5f);
+                else if (t.edgeX[i] < 0.0f)
+                    spanEnd = std::min(spanEnd, -edgeRow[i] / t.edgeX[i] + 0.5f);
+            }
+            if (spanStart > spanEnd)
+                continue;
+            int x = (int)spanStart & ~3;
+            int rowMaxX = (int)ceilf(spanEnd);
+#if defined(MATH_SSE)
+            for (; x <= rowMaxX; x += 4)
+            {
+                __m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneCentres);
+                // Lanes past the end of the rectangle belong to the next tile, or are off the edge of the screen
+                __m128 covered = _mm_cmplt_ps(px, end);
+                for (int i = 0; i < 3; i++)
+                {
+                    __m128 w = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.edgeX[i]), px), _mm_set1_ps(edgeRow[i]));
+                    __m128 inside = _mm_or_ps(_mm_cmpgt_ps(w, zero), _mm_and_ps(_mm_cmpeq_ps(w, zero), inclusive[i]));
+                    covered = _mm_and_ps(covered, inside);
+                }
+                if (_mm_movemask_ps(covered) == 0)
+                    continue;
+
+                __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.planeX[0]), px), _mm_set1_ps(planeRow[0]));
+                z = _mm_min_ps(_mm_max_ps(z, zero), one);
+                __m128 oldDepth = _mm_loadu_ps(depthRow + x);
+                __m128 pass = _mm_and_ps(covered, _mm_cmple_ps(z, oldDepth));
+                int passMask = _mm_movemask_ps(pass);
+                if (passMask == 0)
+                    continue;
+                _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(pass, z), _mm_andnot_ps(pass, oldDepth)));
+                pixels += (passMask & 1) + (passMask >> 1 & 1) + (passMask >> 2 & 1) + (passMask >> 3 & 1);
+
+                if (writeColour)
+                {
+                    __m128 inverseW = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.planeX[1]), px), _mm_set1_ps(planeRow[1]));
+                    __m128 w = _mm_div_ps(one, inverseW);
+                    __m128i packed = _mm_setzero_si128();
+                    for (int channel = 0; channel < 4; channel++)
+                    {
+                        __m128 value = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.planeX[2 + channel]), px), _mm_set1_ps(planeRow[2 + channel])), w);
+                        value = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(value, zero), one), _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f));
+                        packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_cvttps_epi32(value), channel * 8));
+                    }
+                    __m128 oldColour = _mm_loadu_ps((const float*)(colourRow + x));
+                    _mm_storeu_ps((float*)(colourRow + x), _mm_or_ps(_mm_and_ps(pass, _mm_castsi128_ps(packed)), _mm_andnot_ps(pass, oldColour)));
+                }
+            }
+#elif defined(MATH_NEON)
+            for (; x <= rowMaxX; x += 4)
+            {
+                float32x4_t px = vaddq_f32(vdupq_n_f32((float)x), laneCentres);
+                uint32x4_t covered = vcltq_f32(px, end);
+                for (int i = 0; i < 3; i++)
+                {
+                    float32x4_t w = vaddq_f32(vmulq_n_f32(px, t.edgeX[i]), vdupq_n_f32(edgeRow[i]));
+                    covered = vandq_u32(covered, vorrq_u32(vcgtq_f32(w, zero), vandq_u32(vceqq_f32(w, zero), inclusive[i])));
+                }
+                if (!anyLane(covered))
+                    continue;
+
+                float32x4_t z = vaddq_f32(vmulq_n_f32(px, t.planeX[0]), vdupq_n_f32(planeRow[0]));
+                z = vminq_f32(vmaxq_f32(z, zero), one);
+                float32x4_t oldDepth = vld1q_f32(depthRow + x);
+                uint32x4_t pass = vandq_u32(covered, vcleq_f32(z, oldDepth));
+                if (!anyLane(pass))
+                    continue;
+                vst1q_f32(depthRow + x, vbslq_f32(pass, z, oldDepth));
+                uint32x4_t passed = vshrq_n_u32(pass, 31);
+                uint32x2_t pairs = vpadd_u32(vget_low_u32(passed), vget_high_u32(passed));
+                pixels += vget_lane_u32(vpadd_u32(pairs, pairs), 0);
+
+                if (writeColour)
+                {
+                    float32x4_t inverseW = vaddq_f32(vmulq_n_f32(px, t.planeX[1]), vdupq_n_f32(planeRow[1]));
+                    float32x4_t w = reciprocal(inverseW);
+                    uint32x4_t packed = vdupq_n_u32(0);
+                    for (int channel = 0; channel < 4; channel++)
+                    {
+                        float32x4_t value = vmulq_f32(vaddq_f32(vmulq_n_f32(px, t.planeX[2 + channel]), vdupq_n_f32(planeRow[2 + channel])), w);
+                        value = vaddq_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(value, zero), one), 255.0f), vdupq_n_f32(0.5f));
+                        packed = vorrq_u32(packed, vshlq_u32(vcvtq_u32_f32(value), vdupq_n_s32(channel * 8)));
+                    }
+                    vst1q_u32(colourRow + x, vbslq_u32(pass, packed, vld1q_u32(colourRow + x)));
+                }
+            }
+#endif
+            for (; x <= rowMaxX; x++)
+            {
+                float px = x + 0.5f;
+                bool covered = true;
+                for (int i = 0; i < 3; i++)
+                {
+                    float w = t.edgeX[i] * px + edgeRow[i];
+                    covered = covered && (w > 0.0f || (w == 0.0f && t.inclusive[i]));
+                }
+                if (!covered)
+                    continue;
+                float z = std::min(std::max(t.planeX[0] * px + planeRow[0], 0.0f), 1.0f);
+                if (!(z <= depthRow[x]))
+                    continue;
+                depthRow[x] = z;
+                pixels++;
+                if (writeColour)
+                {
+                    float w = 1.0f / (t.planeX[1] * px + planeRow[1]);
+                    colourRow[x] = packColour((t.planeX[2] * px + planeRow[2]) * w, (t.planeX[3] * px + planeRow[3]) * w,
+                                              (t.planeX[4] * px + planeRow[4]) * w, (t.planeX[5] * px + planeRow[5]) * w);
+                }
+            }
+        }
+        return pixels;
+    }
+
+    int width = 0;
+    int height = 0;
+    int stride = 0;
+    int tilesX = 0;
+    int tilesY = 0;
+    std::vector<float> depthBuffer;
+    std::vector<uint32_t> colourBuffer;
+    // Set up triangles for each chunk of the draw, and each chunk's bins, chunk * tile count + tile
+    std::vector<std::vector<Triangle>> chunkTriangles;
+    std::vector<std::vector<uint32_t>> bins;
+    std::vector<size_t> tilePixels;
+    // Scratch space for drawInterleaved
+    std::vector<Vec4> vertexPositions;
+    std::vector<Vec4> vertexColours;
+    std::vector<uint32_t> vertexIndices;
+};
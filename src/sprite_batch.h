@@ -0,0 +1,157 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include "atlas.h"
+#include "gl_debug.h"
+#include "gl_objects.h"
+
+// Draws lots of textured quads with as few draw calls as it can. Sprites are collected on the CPU
+// and only drawn when the texture changes or the buffer fills up, so sprites that all come from
+// one atlas go out in a single call however many there are, while sprites that each have their
+// own texture cost a bind and a draw call apiece.
+//
+//   batch.begin(program);
+//   batch.draw(atlas.texture, x, y, width, height, atlas.entry(i).uv);
+//   batch.end();
+//
+// Positions are in clip space and sprites are drawn in the order they're given, later on top.
+
+struct SpriteVertex
+{
+    float x, y;
+    float u, v;
+    // RGBA, a byte each, so 0xAABBGGRR written as a number on little endian machines
+    uint32_t colour;
+};
+
+// Per frame (after end()) or added up
+struct SpriteStats
+{
+    size_t sprites = 0;
+    size_t drawCalls = 0;
+    size_t textureBinds = 0;
+
+    void add(const SpriteStats& other)
+    {
+        sprites += other.sprites;
+        drawCalls += other.drawCalls;
+        textureBinds += other.textureBinds;
+    }
+};
+
+class SpriteBatch
+{
+public:
+    // Calling it again replaces everything
+    void create(size_t maxSprites, const char* label = "Sprite batch")
+    {
+        capacity = maxSprites;
+        vertices.clear();
+        vertices.reserve(maxSprites * 4);
+
+        VAO = GLVertexArray::create();
+        glBindVertexArray(VAO);
+        VBO = GLBuffer::create();
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, maxSprites * 4 * sizeof(SpriteVertex), NULL, GL_STREAM_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, x));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, u));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, colour));
+        glEnableVertexAttribArray(2);
+
+        // Every quad is two triangles the same way round, so the indices never change
+        std::vector<uint32_t> indices(maxSprites * 6);
+        for (uint32_t i = 0; i < (uint32_t)maxSprites; i++)
+        {
+            uint32_t corner = i * 4;
+            uint32_t quad[] = { corner, corner + 1, corner + 2, corner, corner + 2, corner + 3 };
+            std::copy(quad, quad + 6, &indices[i * 6]);
+        }
+        EBO = GLBuffer::create();
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+        GL_DEBUG_LABEL(GL_VERTEX_ARRAY, VAO, label);
+        GL_DEBUG_LABEL(GL_BUFFER, VBO, label);
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void destroy()
+    {
+        VAO.reset();
+        VBO.reset();
+        EBO.reset();
+    }
+
+    void begin(GLuint program)
+    {
+        stats = SpriteStats();
+        currentTexture = 0;
+        vertices.clear();
+        glUseProgram(program);
+        glBindVertexArray(VAO);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    // A sprite with its bottom left corner at (x, y), showing the uv part of texture
+    void draw(GLuint texture, float x, float y, float width, float height, const UVRect& uv, uint32_t colour = 0xFFFFFFFFu)
+    {
+        if (texture != currentTexture || vertices.size() == capacity * 4)
+        {
+            flush();
+            if (texture != currentTexture)
+            {
+                glBindTexture(GL_TEXTURE_2D, texture);
+                currentTexture = texture;
+                stats.textureBinds++;
+            }
+        }
+        vertices.push_back({ x, y, uv.u0, uv.v0, colour });
+        vertices.push_back({ x + width, y, uv.u1, uv.v0, colour });
+        vertices.push_back({ x + width, y + height, uv.u1, uv.v1, colour });
+        vertices.push_back({ x, y + height, uv.u0, uv.v1, colour });
+        stats.sprites++;
+    }
+
+    void end()
+    {
+        flush();
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        totals.add(stats);
+        frames++;
+    }
+
+    // The last frame, and every frame added up
+    SpriteStats stats;
+    SpriteStats totals;
+    size_t frames = 0;
+
+private:
+    void flush()
+    {
+        if (vertices.empty())
+            return;
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        // Orphan the old contents so the driver doesn't have to wait for the last draw to finish with them
+        glBufferData(GL_ARRAY_BUFFER, capacity * 4 * sizeof(SpriteVertex), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(SpriteVertex), vertices.data());
+        glDrawElements(GL_TRIANGLES, (GLsizei)(vertices.size() / 4 * 6), GL_UNSIGNED_INT, 0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        stats.drawCalls++;
+        vertices.clear();
+    }
+
+    GLVertexArray VAO;
+    GLBuffer VBO;
+    GLBuffer EBO;
+    size_t capacity = 0;
+    std::vector<SpriteVertex> vertices;
+    GLuint currentTexture = 0;
+};
@@ -0,0 +1,168 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "gl_objects.h"
+#include "png.h"
+
+// Lots of same sized textures as the layers of one GL_TEXTURE_2D_ARRAY. Everything drawn from
+// them needs one bind between them, and each draw (or instance) just says which layer it wants,
+// so draws that would have each bound their own texture can be merged into one.
+//
+//   int layer = array.add(image);
+//   array.finish();    // rebuilds the mip levels of whatever was added
+//   glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture);
+//   // then texture(textures, vec3(uv, layer)) in the shader, with a sampler2DArray
+//
+// Unlike an atlas nothing needs padding or UV remapping, and mip levels and wrapping work as
+// they would on separate textures, but every layer has to be the same size.
+class TextureArray
+{
+public:
+    // Room for layers images of width x height. Needs a context.
+    bool create(int width, int height, int layers, const char* label = "Texture array")
+    {
+        GLint maxLayers = 0;
+        glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+        if (layers > maxLayers)
+        {
+            std::cerr << "Texture arrays can only have " << maxLayers << " layers, not " << layers << std::endl;
+            return false;
+        }
+        this->width = width;
+        this->height = height;
+        capacity = layers;
+        used = 0;
+        mipLevels = 1;
+        while ((std::max(width, height) >> mipLevels) > 0)
+            mipLevels++;
+
+        texture = GLTexture::create();
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        // glTexStorage3D is 4.2, so each level is made by hand. Layers don't shrink with the levels.
+        for (int level = 0; level < mipLevels; level++)
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, std::max(width >> level, 1), std::max(height >> level, 1), layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, mipLevels - 1);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        GL_DEBUG_LABEL(GL_TEXTURE, texture, label);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        return true;
+    }
+
+    void destroy()
+    {
+        texture.reset();
+        used = capacity = 0;
+    }
+
+    // Copies the image into the next free layer and returns it, or -1 if it's the wrong size or
+    // the array's full
+    int add(const Image& image)
+    {
+        if (image.width != width || image.height != height || used >= capacity)
+            return -1;
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, used, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, image.rgba.data());
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        needsMipmaps = true;
+        return used++;
+    }
+
+    // Rebuilds the smaller levels if anything's been added since last time. That redoes every
+    // layer, so add a batch and then finish rather than finishing after each one.
+    void finish()
+    {
+        if (!needsMipmaps)
+            return;
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        needsMipmaps = false;
+    }
+
+    bool full() const
+    {
+        return used >= capacity;
+    }
+
+    int layers() const
+    {
+        return used;
+    }
+
+    GLTexture texture;
+    int width = 0;
+    int height = 0;
+    int capacity = 0;
+    int mipLevels = 1;
+
+private:
+    int used = 0;
+    bool needsMipmaps = false;
+};
+
+// Where an image went in a TextureArrayPool
+struct TextureLayer
+{
+    // Which of the pool's arrays, and which layer of it
+    int array = -1;
+    int layer = -1;
+};
+
+// Sorts images into texture arrays by size, making a new array whenever there isn't one of that
+// size with room left. Images that are all the same size (like the photos in res/textures) end up
+// together, so drawing them needs one bind.
+class TextureArrayPool
+{
+public:
+    explicit TextureArrayPool(int layersPerArray = 64) : layersPerArray(layersPerArray) {}
+
+    TextureLayer add(const Image& image)
+    {
+        for (size_t i = 0; i < arrays.size(); i++)
+        {
+            TextureArray& array = arrays[i];
+            if (array.width == image.width && array.height == image.height && !array.full())
+                return { (int)i, array.add(image) };
+        }
+        arrays.emplace_back();
+        std::string label = "Texture array " + std::to_string(image.width) + "x" + std::to_string(image.height);
+        if (!arrays.back().create(image.width, image.height, layersPerArray, label.c_str()))
+        {
+            arrays.pop_back();
+            return {};
+        }
+        return { (int)arrays.size() - 1, arrays.back().add(image) };
+    }
+
+    // Rebuilds the mip levels of every array that's had something added
+    void finish()
+    {
+        for (TextureArray& array : arrays)
+            array.finish();
+    }
+
+    TextureArray& array(int index)
+    {
+        return arrays[index];
+    }
+
+    size_t count() const
+    {
+        return arrays.size();
+    }
+
+    void destroy()
+    {
+        arrays.clear();
+    }
+
+private:
+    int layersPerArray;
+    std::vector<TextureArray> arrays;
+};
@@ -0,0 +1,219 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "gl_objects.h"
+
+// Uniform buffer objects, and the std140/std430 layout rules so C++ structs can be checked against
+// the GLSL blocks at compile time.
+//
+// The rules (see section 7.6.2.2 of the GL 4.6 spec) come down to:
+//  - scalars align to 4, vec2 to 8, vec3 and vec4 to 16 (a vec3 is still only 12 bytes though)
+//  - a mat4 is an array of 4 vec4 columns
+//  - in std140 every array element is rounded up to 16 bytes, std430 (shader storage blocks only) doesn't
+// The std140 types below have the same alignment in C++, so a struct made of them usually comes out
+// right by itself. The one trap is a scalar after a vec3, which GLSL packs into the vec3's last 4 bytes
+// but C++ puts after the padding. That's what the static_asserts are for.
+namespace std140
+{
+    struct alignas(8) vec2 { float x, y; };
+    struct alignas(16) vec3 { float x, y, z; };
+    struct alignas(16) vec4 { float x, y, z, w; };
+    struct alignas(16) mat4 { vec4 columns[4]; };
+
+    // Arrays in std140 pad each element out to 16 bytes
+    template <typename T, size_t N>
+    struct array
+    {
+        struct alignas(16) Element { T value; };
+        Element elements[N];
+
+        T& operator[](size_t i) { return elements[i].value; }
+        const T& operator[](size_t i) const { return elements[i].value; }
+    };
+}
+
+enum class BlockPacking
+{
+    Std140,
+    Std430,
+};
+
+// Base alignment and size of each GLSL type, before any array rules
+template <typename T> struct GLSLType;
+template <> struct GLSLType<float> { static constexpr size_t align = 4, size = 4; };
+template <> struct GLSLType<int32_t> { static constexpr size_t align = 4, size = 4; };
+template <> struct GLSLType<uint32_t> { static constexpr size_t align = 4, size = 4; };
+template <> struct GLSLType<std140::vec2> { static constexpr size_t align = 8, size = 8; };
+template <> struct GLSLType<std140::vec3> { static constexpr size_t align = 16, size = 12; };
+template <> struct GLSLType<std140::vec4> { static constexpr size_t align = 16, size = 16; };
+template <> struct GLSLType<std140::mat4> { static constexpr size_t align = 16, size = 64; };
+
+constexpr size_t roundUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Alignment and size of a member inside a block with the given packing, arrays included
+template <BlockPacking Packing, typename T>
+struct BlockMember
+{
+    static constexpr size_t align = GLSLType<T>::align;
+    static constexpr size_t size = GLSLType<T>::size;
+};
+
+template <BlockPacking Packing, typename T, size_t N>
+struct BlockMember<Packing, T[N]>
+{
+    static constexpr size_t stride = Packing == BlockPacking::Std140 ? roundUp(GLSLType<T>::size, 16) : roundUp(GLSLType<T>::size, GLSLType<T>::align);
+    static constexpr size_t align = Packing == BlockPacking::Std140 ? roundUp(GLSLType<T>::align, 16) : GLSLType<T>::align;
+    static constexpr size_t size = stride * N;
+};
+
+template <BlockPacking Packing, typename T, size_t N>
+struct BlockMember<Packing, std140::array<T, N>> : BlockMember<Packing, T[N]>
+{
+};
+
+// Works out where each member of a block goes. List the members in the order the GLSL block has them:
+//   using PerFrameLayout = BlockLayout<BlockPacking::Std140, float, std140::vec4>;
+//   static_assert(PerFrameLayout::offsets[1] == offsetof(PerFrame, tint));
+template <BlockPacking Packing, typename... Members>
+struct BlockLayout
+{
+    static constexpr size_t count = sizeof...(Members);
+
+    static constexpr std::array<size_t, count> computeOffsets()
+    {
+        constexpr size_t aligns[] = { BlockMember<Packing, Members>::align... };
+        constexpr size_t sizes[] = { BlockMember<Packing, Members>::size... };
+        std::array<size_t, count> result{};
+        size_t offset = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            offset = roundUp(offset, aligns[i]);
+            result[i] = offset;
+            offset += sizes[i];
+        }
+        return result;
+    }
+
+    static constexpr size_t computeSize()
+    {
+        constexpr size_t aligns[] = { BlockMember<Packing, Members>::align... };
+        constexpr size_t sizes[] = { BlockMember<Packing, Members>::size... };
+        size_t offset = 0;
+        size_t maxAlign = Packing == BlockPacking::Std140 ? 16 : 4;
+        for (size_t i = 0; i < count; i++)
+        {
+            offset = roundUp(offset, aligns[i]) + sizes[i];
+            maxAlign = aligns[i] > maxAlign ? aligns[i] : maxAlign;
+        }
+        // The whole block is padded out to its biggest alignment, like a struct
+        return roundUp(offset, maxAlign);
+    }
+
+    static constexpr std::array<size_t, count> offsets = computeOffsets();
+    static constexpr size_t size = computeSize();
+};
+
+// Checks a C++ struct member sits where the block layout says it should
+#define CHECK_BLOCK_MEMBER(Layout, Struct, index, member) \
+    static_assert(Layout::offsets[index] == offsetof(Struct, member), #Struct "::" #member " doesn't match the GLSL block layout")
+
+#define CHECK_BLOCK_SIZE(Layout, Struct) \
+    static_assert(Layout::size == sizeof(Struct), #Struct " isn't the same size as the GLSL block")
+
+// A single block of data that gets replaced (usually) once a frame
+template <typename T>
+class UniformBuffer
+{
+public:
+    // Calling it again replaces the buffer (the old one is deleted)
+    void create(const char* label = "uniform buffer")
+    {
+        buffer = GLBuffer::create();
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(T), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        GL_DEBUG_LABEL(GL_BUFFER, buffer, label);
+    }
+
+    void destroy()
+    {
+        buffer.reset();
+    }
+
+    // Uploads data and binds the whole buffer to the binding point the shaders read it from
+    void upload(GLuint binding)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(T), &data);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+    }
+
+    T data{};
+    GLBuffer buffer;
+};
+
+// Lots of blocks of the same type in one buffer, one per object. Everything is written on the CPU,
+// then uploaded with a single call, and each draw picks its block with glBindBufferRange.
+// The blocks have to start at a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT (often 256 bytes),
+// so they're spaced out by that much rather than packed together.
+template <typename T>
+class UniformArrayBuffer
+{
+public:
+    // Calling it again replaces the buffer (the old one is deleted)
+    void create(size_t capacity, const char* label = "uniform array buffer")
+    {
+        GLint alignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        stride = roundUp(sizeof(T), (size_t)alignment);
+        this->capacity = capacity;
+        staging.assign(stride * capacity, 0);
+
+        buffer = GLBuffer::create();
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferData(GL_UNIFORM_BUFFER, staging.size(), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        GL_DEBUG_LABEL(GL_BUFFER, buffer, label);
+    }
+
+    void destroy()
+    {
+        buffer.reset();
+        staging.clear();
+    }
+
+    T& operator[](size_t i)
+    {
+        return *reinterpret_cast<T*>(&staging[i * stride]);
+    }
+
+    // One write for however many objects there are. Orphaning the old storage first means we don't
+    // wait for draws from the last frame that are still reading it.
+    void upload(size_t count)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferData(GL_UNIFORM_BUFFER, staging.size(), NULL, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, count * stride, staging.data());
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    void bind(size_t i, GLuint binding) const
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, i * stride, sizeof(T));
+    }
+
+    GLBuffer buffer;
+    size_t stride = 0;
+    size_t capacity = 0;
+
+private:
+    std::vector<uint8_t> staging;
+};
@@ -0,0 +1,888 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <glad/glad.h>
+#include "gl_debug.h"
+#include "gl_objects.h"
+#include "png.h"
+
+// Images far too big to keep on the GPU, drawn by only keeping the bits that are on screen.
+//
+// Offline, writeVirtualTexture() cuts the image and all of its mip levels into square tiles and
+// writes them to a page file. At runtime VirtualTexture maps that file into memory and keeps a
+// fixed number of tiles in one physical texture, sized to fit a memory budget. Each frame:
+//  - a feedback pass draws the scene small, writing which tile (and mip level) each pixel wants
+//  - processFeedback() reads that back (a frame or two late, through AsyncReadback) and queues
+//    loads for the tiles that aren't there, coarser levels first
+//  - a loader thread copies those tiles out of the mapped file, which is when the disk is read
+//  - update() uploads a few finished tiles into the physical texture, throwing out whichever tile
+//    was used least recently, and points the indirection texture at them
+// The indirection texture has a texel per tile at each mip level, saying where in the physical
+// texture that tile (or the closest coarser one that's there) is. The shader looks that up and
+// samples the physical texture, so missing tiles show up blurry until they arrive rather than
+// not at all. The coarsest level is one tile and is always kept, so there's always something.
+//
+// See res/shaders/virtual_texture.frag for the shader half, and tools/vt_builder.
+namespace virtual_texture_detail
+{
+    const char MAGIC[4] = { 'V', 'T', 'E', 'X' };
+    const uint32_t VERSION = 1;
+}
+
+// The start of a page file. The tiles follow straight after it: level 0 (the biggest) first,
+// each level's rows bottom to top, each tile (tileSize + 2 * border) texels square in RGBA.
+struct VirtualTextureHeader
+{
+    char magic[4];
+    uint32_t version;
+    // Texels across level 0, which is square and a power of two number of tiles
+    uint32_t size;
+    // Texels across a tile, not counting the border
+    uint32_t tileSize;
+    // Texels copied from the neighbouring tiles round each edge, so bilinear filtering works
+    uint32_t border;
+    uint32_t levels;
+
+    uint32_t tilesAcross(uint32_t level) const
+    {
+        return (size / tileSize) >> level;
+    }
+
+    uint32_t storedSize() const
+    {
+        return tileSize + border * 2;
+    }
+
+    size_t tileBytes() const
+    {
+        return (size_t)storedSize() * storedSize() * 4;
+    }
+
+    // Every tile of every level is numbered, level 0 first
+    uint32_t tileIndex(uint32_t level, uint32_t x, uint32_t y) const
+    {
+        uint32_t before = 0;
+        for (uint32_t l = 0; l < level; l++)
+            before += tilesAcross(l) * tilesAcross(l);
+        return before + y * tilesAcross(level) + x;
+    }
+
+    uint32_t tileCount() const
+    {
+        return tileIndex(levels, 0, 0);
+    }
+};
+
+// Tiles the image into a page file at path. The image is padded out (repeating its edges) to a
+// square power of two number of tiles, so the texture coordinates of the image itself end at
+// width / size and height / size, see the returned header. Tiles are kept to 256 across at
+// level 0 so the feedback pass can write their coordinates in a byte.
+inline bool writeVirtualTexture(const std::string& path, const Image& image, VirtualTextureHeader& header, uint32_t tileSize = 128, uint32_t border = 1)
+{
+    uint32_t tiles = 1;
+    while (tiles * tileSize < (uint32_t)std::max(image.width, image.height))
+        tiles *= 2;
+    if (tiles > 256 || border >= tileSize)
+    {
+        std::cerr << "A " << image.width << "x" << image.height << " image needs bigger tiles than " << tileSize << std::endl;
+        return false;
+    }
+    memcpy(header.magic, virtual_texture_detail::MAGIC, 4);
+    header.version = virtual_texture_detail::VERSION;
+    header.size = tiles * tileSize;
+    header.tileSize = tileSize;
+    header.border = border;
+    header.levels = 1;
+    while ((tiles >> header.levels) > 0)
+        header.levels++;
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Couldn't write " << path << std::endl;
+        return false;
+    }
+    file.write((const char*)&header, sizeof(header));
+
+    // Level 0 is the image with its edges stretched out to the full size, each level after
+    // that is the one before averaged down in 2x2 blocks
+    Image level;
+    level.width = level.height = (int)header.size;
+    level.rgba.resize((size_t)header.size * header.size * 4);
+    for (int y = 0; y < level.height; y++)
+        for (int x = 0; x < level.width; x++)
+            memcpy(level.pixel(x, y), image.pixel(std::min(x, image.width - 1), std::min(y, image.height - 1)), 4);
+
+    uint32_t stored = header.storedSize();
+    std::vector<uint8_t> tile(header.tileBytes());
+    for (uint32_t l = 0; l < header.levels; l++)
+    {
+        uint32_t across = header.tilesAcross(l);
+        for (uint32_t ty = 0; ty < across; ty++)
+        {
+            for (uint32_t tx = 0; tx < across; tx++)
+            {
+                // The border comes from the neighbours, or repeats the edge at the outside
+                for (uint32_t y = 0; y < stored; y++)
+                {
+                    int sourceY = std::min(std::max((int)(ty * tileSize + y) - (int)border, 0), level.height - 1);
+                    for (uint32_t x = 0; x < stored; x++)
+                    {
+                        int sourceX = std::min(std::max((int)(tx * tileSize + x) - (int)border, 0), level.width - 1);
+                        memcpy(&tile[((size_t)y * stored + x) * 4], level.pixel(sourceX, sourceY), 4);
+                    }
+                }
+                file.write((const char*)tile.data(), tile.size());
+            }
+        }
+
+        if (l + 1 < header.levels)
+        {
+            Image smaller;
+            smaller.width = smaller.height = level.width / 2;
+            smaller.rgba.resize((size_t)smaller.width * smaller.height * 4);
+            for (int y = 0; y < smaller.height; y++)
+            {
+                for (int x = 0; x < smaller.width; x++)
+                {
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int sum = level.pixel(x * 2, y * 2)[c] + level.pixel(x * 2 + 1, y * 2)[c] + level.pixel(x * 2, y * 2 + 1)[c] + level.pixel(x * 2 + 1, y * 2 + 1)[c];
+                        smaller.pixel(x, y)[c] = (uint8_t)((sum + 2) / 4);
+                    }
+                }
+            }
+            level = std::move(smaller);
+        }
+    }
+    if (!file)
+    {
+        std::cerr << "Couldn't write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// A page file mapped into memory. Nothing's read from disk until a tile's bytes are touched, and
+// then only the pages it's in, which the OS can drop again when it's short of memory.
+class VirtualTextureFile
+{
+public:
+    VirtualTextureFile() = default;
+    VirtualTextureFile(const VirtualTextureFile&) = delete;
+    VirtualTextureFile& operator=(const VirtualTextureFile&) = delete;
+
+    ~VirtualTextureFile()
+    {
+        close();
+    }
+
+    bool open(const std::string& path)
+    {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        LARGE_INTEGER fileSize;
+        if (file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &fileSize))
+        {
+            bytes = (size_t)fileSize.QuadPart;
+            mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping)
+                data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+#else
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        struct stat info;
+        if (descriptor >= 0 && fstat(descriptor, &info) == 0 && info.st_size > 0)
+        {
+            bytes = (size_t)info.st_size;
+            void* mapped = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapped != MAP_FAILED)
+                data = (const uint8_t*)mapped;
+        }
+        // The mapping keeps the file open by itself
+        if (descriptor >= 0)
+            ::close(descriptor);
+#endif
+        if (!data)
+        {
+            std::cerr << "Couldn't map " << path << std::endl;
+            close();
+            return false;
+        }
+        if (bytes < sizeof(header))
+        {
+            std::cerr << path << " isn't a virtual texture" << std::endl;
+            close();
+            return false;
+        }
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, virtual_texture_detail::MAGIC, 4) != 0 || header.version != virtual_texture_detail::VERSION
+            || header.tileSize == 0 || header.levels == 0 || bytes < sizeof(header) + header.tileCount() * header.tileBytes())
+        {
+            std::cerr << path << " isn't a virtual texture, or is cut short" << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close()
+    {
+#ifdef _WIN32
+        if (data)
+            UnmapViewOfFile(data);
+        if (mapping)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data)
+            munmap((void*)data, bytes);
+#endif
+        data = nullptr;
+        bytes = 0;
+    }
+
+    const uint8_t* tile(uint32_t index) const
+    {
+        return data + sizeof(header) + (size_t)index * header.tileBytes();
+    }
+
+    VirtualTextureHeader header = {};
+    size_t bytes = 0;
+
+private:
+    const uint8_t* data = nullptr;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+#endif
+};
+
+// Which tiles are in which slots of the physical texture, and which was used least recently.
+// Everything's sized up front so nothing is allocated once it's going. Doesn't touch GL.
+class TileCache
+{
+public:
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    void reset(uint32_t slotCount, uint32_t tileCount)
+    {
+        slots.assign(slotCount, Slot());
+        slotOfTile.assign(tileCount, NONE);
+        // Every slot starts out free, at the old end of the list
+        head = tail = NONE;
+        for (uint32_t slot = 0; slot < slotCount; slot++)
+            pushFront(slot);
+    }
+
+    // The slot the tile is in, or NONE
+    uint32_t find(uint32_t tile) const
+    {
+        return slotOfTile[tile];
+    }
+
+    // Marks the slot as just used
+    void touch(uint32_t slot)
+    {
+        unlink(slot);
+        pushFront(slot);
+    }
+
+    // A slot for the tile, taken from whichever was used least recently (or never). Whatever
+    // was in it is returned in evicted (NONE if it was free). Pinned slots are never taken.
+    // Returns NONE if every slot is pinned, or the least recent was used in frame or later.
+    uint32_t take(uint32_t tile, uint64_t frame, uint32_t& evicted)
+    {
+        uint32_t slot = tail;
+        while (slot != NONE && slots[slot].pinned)
+            slot = slots[slot].previous;
+        if (slot == NONE || (slots[slot].tile != NONE && slots[slot].lastUsed >= frame))
+            return NONE;
+        evicted = slots[slot].tile;
+        if (evicted != NONE)
+            slotOfTile[evicted] = NONE;
+        slots[slot].tile = tile;
+        // Counts as used now, so later uploads this frame don't throw it straight back out
+        slots[slot].lastUsed = frame;
+        slotOfTile[tile] = slot;
+        touch(slot);
+        return slot;
+    }
+
+    void markUsed(uint32_t slot, uint64_t frame)
+    {
+        slots[slot].lastUsed = frame;
+        touch(slot);
+    }
+
+    void pin(uint32_t slot)
+    {
+        slots[slot].pinned = true;
+    }
+
+    uint32_t tileIn(uint32_t slot) const
+    {
+        return slots[slot].tile;
+    }
+
+    size_t slotCount() const
+    {
+        return slots.size();
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t tile = NONE;
+        uint64_t lastUsed = 0;
+        bool pinned = false;
+        // Towards the most and least recently used
+        uint32_t previous = NONE;
+        uint32_t next = NONE;
+    };
+
+    void unlink(uint32_t slot)
+    {
+        Slot& s = slots[slot];
+        (s.previous != NONE ? slots[s.previous].next : head) = s.next;
+        (s.next != NONE ? slots[s.next].previous : tail) = s.previous;
+        s.previous = s.next = NONE;
+    }
+
+    void pushFront(uint32_t slot)
+    {
+        slots[slot].next = head;
+        slots[slot].previous = NONE;
+        if (head != NONE)
+            slots[head].previous = slot;
+        head = slot;
+        if (tail == NONE)
+            tail = slot;
+    }
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> slotOfTile;
+    // Most and least recently used
+    uint32_t head = NONE;
+    uint32_t tail = NONE;
+};
+
+// Added up since the virtual texture was made
+struct VirtualTextureStats
+{
+    // Tiles the feedback asked for, counted once per feedback frame, and how many were already there
+    uint64_t requested = 0;
+    uint64_t hits = 0;
+    // Loads queued, tiles uploaded and the bytes sent (tiles and indirection together)
+    uint64_t loads = 0;
+    uint64_t uploads = 0;
+    uint64_t uploadedBytes = 0;
+    uint64_t evictions = 0;
+    // Uploads put off because every slot held a tile the view still needed, i.e. the view wanted
+    // more than the budget allows. Those parts stay blurry.
+    uint64_t overBudget = 0;
+    // Loads that didn't fit in the queue, they're asked for again next frame
+    uint64_t dropped = 0;
+    uint64_t feedbackFrames = 0;
+    double uploadMs = 0.0;
+
+    double hitRate() const
+    {
+        return requested ? (double)hits / requested : 1.0;
+    }
+};
+
+class VirtualTexture
+{
+public:
+    ~VirtualTexture()
+    {
+        destroy();
+    }
+
+    // Maps the page file and makes a physical texture with as many tiles as fit in budgetBytes
+    // (indirection texture included). Loads the coarsest level straight away. Needs a context.
+    bool create(const std::string& path, size_t budgetBytes, const char* label = "Virtual texture")
+    {
+        destroy();
+        if (!file.open(path))
+            return false;
+        const VirtualTextureHeader& header = file.header;
+        slotSize = header.storedSize();
+
+        size_t indirectionBytes = 0;
+        for (uint32_t level = 0; level < header.levels; level++)
+            indirectionBytes += (size_t)header.tilesAcross(level) * header.tilesAcross(level) * 4;
+        size_t slotBytes = header.tileBytes();
+        // The physical texture can't be bigger than the driver allows either
+        GLint maxTextureSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+        uint32_t mostAcross = std::min(MAX_SLOTS_ACROSS, (uint32_t)maxTextureSize / slotSize);
+        slotsAcross = 1;
+        while (slotsAcross < mostAcross && indirectionBytes + (size_t)(slotsAcross + 1) * (slotsAcross + 1) * slotBytes <= budgetBytes)
+            slotsAcross++;
+        // One for the coarsest level and at least one more
+        if (slotsAcross < 2)
+        {
+            std::cerr << "A budget of " << budgetBytes << " bytes is too small for " << path << std::endl;
+            file.close();
+            return false;
+        }
+        this->budgetBytes = budgetBytes;
+        residentBytes = indirectionBytes + (size_t)slotsAcross * slotsAcross * slotBytes;
+
+        uint32_t tileCount = header.tileCount();
+        cache.reset(slotsAcross * slotsAcross, tileCount);
+        tileStates.assign(tileCount, TileState::Missing);
+        requestedIn.assign(tileCount, 0);
+        indirection.assign(header.levels, std::vector<uint32_t>());
+        for (uint32_t level = 0; level < header.levels; level++)
+            indirection[level].assign((size_t)header.tilesAcross(level) * header.tilesAcross(level), 0);
+        dirtyLevels = 0;
+        frame = 1;
+        stats = VirtualTextureStats();
+
+        int physicalSize = (int)(slotsAcross * slotSize);
+        physical = GLTexture::create();
+        glBindTexture(GL_TEXTURE_2D, physical);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, physicalSize, physicalSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        // Mip levels come from the page file rather than the physical texture, which has none
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+        GL_DEBUG_LABEL(GL_TEXTURE, physical, label);
+
+        indirectionTexture = GLTexture::create();
+        glBindTexture(GL_TEXTURE_2D, indirectionTexture);
+        for (uint32_t level = 0; level < header.levels; level++)
+        {
+            GLsizei across = (GLsizei)header.tilesAcross(level);
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, across, across, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, header.levels - 1);
+        GL_DEBUG_LABEL(GL_TEXTURE, indirectionTexture, label);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // The coarsest level, the fallback for everything, goes in now and stays
+        uint32_t top = header.tileIndex(header.levels - 1, 0, 0);
+        uint32_t evicted = TileCache::NONE;
+        uint32_t slot = cache.take(top, 0, evicted);
+        cache.pin(slot);
+        uploadTile(top, slot, file.tile(top));
+        flushIndirection();
+
+        // Enough staging buffers to keep the loader busy while the render thread uploads
+        staging.assign(STAGING_BUFFERS, std::vector<uint8_t>(header.tileBytes()));
+        freeStaging.reset(STAGING_BUFFERS);
+        for (uint32_t i = 0; i < STAGING_BUFFERS; i++)
+            freeStaging.push(i);
+        requests.reset(tileCount);
+        finished.reset(STAGING_BUFFERS);
+        stopping = false;
+        loader = std::thread([this] { loadTiles(); });
+        return true;
+    }
+
+    void destroy()
+    {
+        if (loader.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            work.notify_all();
+            loader.join();
+        }
+        physical.reset();
+        indirectionTexture.reset();
+        file.close();
+    }
+
+    // Reads one feedback frame (RGBA from the FEEDBACK variant of virtual_texture.frag: tile x
+    // and y, level, 255 where something was drawn) and queues loads for the tiles that are missing.
+    // A missing tile's coarser levels are queued first, so the picture sharpens a level at a time.
+    void processFeedback(const uint8_t* rgba, size_t pixels)
+    {
+        const VirtualTextureHeader& header = file.header;
+        frame++;
+        stats.feedbackFrames++;
+        size_t queuedBefore = stats.loads;
+        for (size_t i = 0; i < pixels; i++)
+        {
+            const uint8_t* pixel = rgba + i * 4;
+            if (pixel[3] == 0 || pixel[2] >= header.levels)
+                continue;
+            uint32_t level = pixel[2], across = header.tilesAcross(level);
+            if (pixel[0] >= across || pixel[1] >= across)
+                continue;
+            uint32_t tile = header.tileIndex(level, pixel[0], pixel[1]);
+            if (requestedIn[tile] == frame)
+                continue;
+            // Neighbouring pixels nearly always want the same tile, so only the first one counts
+            requestedIn[tile] = frame;
+            stats.requested++;
+            uint32_t slot = cache.find(tile);
+            if (slot != TileCache::NONE)
+            {
+                stats.hits++;
+                cache.markUsed(slot, frame);
+                continue;
+            }
+            // Walk up to the first coarser level that's there (or on its way), then queue from there down
+            uint32_t chain[32];
+            int length = 0;
+            uint32_t x = pixel[0], y = pixel[1];
+            for (uint32_t l = level; l < header.levels; l++, x /= 2, y /= 2)
+            {
+                uint32_t ancestor = header.tileIndex(l, x, y);
+                uint32_t ancestorSlot = cache.find(ancestor);
+                if (ancestorSlot != TileCache::NONE)
+                {
+                    // Still drawn while the finer one loads, so it mustn't be thrown out for it
+                    cache.markUsed(ancestorSlot, frame);
+                    break;
+                }
+                if (tileStates[ancestor] == TileState::Missing)
+                    chain[length++] = ancestor;
+            }
+            while (length > 0)
+                queueLoad(chain[--length]);
+        }
+        if (stats.loads != queuedBefore)
+            work.notify_one();
+    }
+
+    // Uploads up to maxUploads tiles that have finished loading, then sends the indirection
+    // levels that changed. Call once a frame, before drawing.
+    void update(int maxUploads)
+    {
+        auto start = std::chrono::steady_clock::now();
+        bool freed = false;
+        for (int i = 0; i < maxUploads; i++)
+        {
+            Loaded loaded;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!finished.pop(loaded))
+                    break;
+            }
+            uint32_t evicted = TileCache::NONE;
+            uint32_t slot = cache.take(loaded.tile, frame, evicted);
+            if (slot == TileCache::NONE)
+            {
+                // Everything in the cache is still wanted, so leave it blurry and ask again later
+                stats.overBudget++;
+                tileStates[loaded.tile] = TileState::Missing;
+            }
+            else
+            {
+                if (evicted != TileCache::NONE)
+                {
+                    tileStates[evicted] = TileState::Missing;
+                    updateIndirection(evicted);
+                    stats.evictions++;
+                }
+                uploadTile(loaded.tile, slot, staging[loaded.staging].data());
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                freeStaging.push(loaded.staging);
+            }
+            freed = true;
+        }
+        if (freed)
+            work.notify_one();
+        flushIndirection();
+        stats.uploadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Uploads everything that's been queued, waiting for the loader as it goes. For renders that
+    // have to come out the same every time, like the golden images.
+    void finishLoads()
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                // The loader stops when it runs out of staging buffers, so uploading whatever's
+                // finished has to come before waiting for the queue to empty
+                done.wait(lock, [this] { return !finished.empty() || (requests.empty() && busy == 0); });
+                if (requests.empty() && busy == 0 && finished.empty())
+                    break;
+            }
+            update(STAGING_BUFFERS);
+        }
+        flushIndirection();
+    }
+
+    // The physical texture on unit and the indirection texture on unit + 1
+    void bind(GLuint unit) const
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, physical);
+        glActiveTexture(GL_TEXTURE0 + unit + 1);
+        glBindTexture(GL_TEXTURE_2D, indirectionTexture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    const VirtualTextureHeader& header() const
+    {
+        return file.header;
+    }
+
+    int physicalSize() const
+    {
+        return (int)(slotsAcross * slotSize);
+    }
+
+    // Tiles in the physical texture right now
+    size_t residentTiles() const
+    {
+        size_t count = 0;
+        for (size_t slot = 0; slot < cache.slotCount(); slot++)
+            count += cache.tileIn((uint32_t)slot) != TileCache::NONE;
+        return count;
+    }
+
+    size_t slotCount() const
+    {
+        return cache.slotCount();
+    }
+
+    // GPU memory used by the physical and indirection textures, which never changes, against
+    // the budget it was made with, and what the whole texture would need with every mip level
+    size_t residentBytes = 0;
+    size_t budgetBytes = 0;
+    size_t fullBytes() const
+    {
+        return (size_t)file.header.tileCount() * file.header.tileSize * file.header.tileSize * 4;
+    }
+
+    VirtualTextureStats stats;
+
+    // An indirection entry has 8 bits each for the slot's x and y
+    static constexpr uint32_t MAX_SLOTS_ACROSS = 256;
+
+private:
+    static constexpr uint32_t STAGING_BUFFERS = 16;
+
+    enum class TileState : uint8_t
+    {
+        Missing,
+        Loading,
+        Resident,
+    };
+
+    struct Loaded
+    {
+        uint32_t tile = 0;
+        uint32_t staging = 0;
+    };
+
+    // A queue that never grows past what it was reset to, so using it doesn't allocate
+    template <typename T>
+    struct Ring
+    {
+        std::vector<T> items;
+        size_t first = 0;
+        size_t count = 0;
+
+        void reset(size_t capacity)
+        {
+            items.assign(capacity, T());
+            first = count = 0;
+        }
+
+        bool push(const T& item)
+        {
+            if (count == items.size())
+                return false;
+            items[(first + count++) % items.size()] = item;
+            return true;
+        }
+
+        bool pop(T& item)
+        {
+            if (count == 0)
+                return false;
+            item = items[first];
+            first = (first + 1) % items.size();
+            count--;
+            return true;
+        }
+
+        bool empty() const
+        {
+            return count == 0;
+        }
+    };
+
+    void queueLoad(uint32_t tile)
+    {
+        bool queued;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queued = requests.push(tile);
+        }
+        if (!queued)
+        {
+            stats.dropped++;
+            return;
+        }
+        tileStates[tile] = TileState::Loading;
+        stats.loads++;
+    }
+
+    // The loader thread: copies requested tiles out of the mapped file into free staging buffers
+    void loadTiles()
+    {
+        size_t tileBytes = file.header.tileBytes();
+        for (;;)
+        {
+            uint32_t tile, buffer;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work.wait(lock, [this] { return stopping || (!requests.empty() && !freeStaging.empty()); });
+                if (stopping)
+                    return;
+                requests.pop(tile);
+                freeStaging.pop(buffer);
+                busy++;
+            }
+            // Touching the mapped bytes is what reads them from disk
+            memcpy(staging[buffer].data(), file.tile(tile), tileBytes);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.push({ tile, buffer });
+                busy--;
+            }
+            done.notify_all();
+        }
+    }
+
+    void uploadTile(uint32_t tile, uint32_t slot, const uint8_t* pixels)
+    {
+        glBindTexture(GL_TEXTURE_2D, physical);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, (slot % slotsAcross) * slotSize, (slot / slotsAcross) * slotSize, slotSize, slotSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        tileStates[tile] = TileState::Resident;
+        stats.uploads++;
+        stats.uploadedBytes += file.header.tileBytes();
+        updateIndirection(tile);
+    }
+
+    // Which level a tile index is on, and where
+    void locate(uint32_t tile, uint32_t& level, uint32_t& x, uint32_t& y) const
+    {
+        const VirtualTextureHeader& header = file.header;
+        level = 0;
+        while (tile >= header.tilesAcross(level) * header.tilesAcross(level))
+        {
+            tile -= header.tilesAcross(level) * header.tilesAcross(level);
+            level++;
+        }
+        x = tile % header.tilesAcross(level);
+        y = tile / header.tilesAcross(level);
+    }
+
+    // Points every indirection texel under a tile that came or went at the best tile there is
+    // now: its own if it's resident, otherwise whatever the level above points at
+    void updateIndirection(uint32_t tile)
+    {
+        const VirtualTextureHeader& header = file.header;
+        uint32_t tileLevel, tileX, tileY;
+        locate(tile, tileLevel, tileX, tileY);
+        for (int level = (int)tileLevel; level >= 0; level--)
+        {
+            uint32_t scale = 1u << (tileLevel - level), across = header.tilesAcross(level);
+            for (uint32_t y = tileY * scale; y < (tileY + 1) * scale; y++)
+            {
+                for (uint32_t x = tileX * scale; x < (tileX + 1) * scale; x++)
+                {
+                    uint32_t slot = cache.find(header.tileIndex(level, x, y));
+                    uint32_t& entry = indirection[level][(size_t)y * across + x];
+                    if (slot != TileCache::NONE)
+                        entry = (slot % slotsAcross) | (slot / slotsAcross) << 8 | (uint32_t)level << 16 | 0xFF000000u;
+                    else if (level + 1 < (int)header.levels)
+                        entry = indirection[level + 1][(size_t)(y / 2) * header.tilesAcross(level + 1) + x / 2];
+                }
+            }
+            dirtyLevels |= 1u << level;
+        }
+    }
+
+    // Sends the indirection levels that changed. They're a texel per tile, so small enough to
+    // send whole.
+    void flushIndirection()
+    {
+        if (!dirtyLevels)
+            return;
+        glBindTexture(GL_TEXTURE_2D, indirectionTexture);
+        for (uint32_t level = 0; level < file.header.levels; level++)
+        {
+            if (!(dirtyLevels & (1u << level)))
+                continue;
+            GLsizei across = (GLsizei)file.header.tilesAcross(level);
+            glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, across, across, GL_RGBA, GL_UNSIGNED_BYTE, indirection[level].data());
+            stats.uploadedBytes += (uint64_t)across * across * 4;
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        dirtyLevels = 0;
+    }
+
+    VirtualTextureFile file;
+    GLTexture physical;
+    GLTexture indirectionTexture;
+    uint32_t slotSize = 0;
+    uint32_t slotsAcross = 0;
+    TileCache cache;
+    std::vector<TileState> tileStates;
+    // The feedback frame each tile was last asked for in, so it's only counted once
+    std::vector<uint64_t> requestedIn;
+    // RGBA8 per tile per level: slot x, slot y, the level of the tile actually there, 255
+    std::vector<std::vector<uint32_t>> indirection;
+    uint32_t dirtyLevels = 0;
+    uint64_t frame = 0;
+
+    // Shared with the loader thread, under mutex
+    std::thread loader;
+    std::mutex mutex;
+    std::condition_variable work;
+    std::condition_variable done;
+    bool stopping = false;
+    int busy = 0;
+    Ring<uint32_t> requests;
+    Ring<uint32_t> freeStaging;
+    Ring<Loaded> finished;
+    std::vector<std::vector<uint8_t>> staging;
+};
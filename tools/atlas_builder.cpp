@@ -0,0 +1,93 @@
+// Packs a folder of images into one atlas offline, for TextureAtlas::load to read back.
+//   atlas_builder [folder, default ./textures] [output, default ./atlas.png] [--size 2048] [--padding 4]
+// Reads every .png, .jpg and .jpeg in the folder and packs them biggest first, once with the
+// skyline and once with max rects, printing how full each got and how long it took. The one that
+// fitted more (or packed tighter) is saved as output, with its table in output.txt. Also prints
+// how many draw calls the atlas saves drawing every image once. Doesn't need a GL context.
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "bench_common.h"
+#include "../src/atlas.h"
+#include "../src/jpeg.h"
+
+struct NamedImage
+{
+    std::string name;
+    Image image;
+};
+
+// Packs every image it can, returns how many fitted
+static size_t pack(TextureAtlas& atlas, const std::vector<NamedImage>& images, int size, PackMethod method, int padding)
+{
+    BenchTimer timer;
+    atlas.reset(size, method, padding);
+    size_t packed = 0;
+    for (const NamedImage& image : images)
+    {
+        if (atlas.add(image.name, image.image) >= 0)
+            packed++;
+    }
+    double ms = timer.ms();
+    std::cout << (method == PackMethod::Skyline ? "Skyline" : "Max rects") << ": " << packed << " of " << images.size() << " images in "
+        << ms << "ms, " << atlas.occupancy() * 100.0 << "% images, " << atlas.packedOccupancy() * 100.0 << "% used with their padding" << std::endl;
+    return packed;
+}
+
+int main(int argc, char** argv)
+{
+    std::string folder = argc > 1 && argv[1][0] != '-' ? argv[1] : "./textures";
+    std::string output = argc > 2 && argv[2][0] != '-' ? argv[2] : "./atlas.png";
+    int size = benchArgument(argc, argv, "--size", 2048);
+    int padding = benchArgument(argc, argv, "--padding", 4);
+
+    std::vector<NamedImage> images;
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(folder, error))
+    {
+        std::string extension = file.path().extension().string();
+        for (char& c : extension)
+            c = (char)tolower((unsigned char)c);
+        if (extension != ".png" && extension != ".jpg" && extension != ".jpeg")
+            continue;
+        NamedImage image;
+        image.name = file.path().filename().string();
+        if (readImage(file.path().string(), image.image))
+            images.push_back(std::move(image));
+    }
+    if (error || images.empty())
+    {
+        std::cerr << "No images in " << folder << std::endl;
+        return 1;
+    }
+    // Biggest first leaves the small ones to fill the gaps, by name after that so it's the same every run
+    std::sort(images.begin(), images.end(), [](const NamedImage& a, const NamedImage& b) {
+        int sideA = std::max(a.image.width, a.image.height), sideB = std::max(b.image.width, b.image.height);
+        return sideA != sideB ? sideA > sideB : a.name < b.name;
+    });
+    std::cout << images.size() << " images into " << size << "x" << size << " with " << padding << " texels of padding" << std::endl;
+
+    TextureAtlas skyline, maxRects;
+    size_t skylinePacked = pack(skyline, images, size, PackMethod::Skyline, padding);
+    size_t maxRectsPacked = pack(maxRects, images, size, PackMethod::MaxRects, padding);
+    bool useMaxRects = maxRectsPacked > skylinePacked || (maxRectsPacked == skylinePacked && maxRects.packedOccupancy() <= skyline.packedOccupancy());
+    const TextureAtlas& best = useMaxRects ? maxRects : skyline;
+    for (const NamedImage& image : images)
+    {
+        if (best.find(image.name) < 0)
+            std::cerr << image.name << " (" << image.image.width << "x" << image.image.height << ") didn't fit, try a bigger --size" << std::endl;
+    }
+
+    // Drawing each image once: a bind and a draw call apiece with their own textures, one of each from the atlas
+    std::cout << "Drawing every image once: " << images.size() << " draw calls with their own textures, 1 from the atlas";
+    if (best.count() < images.size())
+        std::cout << " (and " << images.size() - best.count() << " for the ones that didn't fit)";
+    std::cout << std::endl;
+
+    if (!best.save(output))
+        return 1;
+    std::cout << "Saved the " << (useMaxRects ? "max rects" : "skyline") << " atlas to " << output << " and " << output << ".txt" << std::endl;
+    return 0;
+}
@@ -0,0 +1,211 @@
+// The per frame allocators in src/frame_allocator.h against plain new/delete, counted with
+// src/allocation_tracker.h.
+//   bench_allocators [--frames 1000] [--draws 5000] [--objects 10000]
+// Each frame builds a draw list of --draws entries and a few culled lists, first in std::vectors
+// made fresh every frame and then in the frame arena, both on one thread and spread over the job
+// system (each worker using its own arena). Then churns --objects nodes through new/delete against
+// a FixedPool. Prints the time and how many allocations each made per frame once warmed up.
+// Doesn't need a GL context.
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/allocation_tracker.h"
+#include "../src/frame_allocator.h"
+#include "../src/job_system.h"
+
+// Roughly what a draw command holds
+struct Draw
+{
+    float depth;
+    uint32_t object;
+    uint32_t mesh;
+    uint32_t lod;
+};
+
+// Something kept between frames whose address has to stay put, like a scene graph node
+struct Node
+{
+    float transform[16];
+    Node* parent;
+    uint32_t flags;
+};
+
+const int WARMUP_FRAMES = 10;
+const int CULLED_LISTS = 4;
+const size_t JOB_CHUNK = 512;
+
+// Fills a draw list and a few culled lists for one frame, whatever they're stored in
+template <typename DrawList, typename IndexList>
+static uint64_t buildFrame(DrawList& draws, IndexList* culled, size_t count, int frame)
+{
+    draws.reserve(count);
+    for (size_t i = 0; i < count; i++)
+        draws.push_back({ (float)((i * 7919 + frame) % 1000), (uint32_t)i, (uint32_t)(i % 16), 0 });
+    std::sort(draws.begin(), draws.end(), [](const Draw& a, const Draw& b) { return a.depth < b.depth; });
+    // The culled lists aren't reserved, to see what growing costs
+    for (int list = 0; list < CULLED_LISTS; list++)
+        for (size_t i = list; i < count; i += CULLED_LISTS + 1)
+            culled[list].push_back((uint32_t)i);
+    uint64_t sum = 0;
+    for (const Draw& draw : draws)
+        sum += draw.object;
+    for (int list = 0; list < CULLED_LISTS; list++)
+        sum += culled[list].size();
+    return sum;
+}
+
+// Times frames and counts what every thread allocates in them, after a few to warm up
+struct FrameMeasure
+{
+    BenchTimer timer;
+    uint64_t startAllocations = 0;
+    int frames = 0;
+
+    void frameDone(int frame)
+    {
+        if (frame == WARMUP_FRAMES - 1)
+        {
+            timer.reset();
+            startAllocations = totalAllocations.load();
+        }
+        else if (frame >= WARMUP_FRAMES)
+            frames++;
+    }
+
+    void print(const char* name) const
+    {
+        double ms = timer.ms();
+        std::cout << name << ": " << ms / frames << "ms per frame, " << (double)(totalAllocations.load() - startAllocations) / frames
+            << " allocations per frame" << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    int frames = benchArgument(argc, argv, "--frames", 1000);
+    size_t drawCount = (size_t)benchArgument(argc, argv, "--draws", 5000);
+    size_t objectCount = (size_t)benchArgument(argc, argv, "--objects", 10000);
+    JobSystem jobs;
+    uint64_t checksum = 0;
+    std::cout << frames << " frames of " << drawCount << " draws and " << CULLED_LISTS << " culled lists, " << jobs.threadCount() << " threads" << std::endl;
+
+    // std::vector, made fresh each frame
+    {
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            std::vector<Draw> draws;
+            std::vector<uint32_t> culled[CULLED_LISTS];
+            checksum += buildFrame(draws, culled, drawCount, frame);
+            measure.frameDone(frame);
+        }
+        measure.print("std::vector");
+    }
+
+    // Frame arena
+    {
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            {
+                FrameArena& arena = FrameArena::local();
+                FrameVector<Draw> draws(arena);
+                // The lists have to be told which arena, so they can't just be an array
+                FrameVector<FrameVector<uint32_t>> culled(CULLED_LISTS, FrameVector<uint32_t>(arena), arena);
+                checksum += buildFrame(draws, culled.data(), drawCount, frame);
+            }
+            FrameArena::resetAll();
+            measure.frameDone(frame);
+        }
+        measure.print("FrameArena");
+        std::cout << "  peak " << FrameArena::local().peakBytes() << " bytes a frame, " << FrameArena::local().overflows << " times it had to grow" << std::endl;
+    }
+
+    // The same split into chunks over the job system, each chunk with its own lists
+    size_t chunks = (drawCount + JOB_CHUNK - 1) / JOB_CHUNK;
+    {
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            std::vector<uint64_t> sums(chunks);
+            jobs.parallelFor(drawCount, JOB_CHUNK, [&](size_t begin, size_t end) {
+                std::vector<Draw> draws;
+                std::vector<uint32_t> culled[CULLED_LISTS];
+                sums[begin / JOB_CHUNK] = buildFrame(draws, culled, end - begin, frame);
+            });
+            for (uint64_t sum : sums)
+                checksum += sum;
+            measure.frameDone(frame);
+        }
+        measure.print("std::vector, job system");
+    }
+    {
+        // Results go in the render thread's arena, made before the jobs start
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            uint64_t* sums = FrameArena::local().allocateArray<uint64_t>(chunks);
+            jobs.parallelFor(drawCount, JOB_CHUNK, [&](size_t begin, size_t end) {
+                FrameArena& arena = FrameArena::local();
+                FrameVector<Draw> draws(arena);
+                FrameVector<FrameVector<uint32_t>> culled(CULLED_LISTS, FrameVector<uint32_t>(arena), arena);
+                sums[begin / JOB_CHUNK] = buildFrame(draws, culled.data(), end - begin, frame);
+            });
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+                checksum += sums[chunk];
+            FrameArena::resetAll();
+            measure.frameDone(frame);
+        }
+        measure.print("FrameArena, job system");
+    }
+
+    // Nodes coming and going, about objectCount alive at once
+    std::cout << objectCount << " nodes, a tenth replaced every frame" << std::endl;
+    std::vector<Node*> nodes;
+    srand(1);
+    {
+        for (size_t i = 0; i < objectCount; i++)
+            nodes.push_back(new Node());
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            for (size_t i = 0; i < objectCount / 10; i++)
+            {
+                size_t victim = (size_t)rand() % nodes.size();
+                delete nodes[victim];
+                nodes[victim] = new Node();
+                nodes[victim]->parent = nodes[(size_t)rand() % nodes.size()];
+            }
+            measure.frameDone(frame);
+        }
+        measure.print("new/delete");
+        for (Node* node : nodes)
+            delete node;
+    }
+    srand(1);
+    {
+        FixedPool<Node> pool;
+        for (size_t i = 0; i < objectCount; i++)
+            nodes[i] = pool.create();
+        FrameMeasure measure;
+        for (int frame = 0; frame < WARMUP_FRAMES + frames; frame++)
+        {
+            for (size_t i = 0; i < objectCount / 10; i++)
+            {
+                size_t victim = (size_t)rand() % nodes.size();
+                pool.destroy(nodes[victim]);
+                nodes[victim] = pool.create();
+                nodes[victim]->parent = nodes[(size_t)rand() % nodes.size()];
+            }
+            measure.frameDone(frame);
+        }
+        measure.print("FixedPool");
+        std::cout << "  " << pool.size() << " alive in room for " << pool.capacity() << std::endl;
+    }
+
+    // So none of the work gets optimised away
+    std::cout << "Checksum " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,160 @@
+// The BVH in src/bvh.h against testing every object, from 10k objects up.
+//   bench_bvh [--max-objects 1000000] [--queries 100]
+// Object counts go up by 10x from 10k to --max-objects (pass 10000000 for the full range, it needs a
+// few GB). The objects are scattered through a cube that grows with the count so the density stays
+// the same, and the camera sees roughly the same number of them whatever the total.
+// For each count it times building the tree (one thread and with the job system), refitting after
+// every object moves, and frustum, ray and box queries against the brute force versions, checking
+// they find the same objects. Doesn't need a GL context.
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/bvh.h"
+#include "../src/culling.h"
+#include "../src/job_system.h"
+
+static float randomFloat()
+{
+    return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static BoundsArray makeObjects(size_t count, float halfSize)
+{
+    BoundsArray bounds;
+    bounds.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        Vec3 center = { randomFloat() * halfSize, randomFloat() * halfSize, randomFloat() * halfSize };
+        Vec3 extent = { 0.5f + fabsf(randomFloat()), 0.5f + fabsf(randomFloat()), 0.5f + fabsf(randomFloat()) };
+        bounds.set(i, center, extent);
+    }
+    return bounds;
+}
+
+static bool sameObjects(std::vector<uint32_t> a, std::vector<uint32_t> b)
+{
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    return a == b;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxObjects = (size_t)benchArgument(argc, argv, "--max-objects", 1000000);
+    int queries = benchArgument(argc, argv, "--queries", 100);
+
+    JobSystem jobs;
+    std::cout << jobs.threadCount() << " threads, " << queries << " of each query" << std::endl;
+    for (size_t objectCount = 10000; objectCount <= maxObjects; objectCount *= 10)
+    {
+        // About 10 units of space per object
+        float halfSize = cbrtf(objectCount * 10.0f) / 2.0f;
+        BoundsArray bounds = makeObjects(objectCount, halfSize);
+        std::cout << objectCount << " objects:" << std::endl;
+
+        Bvh bvh;
+        BenchTimer timer;
+        bvh.build(bounds);
+        double singleBuildMs = timer.ms();
+        timer.reset();
+        bvh.build(bounds, &jobs);
+        double threadedBuildMs = timer.ms();
+        std::cout << "  Build: " << singleBuildMs << "ms single, " << threadedBuildMs << "ms threaded (" << bvh.nodeCount()
+            << " nodes, SAH cost " << bvh.cost() << ")" << std::endl;
+
+        // Nudge everything a little, then refit the same tree to the new positions
+        for (size_t i = 0; i < objectCount; i++)
+        {
+            bounds.centerX[i] += randomFloat();
+            bounds.centerY[i] += randomFloat();
+        }
+        timer.reset();
+        bvh.refit(bounds, &jobs);
+        std::cout << "  Refit: " << timer.ms() << "ms (SAH cost " << bvh.cost() << ")" << std::endl;
+
+        // A camera in the middle turning around, seeing out to 50 units
+        FrustumCuller culler;
+        std::vector<uint32_t> bruteVisible, bvhVisible;
+        double bruteMs = 0.0, bvhMs = 0.0;
+        size_t visibleTotal = 0;
+        bool frustumMatches = true;
+        for (int query = 0; query < queries; query++)
+        {
+            float angle = query * 0.05f;
+            Frustum frustum = Frustum::fromMatrix(perspective(1.0f, 16.0f / 9.0f, 0.1f, 50.0f) * lookAt({ 0, 0, 0 }, { sinf(angle), 0.0f, -cosf(angle) }, { 0, 1, 0 }));
+            timer.reset();
+            culler.cull(frustum, bounds, CullShape::Boxes, bruteVisible, &jobs);
+            bruteMs += timer.ms();
+            bvhVisible.clear();
+            timer.reset();
+            bvh.queryFrustum(frustum, bounds, bvhVisible);
+            bvhMs += timer.ms();
+            visibleTotal += bvhVisible.size();
+            frustumMatches = frustumMatches && sameObjects(bruteVisible, bvhVisible);
+        }
+        std::cout << "  Frustum: " << bruteMs / queries << "ms brute force (SIMD + threads), " << bvhMs / queries << "ms BVH ("
+            << visibleTotal / queries << " visible)" << std::endl;
+
+        // Rays from random points in random directions, like picking
+        bruteMs = bvhMs = 0.0;
+        bool raysMatch = true;
+        for (int query = 0; query < queries; query++)
+        {
+            Vec3 origin = { randomFloat() * halfSize, randomFloat() * halfSize, randomFloat() * halfSize };
+            Vec3 direction = normalize(Vec3{ randomFloat(), randomFloat(), randomFloat() });
+            Vec3 inverse = { 1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z };
+            timer.reset();
+            RayHit brute;
+            for (uint32_t i = 0; i < objectCount; i++)
+            {
+                float entry;
+                if (Bvh::rayHitsBox(origin, inverse, Bvh::itemBox(bounds, i), brute.distance, entry) && entry < brute.distance)
+                {
+                    brute.item = i;
+                    brute.distance = entry;
+                }
+            }
+            bruteMs += timer.ms();
+            timer.reset();
+            RayHit hit;
+            bvh.raycast(origin, direction, FLT_MAX, bounds, hit);
+            bvhMs += timer.ms();
+            raysMatch = raysMatch && hit.distance == brute.distance;
+        }
+        std::cout << "  Ray: " << bruteMs / queries << "ms brute force, " << bvhMs / queries << "ms BVH" << std::endl;
+
+        // 20 unit boxes at random
+        bruteMs = bvhMs = 0.0;
+        bool boxesMatch = true;
+        std::vector<uint32_t> bruteOverlaps, bvhOverlaps;
+        for (int query = 0; query < queries; query++)
+        {
+            Aabb box;
+            box.grow(Vec3{ randomFloat() * halfSize, randomFloat() * halfSize, randomFloat() * halfSize });
+            box.grow(box.min + Vec3{ 20.0f, 20.0f, 20.0f });
+            bruteOverlaps.clear();
+            timer.reset();
+            for (uint32_t i = 0; i < objectCount; i++)
+                if (Bvh::itemBox(bounds, i).overlaps(box))
+                    bruteOverlaps.push_back(i);
+            bruteMs += timer.ms();
+            bvhOverlaps.clear();
+            timer.reset();
+            bvh.queryOverlap(box, bounds, bvhOverlaps);
+            bvhMs += timer.ms();
+            boxesMatch = boxesMatch && sameObjects(bruteOverlaps, bvhOverlaps);
+        }
+        std::cout << "  Box: " << bruteMs / queries << "ms brute force, " << bvhMs / queries << "ms BVH" << std::endl;
+
+        if (!frustumMatches || !raysMatch || !boxesMatch)
+        {
+            std::cerr << "The BVH found different objects to brute force ("
+                << (frustumMatches ? "" : "frustum ") << (raysMatch ? "" : "ray ") << (boxesMatch ? "" : "box ") << ")" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Saving every frame through src/frame_capture.h at 1080p and 4K.
+//   bench_capture [--frames 30] [--encoders 0] [--keep 0]
+// For each size, reading every frame straight back with glReadPixels (and throwing it away) as the
+// baseline, then capturing as raw, Y4M and PNG files. Frames per second count from the first frame
+// drawn to the last file written. The files go in ./capture_bench/<format>_<size> and are deleted after each run
+// unless --keep is 1. --encoders 0 means one encoder per core, less one for the render thread.
+// Run with LIBGL_ALWAYS_SOFTWARE=1 to measure Mesa's software driver.
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/frame_capture.h"
+#include "../src/framebuffer.h"
+
+// Something different every frame: a background that fades and a grid of boxes that move
+static void drawFrame(const Framebuffer& target, int frame)
+{
+    target.bind();
+    float fade = (frame % 60) / 60.0f;
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(0.1f + 0.2f * fade, 0.2f, 0.3f - 0.2f * fade, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+    int box = target.height / 10;
+    for (int i = 0; i < 32; i++)
+    {
+        int x = (i * 7 * box + frame * (i + 1) * 4) % (target.width - box);
+        int y = (i * 3 * box / 2 + frame * 2) % (target.height - box);
+        glScissor(x, y, box, box);
+        glClearColor((i & 1) * 1.0f, ((i >> 1) & 1) * 1.0f, ((i >> 2) & 1) * 1.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target.framebuffer);
+}
+
+int main(int argc, char** argv)
+{
+    int frames = benchArgument(argc, argv, "--frames", 30);
+    unsigned encoders = (unsigned)benchArgument(argc, argv, "--encoders", 0);
+    bool keep = benchArgument(argc, argv, "--keep", 0) != 0;
+    GLFWwindow* window = createBenchContext(64, 64);
+    if (!window)
+        return 1;
+
+    const int sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    const char* formatNames[] = { "raw", "y4m", "png" };
+    const std::string folder = "./capture_bench";
+    for (const int* size : sizes)
+    {
+        int width = size[0], height = size[1];
+        Framebuffer target;
+        if (!target.create(width, height, false, "Capture bench"))
+            return 1;
+        std::cout << width << "x" << height << ", " << frames << " frames" << std::endl;
+
+        // Waiting for each frame on the spot, not saving anything
+        std::vector<uint8_t> pixels((size_t)width * height * 4);
+        BenchTimer timer;
+        for (int frame = 0; frame < frames; frame++)
+        {
+            drawFrame(target, frame);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        }
+        double ms = timer.ms();
+        std::cout << "  glReadPixels, nothing saved: " << frames * 1000.0 / ms << " fps" << std::endl;
+
+        for (const char* name : formatNames)
+        {
+            CaptureFormat format = CaptureFormat::Png;
+            if (!parseCaptureFormat(name, format))
+            {
+                std::cerr << "Unknown capture format " << name << std::endl;
+                return 1;
+            }
+            FrameCapture capture;
+            std::string runFolder = folder + "/" + name + "_" + std::to_string(width) + "x" + std::to_string(height);
+            if (!capture.start(runFolder, format, width, height, 60, encoders))
+                return 1;
+            timer.reset();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                drawFrame(target, frame);
+                capture.captureFrame();
+            }
+            capture.stop();
+            ms = timer.ms();
+            const CaptureStats& stats = capture.stats;
+            std::cout << "  " << name << ": " << frames * 1000.0 / ms << " fps, " << stats.bytesWritten / (ms * 1000.0) << "MB/s written ("
+                << stats.captureMs / frames << "ms per frame on the render thread, " << stats.encodeMs / frames << "ms encoding, waited for the GPU "
+                << stats.gpuWaits << " and the encoders " << stats.encoderWaits << " times)" << std::endl;
+            if (stats.written != (size_t)frames)
+            {
+                std::cerr << "Only " << stats.written << " of " << frames << " frames were saved" << std::endl;
+                return 1;
+            }
+            if (!keep)
+                std::filesystem::remove_all(runFolder);
+        }
+        target.destroy();
+    }
+    glfwTerminate();
+    return 0;
+}
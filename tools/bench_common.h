@@ -0,0 +1,77 @@
+#pragma once
+// Bits every benchmark needs: a hidden window to get a context from, and a timer.
+// The benchmarks are meant to be run from res/ like the app, so the shader paths line up.
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// GLFW set up for the same kind of context as the app, with windows hidden. Returns false (after
+// printing why) on failure.
+inline bool initBenchGlfw()
+{
+    if (!glfwInit())
+    {
+        std::cerr << "Failed to initialise GLFW" << std::endl;
+        return false;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    return true;
+}
+
+// Makes a context without showing a window. Returns NULL (after printing why) on failure.
+inline GLFWwindow* createBenchContext(int width, int height)
+{
+    if (!initBenchGlfw())
+        return NULL;
+
+    GLFWwindow* window = glfwCreateWindow(width, height, "Benchmark", NULL, NULL);
+    if (window == NULL)
+    {
+        std::cerr << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return NULL;
+    }
+    glfwMakeContextCurrent(window);
+    // Don't let vsync put a floor under the numbers
+    glfwSwapInterval(0);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    {
+        std::cerr << "Failed to initialize GLAD" << std::endl;
+        glfwTerminate();
+        return NULL;
+    }
+    std::cout << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
+    return window;
+}
+
+// Milliseconds since the timer was made (or last reset)
+struct BenchTimer
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    void reset()
+    {
+        start = std::chrono::steady_clock::now();
+    }
+
+    double ms() const
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+// "--name value" style integer arguments, with a default
+inline int benchArgument(int argc, char** argv, const char* name, int fallback)
+{
+    for (int i = 1; i + 1 < argc; i++)
+        if (strcmp(argv[i], name) == 0)
+            return atoi(argv[i + 1]);
+    return fallback;
+}
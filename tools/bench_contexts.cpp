@@ -0,0 +1,253 @@
+// Several contexts from src/context_manager.h sharing their GL objects, against each having its own.
+//   bench_contexts [--contexts 4] [--frames 100] [--objects 256]
+// Loads the same things into every context (five basic shader variants, a buffer of sphere LODs and a
+// 2048x2048 mipmapped texture), first once for all of them to share, then again in every context,
+// and prints how much the process's resident memory grew each way. With Mesa's software driver
+// (LIBGL_ALWAYS_SOFTWARE=1) everything the driver allocates lives in the process, so that's the
+// whole story. On a GPU most of it is video memory, which only shows up in the bytes uploaded.
+// Then draws spheres into an offscreen target from every shared context, each on its own thread,
+// against one thread taking turns with each context.
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "bench_common.h"
+#include "../src/context_manager.h"
+#include "../src/framebuffer.h"
+#include "../src/geometry_buffer.h"
+#include "../src/mesh.h"
+#include "../src/program_reflection.h"
+#include "../src/shader_data.h"
+#include "../src/shader_preprocessor.h"
+#include "../src/uniform_buffer.h"
+
+static ShaderPreprocessor preprocessor;
+const int TEXTURE_SIZE = 2048;
+const int TARGET_SIZE = 512;
+
+// Linux only, 0 elsewhere
+static size_t residentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+static double megabytes(double bytes)
+{
+    return bytes / (1024.0 * 1024.0);
+}
+
+// Everything that could be shared. Has to be destroyed with the context it was loaded in current.
+struct Resources
+{
+    ShaderPermutations shaders{ preprocessor, "./shaders/basic.vert", "./shaders/basic.frag", basicShaderFeatures };
+    ProgramReflection program;
+    GeometryBuffer geometry;
+    GLuint texture = 0;
+
+    void load(const LodMesh& sphere)
+    {
+        for (uint32_t features : { 0u, (uint32_t)BASIC_VERTEX_COLOUR, (uint32_t)BASIC_GLOBAL_COLOUR, (uint32_t)BASIC_OBJECT_UNIFORMS })
+            shaders.get(features);
+        program.build(shaders.get(BASIC_OBJECT_BLOCK));
+        geometry.add(sphere);
+        geometry.upload("Bench spheres");
+
+        std::vector<uint32_t> pixels((size_t)TEXTURE_SIZE * TEXTURE_SIZE);
+        for (size_t i = 0; i < pixels.size(); i++)
+            pixels[i] = (uint32_t)(i * 2654435761u) | 0xFF000000u;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TEXTURE_SIZE, TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glFinish();
+    }
+
+    void destroy()
+    {
+        shaders.clear();
+        geometry.destroy();
+        glDeleteTextures(1, &texture);
+    }
+
+    // Buffers and textures, programs aren't counted
+    size_t uploadedBytes() const
+    {
+        return geometry.byteSize() + (size_t)TEXTURE_SIZE * TEXTURE_SIZE * 4 * 4 / 3;
+    }
+};
+
+// What each context needs of its own to draw: a target and the per object data
+struct DrawState
+{
+    Framebuffer target;
+    UniformBuffer<PerFrame> perFrame;
+    UniformArrayBuffer<PerObject> perObject;
+
+    void create(int objects)
+    {
+        target.create(TARGET_SIZE, TARGET_SIZE, true, "Bench target");
+        perFrame.create("Bench PerFrame");
+        perFrame.data.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+        perObject.create(objects, "Bench PerObject");
+    }
+
+    void destroy()
+    {
+        target.destroy();
+        perFrame.destroy();
+        perObject.destroy();
+    }
+};
+
+// A grid of spheres, the geometry through this context's own VAO
+static void drawSpheres(ContextManager& contexts, const Resources& resources, DrawState& state, int objects, int frame)
+{
+    state.target.bind();
+    glEnable(GL_DEPTH_TEST);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glUseProgram(resources.program.program);
+    state.perFrame.data.time = (float)frame;
+    state.perFrame.upload(PER_FRAME_BINDING);
+    int side = 1;
+    while (side * side < objects)
+        side++;
+    float cell = 2.0f / side;
+    for (int i = 0; i < objects; i++)
+    {
+        int x = i % side, y = i / side;
+        state.perObject[i].objectOffset = { -1.0f + (x + 0.5f) * cell, -1.0f + (y + 0.5f) * cell, cell * 0.4f, 0.5f };
+        state.perObject[i].objectColour = { (float)x / side, (float)y / side, (float)(frame % 10) / 10.0f, 1.0f };
+    }
+    state.perObject.upload(objects);
+    glBindVertexArray(contexts.vertexArray(&resources.geometry, [&] { resources.geometry.attach(); }));
+    for (int i = 0; i < objects; i++)
+    {
+        state.perObject.bind(i, PER_OBJECT_BINDING);
+        resources.geometry.draw(0, 0);
+    }
+    glBindVertexArray(0);
+    Framebuffer::unbind(TARGET_SIZE, TARGET_SIZE);
+}
+
+int main(int argc, char** argv)
+{
+    int contextCount = std::max(2, benchArgument(argc, argv, "--contexts", 4));
+    int frames = benchArgument(argc, argv, "--frames", 100);
+    int objects = benchArgument(argc, argv, "--objects", 256);
+    if (!initBenchGlfw())
+        return 1;
+    LodMesh sphere = buildLods(makeSphere(64, 128), 5);
+
+    // Shared: loaded once, every other context just gets a VAO for the geometry
+    size_t before = residentBytes();
+    ContextManager contexts;
+    std::vector<GLFWwindow*> shared;
+    for (int i = 0; i < contextCount; i++)
+        shared.push_back(contexts.createHeadless("Shared bench context"));
+    if (!shared.back() || !contexts.makeCurrent(shared[0]) || !gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        return 1;
+    std::cout << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
+    Resources resources;
+    resources.load(sphere);
+    for (GLFWwindow* window : shared)
+    {
+        contexts.makeCurrent(window);
+        contexts.vertexArray(&resources.geometry, [&] { resources.geometry.attach(); });
+        glFinish();
+    }
+    size_t sharedBytes = residentBytes() - before;
+    size_t vertexArrays = contexts.containerCount();
+
+    std::vector<DrawState> states(contextCount);
+    for (int i = 0; i < contextCount; i++)
+    {
+        contexts.makeCurrent(shared[i]);
+        states[i].create(objects);
+    }
+
+    // Every context on its own thread at once. Each thread has to let go of its context at the end
+    // so the next test can take them all in turn.
+    contexts.release();
+    BenchTimer timer;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < contextCount; i++)
+    {
+        threads.emplace_back([&, i] {
+            contexts.makeCurrent(shared[i]);
+            for (int frame = 0; frame < frames; frame++)
+                drawSpheres(contexts, resources, states[i], objects, frame);
+            glFinish();
+            contexts.release();
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    double parallelMs = timer.ms();
+
+    // One thread going round them all
+    timer.reset();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int i = 0; i < contextCount; i++)
+        {
+            contexts.makeCurrent(shared[i]);
+            drawSpheres(contexts, resources, states[i], objects, frame);
+            glFlush();
+        }
+    }
+    for (int i = 0; i < contextCount; i++)
+    {
+        contexts.makeCurrent(shared[i]);
+        glFinish();
+    }
+    double serialMs = timer.ms();
+
+    for (int i = contextCount - 1; i >= 0; i--)
+    {
+        contexts.makeCurrent(shared[i]);
+        states[i].destroy();
+    }
+    resources.destroy();
+    contexts.destroyAll();
+
+    // Separate: every context loads its own copy of everything
+    before = residentBytes();
+    std::vector<GLFWwindow*> separate;
+    std::vector<std::unique_ptr<Resources>> copies;
+    for (int i = 0; i < contextCount; i++)
+    {
+        GLFWwindow* window = glfwCreateWindow(1, 1, "Separate bench context", NULL, NULL);
+        if (!window)
+            return 1;
+        glfwMakeContextCurrent(window);
+        separate.push_back(window);
+        copies.push_back(std::make_unique<Resources>());
+        copies.back()->load(sphere);
+    }
+    size_t separateBytes = residentBytes() - before;
+    for (int i = contextCount - 1; i >= 0; i--)
+    {
+        glfwMakeContextCurrent(separate[i]);
+        copies[i]->destroy();
+        glfwDestroyWindow(separate[i]);
+    }
+
+    size_t uploaded = copies[0]->uploadedBytes();
+    std::cout << contextCount << " contexts, " << megabytes((double)uploaded) << "MB of buffers and textures each, shared with "
+        << vertexArrays << " VAOs (one per context)" << std::endl;
+    std::cout << "Resident memory: shared " << megabytes((double)sharedBytes) << "MB, separate " << megabytes((double)separateBytes) << "MB, saved "
+        << megabytes((double)separateBytes - (double)sharedBytes) << "MB (at least " << megabytes((double)uploaded * (contextCount - 1)) << "MB uploaded once rather than "
+        << contextCount << " times)" << std::endl;
+    std::cout << "Drawing " << frames << " frames of " << objects << " spheres in every context: " << contextCount << " threads " << parallelMs
+        << "ms, 1 thread " << serialMs << "ms (" << serialMs / parallelMs << "x)" << std::endl;
+    glfwTerminate();
+    return 0;
+}
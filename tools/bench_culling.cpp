@@ -0,0 +1,80 @@
+// Frustum culling a big field of objects: one at a time vs SIMD, and SIMD over the job system.
+//   bench_culling [--objects 200000] [--frames 100]
+// The objects are scattered through a 200 unit cube around a camera that turns a little each frame,
+// so roughly 1 in 10 ends up visible. Build with -mavx for the 8 wide test. Doesn't need a GL context.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/culling.h"
+#include "../src/job_system.h"
+
+static float randomFloat()
+{
+    return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static Frustum cameraFrustum(int frame)
+{
+    float angle = frame * 0.01f;
+    Vec3 target = { sinf(angle), 0.0f, -cosf(angle) };
+    return Frustum::fromMatrix(perspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) * lookAt({ 0, 0, 0 }, target, { 0, 1, 0 }));
+}
+
+// Average ms per frame, and how many were visible on the last one
+static double run(const BoundsArray& bounds, CullShape shape, int frames, JobSystem* jobs, bool scalar, std::vector<uint32_t>& visible)
+{
+    FrustumCuller culler;
+    BenchTimer timer;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        Frustum frustum = cameraFrustum(frame);
+        if (scalar)
+        {
+            visible.clear();
+            cullRangeScalar(frustum, bounds, shape, 0, bounds.size(), visible);
+        }
+        else
+        {
+            culler.cull(frustum, bounds, shape, visible, jobs);
+        }
+    }
+    return timer.ms() / frames;
+}
+
+int main(int argc, char** argv)
+{
+    size_t objectCount = (size_t)benchArgument(argc, argv, "--objects", 200000);
+    int frames = benchArgument(argc, argv, "--frames", 100);
+
+    BoundsArray bounds;
+    bounds.resize(objectCount);
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        Vec3 center = { randomFloat() * 100.0f, randomFloat() * 100.0f, randomFloat() * 100.0f };
+        Vec3 extent = { 0.5f + fabsf(randomFloat()), 0.5f + fabsf(randomFloat()), 0.5f + fabsf(randomFloat()) };
+        bounds.set(i, center, extent);
+    }
+
+    JobSystem jobs;
+    std::cout << objectCount << " objects, " << jobs.threadCount() << " threads" << std::endl;
+    const CullShape shapes[] = { CullShape::Spheres, CullShape::Boxes };
+    for (CullShape shape : shapes)
+    {
+        std::vector<uint32_t> scalarVisible, simdVisible, threadedVisible;
+        double scalarMs = run(bounds, shape, frames, nullptr, true, scalarVisible);
+        double simdMs = run(bounds, shape, frames, nullptr, false, simdVisible);
+        double threadedMs = run(bounds, shape, frames, &jobs, false, threadedVisible);
+        std::cout << (shape == CullShape::Spheres ? "Spheres" : "Boxes") << ": " << scalarVisible.size() << " visible, "
+            << scalarMs << "ms scalar, " << simdMs << "ms SIMD, " << threadedMs << "ms SIMD + threads" << std::endl;
+
+        // All three should agree on exactly which objects are visible, in the same order
+        if (scalarVisible != simdVisible || scalarVisible != threadedVisible)
+        {
+            std::cerr << "Visible lists don't match between the scalar, SIMD and threaded culling" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
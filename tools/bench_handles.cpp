@@ -0,0 +1,195 @@
+// Making and throwing away lots of short lived things through src/handle_pool.h and src/gl_objects.h.
+//   bench_handles [--handles 1000000] [--live 10000] [--gl 0]
+// First without GL: --handles creates and destroys in a random order, with about --live alive at
+// once, in a HandlePool against an unordered_map keyed by an ever increasing id and against
+// allocating each one with new. Every destroyed handle is kept and checked afterwards, none of them
+// may still find anything even though their slots have been reused many times over.
+// With --gl 1 the same churn is done with real buffers, deleting each one straight away with a
+// GLBuffer against a GLObjectPool that deletes them in one call per frame of 1000.
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "bench_common.h"
+#include "../src/gl_objects.h"
+#include "../src/handle_pool.h"
+
+// Something about the size of a small component
+struct Payload
+{
+    float position[3];
+    float velocity[3];
+    uint32_t flags;
+};
+
+// The same random sequence of creates and destroys for every container: true to create
+static std::vector<bool> makeSchedule(size_t operations, size_t live)
+{
+    std::vector<bool> schedule;
+    srand(1);
+    size_t alive = 0;
+    for (size_t i = 0; i < operations; i++)
+    {
+        bool create = alive == 0 || (alive < live * 2 && (size_t)rand() % (live * 2) >= alive);
+        schedule.push_back(create);
+        alive += create ? 1 : -1;
+    }
+    return schedule;
+}
+
+// Which of the live ones to destroy next. The caller swaps it with the last so removing it is cheap.
+static size_t pickVictim(size_t alive)
+{
+    return (size_t)rand() % alive;
+}
+
+int main(int argc, char** argv)
+{
+    size_t operations = (size_t)benchArgument(argc, argv, "--handles", 1000000);
+    size_t live = (size_t)benchArgument(argc, argv, "--live", 10000);
+    bool withGl = benchArgument(argc, argv, "--gl", 0) != 0;
+    std::vector<bool> schedule = makeSchedule(operations, live);
+    std::cout << operations << " creates and destroys, about " << live << " alive at once" << std::endl;
+
+    // HandlePool
+    HandlePool<Payload> pool;
+    std::vector<Handle> handles, stale;
+    stale.reserve(operations);
+    size_t peak = 0;
+    srand(2);
+    BenchTimer timer;
+    for (bool create : schedule)
+    {
+        if (create)
+        {
+            handles.push_back(pool.create(Payload{ { 1.0f, 2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f }, 0u }));
+            peak = std::max(peak, handles.size());
+        }
+        else
+        {
+            size_t victim = pickVictim(handles.size());
+            pool.destroy(handles[victim]);
+            stale.push_back(handles[victim]);
+            handles[victim] = handles.back();
+            handles.pop_back();
+        }
+    }
+    double poolMs = timer.ms();
+    size_t found = 0;
+    for (Handle handle : stale)
+        found += pool.get(handle) != nullptr;
+    for (Handle handle : handles)
+        found += pool.get(handle) == nullptr;
+    if (found)
+    {
+        std::cerr << found << " handles found the wrong thing" << std::endl;
+        return 1;
+    }
+    std::cout << "HandlePool: " << poolMs << "ms, " << poolMs * 1e6 / operations << "ns each, " << pool.slotCount()
+        << " slots for a peak of " << peak << " alive, " << stale.size() << " stale handles all rejected" << std::endl;
+
+    // unordered_map with ids that are never reused
+    std::unordered_map<uint64_t, Payload> map;
+    std::vector<uint64_t> ids;
+    uint64_t nextId = 1;
+    srand(2);
+    timer.reset();
+    for (bool create : schedule)
+    {
+        if (create)
+        {
+            map.emplace(nextId, Payload{ { 1.0f, 2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f }, 0u });
+            ids.push_back(nextId++);
+        }
+        else
+        {
+            size_t victim = pickVictim(ids.size());
+            map.erase(ids[victim]);
+            ids[victim] = ids.back();
+            ids.pop_back();
+        }
+    }
+    double mapMs = timer.ms();
+    std::cout << "unordered_map: " << mapMs << "ms, " << mapMs * 1e6 / operations << "ns each" << std::endl;
+
+    // new and delete
+    std::vector<std::unique_ptr<Payload>> pointers;
+    srand(2);
+    timer.reset();
+    for (bool create : schedule)
+    {
+        if (create)
+            pointers.push_back(std::make_unique<Payload>(Payload{ { 1.0f, 2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f }, 0u }));
+        else
+        {
+            size_t victim = pickVictim(pointers.size());
+            pointers[victim] = std::move(pointers.back());
+            pointers.pop_back();
+        }
+    }
+    double newMs = timer.ms();
+    std::cout << "new/delete: " << newMs << "ms, " << newMs * 1e6 / operations << "ns each" << std::endl;
+
+    if (!withGl)
+        return 0;
+    if (!createBenchContext(64, 64))
+        return 1;
+    const size_t FRAME = 1000;
+
+    // A GLBuffer each, deleted as soon as it's dropped
+    {
+        std::vector<GLBuffer> buffers;
+        srand(2);
+        timer.reset();
+        for (size_t i = 0; i < schedule.size(); i++)
+        {
+            if (schedule[i])
+                buffers.push_back(GLBuffer::create());
+            else
+            {
+                size_t victim = pickVictim(buffers.size());
+                buffers[victim] = std::move(buffers.back());
+                buffers.pop_back();
+            }
+            if (i % FRAME == FRAME - 1)
+                glFlush();
+        }
+        glFinish();
+        double ms = timer.ms();
+        std::cout << "GLBuffer: " << ms << "ms, " << ms * 1e6 / operations << "ns each" << std::endl;
+        for (GLBuffer& buffer : buffers)
+            buffer.reset();
+    }
+
+    // GLObjectPool, deleting once a frame
+    GLObjectPool<GLBufferTraits> bufferPool;
+    handles.clear();
+    srand(2);
+    timer.reset();
+    for (size_t i = 0; i < schedule.size(); i++)
+    {
+        if (schedule[i])
+            handles.push_back(bufferPool.create());
+        else
+        {
+            size_t victim = pickVictim(handles.size());
+            bufferPool.destroy(handles[victim]);
+            handles[victim] = handles.back();
+            handles.pop_back();
+        }
+        if (i % FRAME == FRAME - 1)
+        {
+            bufferPool.endFrame();
+            glFlush();
+        }
+    }
+    bufferPool.endFrame();
+    glFinish();
+    double ms = timer.ms();
+    std::cout << "GLObjectPool: " << ms << "ms, " << ms * 1e6 / operations << "ns each, " << bufferPool.deleteCalls() << " glDeleteBuffers calls" << std::endl;
+    bufferPool.clear();
+    glfwTerminate();
+    return 0;
+}
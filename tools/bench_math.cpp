@@ -0,0 +1,85 @@
+// The SIMD maths in src/simd_math.h against the scalar versions of the same functions.
+//   bench_math [--count 65536] [--repeats 200]
+// Build it with -mavx (or /arch:AVX) to get the 8 wide paths. Doesn't need a GL context.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/simd_math.h"
+
+static float randomFloat()
+{
+    return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static bool matches(const float* a, const float* b, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        if (fabsf(a[i] - b[i]) > 1e-4f * (1.0f + fabsf(a[i])))
+            return false;
+    return true;
+}
+
+template <typename Function>
+static double timeMs(int repeats, Function function)
+{
+    BenchTimer timer;
+    for (int r = 0; r < repeats; r++)
+        function();
+    return timer.ms() / repeats;
+}
+
+static void report(const char* name, double scalarMs, double simdMs, bool same)
+{
+    std::cout << name << ": " << scalarMs << "ms scalar, " << simdMs << "ms SIMD (" << scalarMs / simdMs << "x)"
+        << (same ? "" : " RESULTS DIFFER") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = (size_t)benchArgument(argc, argv, "--count", 65536);
+    int repeats = benchArgument(argc, argv, "--repeats", 200);
+#if defined(MATH_AVX)
+    std::cout << "AVX + SSE";
+#elif defined(MATH_SSE)
+    std::cout << "SSE";
+#elif defined(MATH_NEON)
+    std::cout << "NEON";
+#else
+    std::cout << "Scalar only";
+#endif
+    std::cout << ", " << count << " items, average of " << repeats << " runs" << std::endl;
+
+    std::vector<Mat4> a(count), b(count), scalarMatrices(count), simdMatrices(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i] = compose({ randomFloat(), randomFloat(), randomFloat() }, normalize(Quat{ randomFloat(), randomFloat(), randomFloat(), randomFloat() }), { 1, 2, 3 });
+        b[i] = compose({ randomFloat(), randomFloat(), randomFloat() }, normalize(Quat{ randomFloat(), randomFloat(), randomFloat(), randomFloat() }), { 3, 2, 1 });
+    }
+    double scalarMs = timeMs(repeats, [&] { multiplyMatricesScalar(a.data(), b.data(), scalarMatrices.data(), count); });
+    double simdMs = timeMs(repeats, [&] { multiplyMatrices(a.data(), b.data(), simdMatrices.data(), count); });
+    report("Multiply matrices", scalarMs, simdMs, matches(&scalarMatrices[0].columns[0].x, &simdMatrices[0].columns[0].x, count * 16));
+
+    Mat4 m = perspective(1.0f, 4.0f / 3.0f, 0.1f, 100.0f) * lookAt({ 0, 2, 5 }, { 0, 0, 0 }, { 0, 1, 0 });
+    std::vector<Vec3> points(count), scalarPoints(count), simdPoints(count);
+    for (Vec3& point : points)
+        point = { randomFloat(), randomFloat(), randomFloat() };
+    scalarMs = timeMs(repeats, [&] { transformPointsScalar(m, points.data(), scalarPoints.data(), count); });
+    simdMs = timeMs(repeats, [&] { transformPoints(m, points.data(), simdPoints.data(), count); });
+    report("Transform points (array of Vec3)", scalarMs, simdMs, matches(&scalarPoints[0].x, &simdPoints[0].x, count * 3));
+
+    std::vector<float> x(count), y(count), z(count);
+    std::vector<float> scalarX(count), scalarY(count), scalarZ(count), simdX(count), simdY(count), simdZ(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+    scalarMs = timeMs(repeats, [&] { transformPointsScalar(m, x.data(), y.data(), z.data(), scalarX.data(), scalarY.data(), scalarZ.data(), count); });
+    simdMs = timeMs(repeats, [&] { transformPoints(m, x.data(), y.data(), z.data(), simdX.data(), simdY.data(), simdZ.data(), count); });
+    report("Transform points (separate x, y, z)", scalarMs, simdMs,
+        matches(scalarX.data(), simdX.data(), count) && matches(scalarY.data(), simdY.data(), count) && matches(scalarZ.data(), simdZ.data(), count));
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Occlusion culling a city of small objects behind big walls, on top of frustum culling.
+//   bench_occlusion [--objects 100000] [--walls 40] [--frames 100]
+// The camera stands in the middle and turns a little each frame. Each frame draws the walls into
+// the occlusion buffer, builds the depth pyramid and tests whatever frustum culling let through,
+// one thread and then with the job system. Doesn't need a GL context.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/culling.h"
+#include "../src/job_system.h"
+#include "../src/occlusion.h"
+
+static float randomFloat()
+{
+    return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static Mat4 cameraMatrix(int frame)
+{
+    float angle = frame * 0.01f;
+    Vec3 eye = { 0.0f, 1.7f, 0.0f };
+    Vec3 target = { sinf(angle), 1.7f, -cosf(angle) };
+    return perspective(1.0f, 16.0f / 9.0f, 0.1f, 200.0f) * lookAt(eye, target, { 0, 1, 0 });
+}
+
+// A unit cube from -1 to 1, which is all a wall needs
+static void makeCube(std::vector<Vec3>& vertices, std::vector<uint32_t>& indices)
+{
+    for (int corner = 0; corner < 8; corner++)
+        vertices.push_back({ corner & 1 ? 1.0f : -1.0f, corner & 2 ? 1.0f : -1.0f, corner & 4 ? 1.0f : -1.0f });
+    const uint32_t faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+    for (const uint32_t* face : faces)
+        indices.insert(indices.end(), { face[0], face[1], face[2], face[0], face[2], face[3] });
+}
+
+struct FrameTotals
+{
+    double frustumMs = 0.0;
+    double occlusionMs = 0.0;
+    size_t frustumVisible = 0;
+    size_t visible = 0;
+};
+
+static FrameTotals run(const BoundsArray& bounds, const std::vector<Mat4>& walls, const std::vector<Vec3>& cubeVertices,
+    const std::vector<uint32_t>& cubeIndices, int frames, JobSystem* jobs, OcclusionCuller& occlusion, std::vector<uint32_t>& visible)
+{
+    FrustumCuller frustumCuller;
+    std::vector<uint32_t> candidates;
+    FrameTotals totals;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        Mat4 camera = cameraMatrix(frame);
+        BenchTimer timer;
+        frustumCuller.cull(Frustum::fromMatrix(camera), bounds, CullShape::Boxes, candidates, jobs);
+        totals.frustumMs += timer.ms();
+
+        timer.reset();
+        occlusion.beginFrame(camera);
+        for (const Mat4& wall : walls)
+            occlusion.addOccluder(cubeVertices, cubeIndices.data(), cubeIndices.size(), wall);
+        occlusion.buildPyramid(jobs);
+        occlusion.cull(bounds, candidates, visible, jobs);
+        occlusion.endFrame();
+        totals.occlusionMs += timer.ms();
+        totals.frustumVisible += candidates.size();
+        totals.visible += visible.size();
+    }
+    return totals;
+}
+
+int main(int argc, char** argv)
+{
+    size_t objectCount = (size_t)benchArgument(argc, argv, "--objects", 100000);
+    int wallCount = benchArgument(argc, argv, "--walls", 40);
+    int frames = benchArgument(argc, argv, "--frames", 100);
+
+    // Objects are crates and lamp posts scattered over a 200 unit square
+    BoundsArray bounds;
+    bounds.resize(objectCount);
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        Vec3 extent = { 0.3f + fabsf(randomFloat()), 0.3f + 2.0f * fabsf(randomFloat()), 0.3f + fabsf(randomFloat()) };
+        bounds.set(i, { randomFloat() * 100.0f, extent.y, randomFloat() * 100.0f }, extent);
+    }
+
+    // Walls in a ring around the camera, 20 to 60 units away, each 10 to 30 units long
+    std::vector<Mat4> walls;
+    for (int i = 0; i < wallCount; i++)
+    {
+        float angle = (i + 0.5f * fabsf(randomFloat())) * 6.2831853f / wallCount;
+        float distance = 20.0f + 40.0f * fabsf(randomFloat());
+        Quat facing = axisAngle({ 0, 1, 0 }, -angle);
+        Vec3 position = { sinf(angle) * distance, 4.0f, -cosf(angle) * distance };
+        walls.push_back(compose(position, facing, { 5.0f + 10.0f * fabsf(randomFloat()), 4.0f, 0.5f }));
+    }
+    std::vector<Vec3> cubeVertices;
+    std::vector<uint32_t> cubeIndices;
+    makeCube(cubeVertices, cubeIndices);
+
+    JobSystem jobs;
+    std::cout << objectCount << " objects, " << wallCount << " walls, " << jobs.threadCount() << " threads" << std::endl;
+
+    OcclusionCuller single, threaded;
+    std::vector<uint32_t> singleVisible, threadedVisible;
+    FrameTotals singleTotals = run(bounds, walls, cubeVertices, cubeIndices, frames, nullptr, single, singleVisible);
+    FrameTotals threadedTotals = run(bounds, walls, cubeVertices, cubeIndices, frames, &jobs, threaded, threadedVisible);
+
+    const OcclusionStats& stats = single.totals;
+    std::cout << "Per frame: " << singleTotals.frustumVisible / frames << " after frustum culling, " << singleTotals.visible / frames
+        << " after occlusion culling (" << 100.0 * stats.occluded / std::max<size_t>(stats.tested, 1) << "% of the rest occluded)" << std::endl;
+    std::cout << "Occlusion, one thread: " << singleTotals.occlusionMs / frames << "ms (raster " << stats.rasterMs / frames << "ms for "
+        << stats.occluderTriangles / frames << " triangles, pyramid " << stats.pyramidMs / frames << "ms, test " << stats.testMs / frames << "ms)" << std::endl;
+    std::cout << "Occlusion, with threads: " << threadedTotals.occlusionMs / frames << "ms (test " << threaded.totals.testMs / frames << "ms)" << std::endl;
+    std::cout << "Frustum culling: " << singleTotals.frustumMs / frames << "ms one thread, " << threadedTotals.frustumMs / frames << "ms with threads" << std::endl;
+
+    // Splitting the tests across threads mustn't change which objects survive, or their order
+    if (singleVisible != threadedVisible || singleTotals.visible != threadedTotals.visible)
+    {
+        std::cerr << "Visible lists don't match between one thread and the job system" << std::endl;
+        return 1;
+    }
+    return 0;
+}
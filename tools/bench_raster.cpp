@@ -0,0 +1,185 @@
+// The software rasteriser in src/software_rasteriser.h on 1 thread up to one per core.
+//   bench_raster [--triangles 200000] [--frames 20] [--width 1280] [--height 720]
+// Two scenes: lots of small triangles, which is mostly setup and binning, and a few dozen triangles
+// covering most of the screen, which is mostly filling pixels. Every thread count has to give the
+// same pictures, and the RGB triangle and hello rectangle demos are drawn and spot checked first.
+// Doesn't need a GL context.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "../src/demo_geometry.h"
+#include "../src/hash.h"
+#include "../src/job_system.h"
+#include "../src/software_rasteriser.h"
+
+static float randomFloat()
+{
+    return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+struct Scene
+{
+    std::vector<Vec4> positions;
+    std::vector<Vec4> colours;
+    std::vector<uint32_t> indices;
+};
+
+// Triangles a few pixels across scattered over the screen at random depths
+static Scene smallTriangles(size_t count, int width)
+{
+    Scene scene;
+    float size = 16.0f / width;
+    for (size_t i = 0; i < count; i++)
+    {
+        Vec4 centre = { randomFloat(), randomFloat(), randomFloat() * 0.9f, 1.0f };
+        for (int corner = 0; corner < 3; corner++)
+        {
+            scene.positions.push_back({ centre.x + randomFloat() * size, centre.y + randomFloat() * size, centre.z, 1.0f });
+            scene.colours.push_back({ fabsf(randomFloat()), fabsf(randomFloat()), fabsf(randomFloat()), 1.0f });
+            scene.indices.push_back((uint32_t)scene.indices.size());
+        }
+    }
+    return scene;
+}
+
+// Screen sized triangles drawn back to front, so every pixel passes the depth test every time
+static Scene bigTriangles(size_t count)
+{
+    Scene scene;
+    for (size_t i = 0; i < count; i++)
+    {
+        float z = 0.9f - 1.8f * i / count;
+        const Vec4 corners[3] = { { -1.2f, -1.2f, z, 1.0f }, { 1.8f, -1.0f, z, 1.0f }, { -1.0f, 1.6f, z, 1.0f } };
+        for (const Vec4& corner : corners)
+        {
+            scene.positions.push_back(corner);
+            scene.colours.push_back({ fabsf(randomFloat()), fabsf(randomFloat()), fabsf(randomFloat()), 1.0f });
+            scene.indices.push_back((uint32_t)scene.indices.size());
+        }
+    }
+    return scene;
+}
+
+static uint32_t hashPicture(const SoftwareRasteriser& rasteriser)
+{
+    std::vector<uint8_t> rgba;
+    rasteriser.readColour(rgba);
+    return fnv1a((const char*)rgba.data(), rgba.size());
+}
+
+// Checks a few pixels of the demos against what GL draws for them
+static bool checkDemos(int width, int height)
+{
+    SoftwareRasteriser rasteriser;
+    rasteriser.resize(width, height);
+    bool ok = true;
+    auto expect = [&](const char* what, int x, int y, int r, int g, int b) {
+        uint32_t colour = rasteriser.colourAt(x, y);
+        int gotR = colour & 0xFF, gotG = (colour >> 8) & 0xFF, gotB = (colour >> 16) & 0xFF;
+        if (abs(gotR - r) > 1 || abs(gotG - g) > 1 || abs(gotB - b) > 1)
+        {
+            std::cerr << what << " at (" << x << ", " << y << ") is " << gotR << ", " << gotG << ", " << gotB
+                << " rather than " << r << ", " << g << ", " << b << std::endl;
+            ok = false;
+        }
+    };
+
+    rasteriser.clear({ 0.0f, 0.0f, 0.0f, 1.0f });
+    rasteriser.drawInterleaved(RGB_TRIANGLE_VERTICES, 3, RGB_TRIANGLE_FLOATS_PER_VERTEX, RGB_TRIANGLE_COLOUR_OFFSET, CONSTANT_ORANGE);
+    // The middle of the triangle (a third of the way up) is an even mix of the three corners
+    expect("RGB triangle", width / 2, height / 2 - height / 12, 85, 85, 85);
+    expect("RGB triangle", width / 4 + 2, height / 4 + 2, 252, 1, 2);
+    expect("Outside the RGB triangle", width / 4, height * 3 / 4, 0, 0, 0);
+
+    rasteriser.clear({ 0.0f, 0.0f, 0.0f, 1.0f });
+    rasteriser.drawInterleaved(HELLO_RECTANGLE_VERTICES, 4, 3, -1, CONSTANT_ORANGE, HELLO_RECTANGLE_INDICES, 6);
+    expect("Hello rectangle", width / 2, height / 2, 255, 128, 51);
+    expect("Hello rectangle", width / 4, height / 4, 255, 128, 51);
+    expect("Outside the hello rectangle", width / 4 - 1, height / 4 - 1, 0, 0, 0);
+    // Both triangles of the rectangle share the diagonal, every pixel should be drawn exactly once
+    if (rasteriser.stats.pixels != (size_t)(width / 2) * (height / 2))
+    {
+        std::cerr << "Hello rectangle drew " << rasteriser.stats.pixels << " pixels rather than " << (width / 2) * (height / 2) << std::endl;
+        ok = false;
+    }
+    return ok;
+}
+
+// Per frame, averaged over the run
+struct RunResult
+{
+    double ms = 0.0;
+    double setupMs = 0.0;
+    double rasterMs = 0.0;
+    size_t pixels = 0;
+    uint32_t hash = 0;
+};
+
+static RunResult run(SoftwareRasteriser& rasteriser, const Scene& scene, int frames, JobSystem* jobs)
+{
+    RunResult result;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        rasteriser.clear({ 0.0f, 0.0f, 0.0f, 1.0f });
+        BenchTimer timer;
+        rasteriser.drawTriangles(scene.positions.data(), scene.colours.data(), scene.indices.data(), scene.indices.size(), jobs);
+        result.ms += timer.ms();
+        result.setupMs += rasteriser.stats.setupMs;
+        result.rasterMs += rasteriser.stats.rasterMs;
+        result.pixels += rasteriser.stats.pixels;
+    }
+    result.ms /= frames;
+    result.setupMs /= frames;
+    result.rasterMs /= frames;
+    result.pixels /= frames;
+    result.hash = hashPicture(rasteriser);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    size_t triangleCount = (size_t)benchArgument(argc, argv, "--triangles", 200000);
+    int frames = benchArgument(argc, argv, "--frames", 20);
+    int width = benchArgument(argc, argv, "--width", 1280);
+    int height = benchArgument(argc, argv, "--height", 720);
+
+    if (!checkDemos(800, 600))
+        return 1;
+    std::cout << "RGB triangle and hello rectangle match GL" << std::endl;
+
+    const Scene scenes[] = { smallTriangles(triangleCount, width), bigTriangles(64) };
+    const char* names[] = { "Small triangles", "Big triangles" };
+    SoftwareRasteriser rasteriser;
+    rasteriser.resize(width, height);
+    std::cout << width << "x" << height << ", " << SoftwareRasteriser::TILE_SIZE << " pixel tiles" << std::endl;
+
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (int sceneIndex = 0; sceneIndex < 2; sceneIndex++)
+    {
+        const Scene& scene = scenes[sceneIndex];
+        size_t triangles = scene.indices.size() / 3;
+        uint32_t firstHash = 0;
+        for (unsigned threads = 1; threads <= cores; threads = threads < cores && threads * 2 > cores ? cores : threads * 2)
+        {
+            // The thread calling drawTriangles joins in, so one less worker than threads
+            JobSystem jobs(threads - 1);
+            RunResult result = run(rasteriser, scene, frames, threads > 1 ? &jobs : nullptr);
+            std::cout << names[sceneIndex] << ", " << threads << " thread" << (threads > 1 ? "s" : "") << ": " << result.ms << "ms, "
+                << triangles / result.ms / 1000.0 << "M triangles/s, " << result.pixels / result.ms / 1000.0 << "M pixels/s ("
+                << result.pixels << " pixels, setup " << result.setupMs << "ms, raster " << result.rasterMs << "ms)" << std::endl;
+            if (threads == 1)
+                firstHash = result.hash;
+            else if (result.hash != firstHash)
+            {
+                std::cerr << "The picture changed with " << threads << " threads" << std::endl;
+                return 1;
+            }
+            if (threads == cores)
+                break;
+        }
+    }
+    return 0;
+}
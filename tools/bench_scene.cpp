@@ -0,0 +1,76 @@
+// Scene transform updates for a big hierarchy, on one thread vs the job system.
+//   bench_scene [--nodes 100000] [--frames 100]
+// The tree is 4 children per node, so 100k nodes is 9 levels deep. Each frame either every node
+// moves, or only 1% of them do (along with everything under them).
+// Doesn't need a GL context.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/job_system.h"
+#include "../src/scene.h"
+
+static Scene buildScene(int nodeCount)
+{
+    Scene scene;
+    for (int i = 0; i < nodeCount; i++)
+    {
+        uint32_t node = scene.addNode(i == 0 ? Scene::NO_PARENT : (uint32_t)(i - 1) / 4);
+        scene.setPosition(node, (float)(i % 7), (float)(i % 5), (float)(i % 3));
+    }
+    return scene;
+}
+
+static void spin(Scene& scene, uint32_t node, float time)
+{
+    float angle = time + node * 0.01f;
+    scene.setRotation(node, 0.0f, sinf(angle / 2.0f), 0.0f, cosf(angle / 2.0f));
+}
+
+// Average ms per frame
+static double run(Scene& scene, JobSystem* jobs, int frames, int everyNth)
+{
+    int nodeCount = (int)scene.size();
+    BenchTimer timer;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int node = frame % everyNth; node < nodeCount; node += everyNth)
+            spin(scene, node, frame * 0.016f);
+        scene.update(jobs);
+    }
+    return timer.ms() / frames;
+}
+
+int main(int argc, char** argv)
+{
+    int nodeCount = benchArgument(argc, argv, "--nodes", 100000);
+    int frames = benchArgument(argc, argv, "--frames", 100);
+
+    JobSystem jobs;
+    Scene single = buildScene(nodeCount);
+    Scene threaded = buildScene(nodeCount);
+    single.update();
+    threaded.update(&jobs);
+
+    std::cout << nodeCount << " nodes, " << jobs.threadCount() << " threads" << std::endl;
+    double allSingle = run(single, nullptr, frames, 1);
+    double allThreaded = run(threaded, &jobs, frames, 1);
+    std::cout << "Every node moves: " << allSingle << "ms single, " << allThreaded << "ms threaded" << std::endl;
+    double someSingle = run(single, nullptr, frames, 100);
+    size_t updated = single.lastUpdated;
+    double someThreaded = run(threaded, &jobs, frames, 100);
+    std::cout << "1% of nodes move: " << someSingle << "ms single, " << someThreaded << "ms threaded ("
+        << updated << " matrices recomputed per frame)" << std::endl;
+
+    // Both scenes went through exactly the same changes, so they should have ended up in the same place
+    for (int node = 0; node < nodeCount; node++)
+    {
+        if (memcmp(single.worldMatrix(node), threaded.worldMatrix(node), 16 * sizeof(float)) != 0)
+        {
+            std::cerr << "Node " << node << " doesn't match between the single and threaded updates" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+// Quads that each use a different texture, drawn three ways:
+//  - own textures: a glBindTexture and a draw call per quad
+//  - texture array: every texture a layer of one GL_TEXTURE_2D_ARRAY, with the layer in the
+//    vertices, so one draw
+//  - bindless: each texture's GL_ARB_bindless_texture handle in the vertices, one draw (only if
+//    the driver has the extension)
+//   bench_textures [--frames 200] [--draws 4096] [--size 64]
+// For 16, 64 and 256 distinct textures of --size x --size, draws --draws quads a frame with quad i
+// using texture i % N, so neighbouring quads never share one. Prints the time per frame including
+// glFinish so the driver's share of the work is counted, and the draw calls and binds per frame.
+// The samplers come from a SamplerCache throughout. Also pools the photos in ./textures, which are
+// all the same size, into texture arrays.
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "bench_common.h"
+#include "../src/bindless_textures.h"
+#include "../src/gl_features.h"
+#include "../src/jpeg.h"
+#include "../src/sampler_cache.h"
+#include "../src/shader_data.h"
+#include "../src/shader_preprocessor.h"
+#include "../src/texture_array.h"
+
+// Stripes at a different angle and colour for each texture, so they're all different
+static Image makeImage(int size, int index)
+{
+    Image image;
+    image.width = image.height = size;
+    image.rgba.resize((size_t)size * size * 4);
+    uint8_t r = (uint8_t)(index * 97), g = (uint8_t)(index * 57 + 80), b = (uint8_t)(index * 31 + 160);
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            bool stripe = ((x * (index % 5 + 1) + y * (index % 3 + 1)) / 6) % 2 == 0;
+            uint8_t* pixel = image.pixel(x, y);
+            pixel[0] = stripe ? r : 255 - r;
+            pixel[1] = stripe ? g : 255 - g;
+            pixel[2] = stripe ? b : 255 - b;
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+// Runs frames of draw() and returns the milliseconds per frame
+template <typename Draw>
+static double timeFrames(int frames, Draw draw)
+{
+    BenchTimer timer;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        draw();
+        glFinish();
+    }
+    return timer.ms() / frames;
+}
+
+int main(int argc, char** argv)
+{
+    int frames = benchArgument(argc, argv, "--frames", 200);
+    int draws = benchArgument(argc, argv, "--draws", 4096);
+    int size = benchArgument(argc, argv, "--size", 64);
+    GLFWwindow* window = createBenchContext(800, 600);
+    if (!window)
+        return 1;
+    glFeatures.detect();
+    BindlessTextures bindless;
+    bool haveBindless = bindless.load();
+
+    {
+        // Anything the same size shares an array
+        TextureArrayPool photos;
+        int loaded = 0;
+        for (const char* path : { "./textures/container.jpg", "./textures/wall.jpg" })
+        {
+            Image image;
+            if (readImage(path, image) && photos.add(image).layer >= 0)
+                loaded++;
+        }
+        photos.finish();
+        std::cout << "./textures: " << loaded << " photos in " << photos.count() << " texture array(s)" << std::endl;
+        photos.destroy();
+    }
+
+    ShaderPreprocessor preprocessor;
+    ShaderPermutations shaders(preprocessor, "./shaders/textured.vert", "./shaders/textured.frag", texturedShaderFeatures);
+    GLuint ownProgram = shaders.get(0);
+    GLuint arrayProgram = shaders.get(TEXTURED_ARRAY);
+    // Compiling needs the extension, so only try when it's there
+    GLuint bindlessProgram = haveBindless ? shaders.get(TEXTURED_BINDLESS) : 0;
+
+    // A grid of quads, six vertices each so each one can be drawn on its own
+    std::vector<TexturedVertex> vertices((size_t)draws * 6);
+    int side = (int)ceil(sqrt((double)draws));
+    float cell = 2.0f / side;
+    for (int i = 0; i < draws; i++)
+    {
+        float x = -1.0f + (i % side) * cell, y = -1.0f + (i / side) * cell, w = cell * 0.9f;
+        TexturedVertex corners[] = { { x, y, 0, 0, {} }, { x + w, y, 1, 0, {} }, { x + w, y + w, 1, 1, {} }, { x, y + w, 0, 1, {} } };
+        const int order[] = { 0, 1, 2, 0, 2, 3 };
+        for (int j = 0; j < 6; j++)
+            vertices[(size_t)i * 6 + j] = corners[order[j]];
+    }
+    GLVertexArray VAO = GLVertexArray::create();
+    glBindVertexArray(VAO);
+    GLBuffer VBO = GLBuffer::create();
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex), (void*)offsetof(TexturedVertex, x));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex), (void*)offsetof(TexturedVertex, u));
+    glEnableVertexAttribArray(1);
+    glVertexAttribIPointer(2, 2, GL_UNSIGNED_INT, sizeof(TexturedVertex), (void*)offsetof(TexturedVertex, texture));
+    glEnableVertexAttribArray(2);
+    // Each mode puts its own texture ids in and sends the lot
+    auto setTextures = [&](auto textureOf) {
+        for (int i = 0; i < draws; i++)
+        {
+            uint64_t id = textureOf(i);
+            for (int j = 0; j < 6; j++)
+            {
+                vertices[(size_t)i * 6 + j].texture[0] = (uint32_t)id;
+                vertices[(size_t)i * 6 + j].texture[1] = (uint32_t)(id >> 32);
+            }
+        }
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TexturedVertex), vertices.data(), GL_STATIC_DRAW);
+    };
+
+    SamplerCache samplers;
+    const SamplerState sampling = SamplerState::clamped();
+    std::cout << frames << " frames of " << draws << " quads, " << size << "x" << size << " textures" << std::endl;
+    for (int count : { 16, 64, 256 })
+    {
+        std::vector<Image> images;
+        std::vector<GLTexture> textures;
+        for (int i = 0; i < count; i++)
+        {
+            images.push_back(makeImage(size, i));
+            textures.push_back(GLTexture::create());
+            glBindTexture(GL_TEXTURE_2D, textures.back());
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, images.back().rgba.data());
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // A bind and a draw per quad
+        setTextures([](int) { return 0; });
+        glUseProgram(ownProgram);
+        glActiveTexture(GL_TEXTURE0);
+        uint64_t binds = 0;
+        double ownMs = timeFrames(frames, [&] {
+            samplers.bind(0, sampling);
+            for (int i = 0; i < draws; i++)
+            {
+                glBindTexture(GL_TEXTURE_2D, textures[i % count]);
+                glDrawArrays(GL_TRIANGLES, i * 6, 6);
+                binds++;
+            }
+        });
+        std::cout << count << " textures: own textures " << ownMs << "ms/frame (" << draws << " draw calls, " << binds / frames << " binds/frame)";
+
+        // One array, one draw
+        TextureArrayPool pool(count);
+        for (const Image& image : images)
+            pool.add(image);
+        pool.finish();
+        if (pool.count() == 1)
+        {
+            setTextures([&](int i) { return i % count; });
+            glUseProgram(arrayProgram);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, pool.array(0).texture);
+            double arrayMs = timeFrames(frames, [&] {
+                samplers.bind(0, sampling);
+                glDrawArrays(GL_TRIANGLES, 0, draws * 6);
+            });
+            glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+            std::cout << ", texture array " << arrayMs << "ms/frame (1 draw call, 1 bind)";
+        }
+        else
+            std::cout << ", texture array not possible";
+
+        // Handles, one draw, nothing bound
+        if (bindlessProgram)
+        {
+            GLuint sampler = samplers.get(sampling);
+            std::vector<GLuint64> handles;
+            for (const GLTexture& texture : textures)
+                handles.push_back(bindless.handle(texture, sampler));
+            setTextures([&](int i) { return handles[i % count]; });
+            glUseProgram(bindlessProgram);
+            double bindlessMs = timeFrames(frames, [&] {
+                glDrawArrays(GL_TRIANGLES, 0, draws * 6);
+            });
+            std::cout << ", bindless " << bindlessMs << "ms/frame (1 draw call, " << bindless.residentCount() << " resident handles)";
+            // Has to happen before the textures go
+            bindless.release();
+        }
+        else
+            std::cout << ", bindless not supported";
+        std::cout << std::endl;
+        pool.destroy();
+    }
+    std::cout << "Samplers: " << samplers.stats.created << " made, " << samplers.stats.binds << " binds, " << samplers.stats.skipped << " skipped as already bound" << std::endl;
+
+    samplers.destroy();
+    VBO.reset();
+    VAO.reset();
+    shaders.clear();
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Per object data through glUniform calls vs one uniform buffer bound with glBindBufferRange.
+//   bench_uniforms [--frames 200]
+// Draws the same grid of triangles both ways for a few object counts and prints the time per frame,
+// including glFinish so the driver's share of the work is counted too.
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "bench_common.h"
+#include "../src/program_reflection.h"
+#include "../src/shader_data.h"
+#include "../src/shader_preprocessor.h"
+#include "../src/uniform_buffer.h"
+
+static void fillObject(PerObject& object, int i, int count, float time)
+{
+    int side = (int)ceil(sqrt((double)count));
+    float cell = 2.0f / side;
+    int x = i % side;
+    int y = i / side;
+    object.objectOffset = { -1.0f + (x + 0.5f) * cell, -1.0f + (y + 0.5f) * cell, cell * (0.75f + 0.25f * sinf(time + i)), 0.0f };
+    object.objectColour = { (float)x / side, (float)y / side, 0.5f, 1.0f };
+}
+
+int main(int argc, char** argv)
+{
+    int frames = benchArgument(argc, argv, "--frames", 200);
+    GLFWwindow* window = createBenchContext(800, 600);
+    if (!window)
+        return 1;
+
+    ShaderPreprocessor preprocessor;
+    ShaderPermutations shaders(preprocessor, "./shaders/basic.vert", "./shaders/basic.frag", basicShaderFeatures);
+    ProgramReflection uniformProgram, blockProgram;
+    uniformProgram.build(shaders.get(BASIC_OBJECT_UNIFORMS));
+    blockProgram.build(shaders.get(BASIC_OBJECT_BLOCK));
+
+    float vertices[] = {
+        -0.5f, -0.5f, 0.0f,
+         0.5f, -0.5f, 0.0f,
+         0.0f,  0.5f, 0.0f,
+    };
+    GLuint VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glGenBuffers(1, &VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glEnableVertexAttribArray(0);
+
+    UniformBuffer<PerFrame> perFrame;
+    perFrame.create();
+    perFrame.data.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    for (int count : { 100, 1000, 10000 })
+    {
+        UniformArrayBuffer<PerObject> perObject;
+        perObject.create(count);
+        std::vector<PerObject> objects(count);
+
+        // glUniform per object
+        BenchTimer timer;
+        uniformStats = UniformStats();
+        uniformProgram.use(uniformProgram.program);
+        for (int frame = 0; frame < frames; frame++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+            for (int i = 0; i < count; i++)
+            {
+                fillObject(objects[i], i, count, (float)frame);
+                uniformProgram.set("objectOffset"_uniform, objects[i].objectOffset.x, objects[i].objectOffset.y, objects[i].objectOffset.z, objects[i].objectOffset.w);
+                uniformProgram.set("objectColour"_uniform, objects[i].objectColour.x, objects[i].objectColour.y, objects[i].objectColour.z, objects[i].objectColour.w);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            glFinish();
+        }
+        double uniformMs = timer.ms() / frames;
+        uint64_t uniformCalls = uniformStats.issued;
+
+        // One buffer write, a range bind per object
+        timer.reset();
+        blockProgram.use(blockProgram.program);
+        for (int frame = 0; frame < frames; frame++)
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+            perFrame.data.time = (float)frame;
+            perFrame.upload(PER_FRAME_BINDING);
+            for (int i = 0; i < count; i++)
+                fillObject(perObject[i], i, count, (float)frame);
+            perObject.upload(count);
+            for (int i = 0; i < count; i++)
+            {
+                perObject.bind(i, PER_OBJECT_BINDING);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            glFinish();
+        }
+        double blockMs = timer.ms() / frames;
+
+        std::cout << count << " objects: glUniform " << uniformMs << "ms/frame (" << uniformCalls / frames << " uploads/frame), "
+            << "uniform buffer " << blockMs << "ms/frame (1 upload/frame, " << perObject.stride * count / 1024 << "KiB)" << std::endl;
+        perObject.destroy();
+    }
+
+    perFrame.destroy();
+    glDeleteBuffers(1, &VBO);
+    glDeleteVertexArrays(1, &VAO);
+    shaders.clear();
+    glfwTerminate();
+    return 0;
+}
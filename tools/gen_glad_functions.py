@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Generates the extra tables glad.c uses for lazy loading and call tracing.
+
+    python3 tools/gen_glad_functions.py [path to GL/glcorearb.h] [path to GL/glext.h]
+
+Reads the function list from include/glad.c and the prototypes from the Khronos headers (the same
+ones glad itself is generated from), then writes:
+  include/glad/glad_functions.h     - one GLAD_FUNCTION/GLAD_VOID_FUNCTION line per entry point
+  include/glad/glad_function_hash.h - a perfect hash from function name to its index in that list
+
+Run it again whenever glad.c is regenerated.
+"""
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADERS = sys.argv[1:] or ["/usr/include/GL/glcorearb.h", "/usr/include/GL/glext.h"]
+
+
+def fnv1a(name, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode():
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def argument_name(param):
+    # The last identifier in "const void *const*indices" is the name
+    names = re.findall(r"[A-Za-z_][A-Za-z0-9_]*", param)
+    return names[-1]
+
+
+def main():
+    glad = open(os.path.join(ROOT, "include", "glad.c")).read()
+    functions = re.findall(r"^(PFN\w+) glad_(\w+) = NULL;", glad, re.M)
+
+    prototypes = {}
+    for header in HEADERS:
+        for ret, name, params in re.findall(r"^GLAPI (.+?)\s*APIENTRY (gl\w+) \((.*)\);", open(header).read(), re.M):
+            prototypes.setdefault(name, (ret.strip(), params.strip()))
+
+    lines = []
+    max_arguments = 0
+    for pfn, name in functions:
+        ret, params = prototypes[name]
+        args = [] if params == "void" else [argument_name(p) for p in params.split(",")]
+        max_arguments = max(max_arguments, len(args))
+        macro = "GLAD_VOID_FUNCTION" if ret == "void" else "GLAD_FUNCTION"
+        record = " ".join("GLAD_TRACE_ARG(%s)" % a for a in args)
+        lines.append("%s(%s, %s, %s, (%s), (%s), %s)" % (macro, ret, name, pfn, params, ", ".join(args), record))
+
+    with open(os.path.join(ROOT, "include", "glad", "glad_functions.h"), "w", newline="\n") as out:
+        out.write("/* Generated by tools/gen_glad_functions.py, don't edit by hand.\n\n")
+        out.write("   Every entry point glad.c knows about, in the same order. Define these before including:\n")
+        out.write("     GLAD_FUNCTION(return type, name, pointer type, (parameters), (arguments), record)\n")
+        out.write("     GLAD_VOID_FUNCTION(return type, name, pointer type, (parameters), (arguments), record)\n")
+        out.write("   where record is GLAD_TRACE_ARG(argument) for each argument, with no commas in between.\n")
+        out.write("   There's no include guard on purpose, it's meant to be included more than once. */\n")
+        for line in lines:
+            out.write(line + "\n")
+
+    # Hash and displace: keys are spread into buckets by one hash, then each bucket (biggest first)
+    # searches for a seed that puts all of its keys into free slots with a second hash
+    names = [name for _, name in functions]
+    count = len(names)
+    bucket_count = max(1, count // 4)
+    table_size = 1
+    while table_size < count * 1.25:
+        table_size *= 2
+    buckets = [[] for _ in range(bucket_count)]
+    for index, name in enumerate(names):
+        buckets[fnv1a(name, 0) % bucket_count].append(index)
+    displacements = [0] * bucket_count
+    slots = [0xFFFF] * table_size
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, 1 << 16):
+            wanted = [fnv1a(names[i], seed) & (table_size - 1) for i in buckets[bucket]]
+            if len(set(wanted)) == len(wanted) and all(slots[s] == 0xFFFF for s in wanted):
+                for i, s in zip(buckets[bucket], wanted):
+                    slots[s] = i
+                displacements[bucket] = seed
+                break
+        else:
+            sys.exit("couldn't find a perfect hash, try a bigger table")
+
+    def table(values):
+        rows = []
+        for i in range(0, len(values), 16):
+            rows.append("    " + ", ".join("%d" % v for v in values[i:i + 16]))
+        return ",\n".join(rows)
+
+    with open(os.path.join(ROOT, "include", "glad", "glad_function_hash.h"), "w", newline="\n") as out:
+        out.write("/* Generated by tools/gen_glad_functions.py, don't edit by hand.\n\n")
+        out.write("   Perfect hash from a function name to its index in glad_functions.h:\n")
+        out.write("     seed  = GLAD_HASH_DISPLACEMENTS[fnv1a(name, 0) % GLAD_HASH_BUCKETS]\n")
+        out.write("     index = GLAD_HASH_SLOTS[fnv1a(name, seed) & (GLAD_HASH_SIZE - 1)]\n")
+        out.write("   then compare the name, since names that aren't in the list land somewhere too. */\n")
+        out.write("#define GLAD_FUNCTION_COUNT %d\n" % count)
+        out.write("#define GLAD_MAX_ARGUMENTS %d\n" % max_arguments)
+        out.write("#define GLAD_HASH_BUCKETS %d\n" % bucket_count)
+        out.write("#define GLAD_HASH_SIZE %d\n\n" % table_size)
+        out.write("static const unsigned short GLAD_HASH_DISPLACEMENTS[GLAD_HASH_BUCKETS] = {\n%s\n};\n\n" % table(displacements))
+        out.write("static const unsigned short GLAD_HASH_SLOTS[GLAD_HASH_SIZE] = {\n%s\n};\n" % table(slots))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,248 @@
+// Plays back a capture written by a GLAD_TRACE build of the app, for regression benchmarking.
+//   gl_replay capture.bin [--width 800] [--height 600]
+// Every recorded call is made again in a hidden window, frame by frame, and the time each frame
+// took (with glFinish, so the GPU's share is counted) is printed at the end.
+//
+// The capture only has argument values, plus copies of the data for the calls glad.c knows how to
+// save (buffer data, shader source, uniform arrays, texture pixels). So:
+//  - Pointers that aren't saved data get swapped for zeroed scratch memory, which also catches the
+//    output of calls like glGenBuffers. Small values are left alone, since they're offsets into
+//    bound buffers (glVertexAttribPointer, glDrawElements) rather than real pointers.
+//  - Object names aren't remapped. A fresh context hands out names in the same order as the
+//    recorded one did, as long as the capture starts from the first frame.
+//  - Syncs are pointers the driver makes up, so they are remapped. glFenceSync's result is in the
+//    capture, and later calls given that sync get the one the replayed glFenceSync returned. Calls
+//    on a sync the capture never saw made (from before the result was recorded, or a fence made
+//    before the capture started) are skipped.
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "bench_common.h"
+
+static std::vector<uint8_t> scratch(16 * 1024 * 1024);
+
+// Turns a recorded 64 bit slot back into the parameter's type
+template <typename T>
+static T fromSlot(uint64_t slot, bool isData)
+{
+    // Syncs have already been swapped for the replay's own
+    if constexpr (std::is_pointer<T>::value && !std::is_same<T, GLsync>::value)
+    {
+        if (!isData && slot >= 65536)
+            return reinterpret_cast<T>(scratch.data());
+    }
+    T value;
+    memcpy(&value, &slot, sizeof(T));
+    return value;
+}
+
+template <typename Ret, typename... Args, size_t... I>
+static void invoke(Ret (APIENTRYP function)(Args...), const uint64_t* args, int dataArg, std::index_sequence<I...>)
+{
+    function(fromSlot<Args>(args[I], (int)I == dataArg)...);
+}
+
+template <typename Ret, typename... Args>
+static void invoke(Ret (APIENTRYP function)(Args...), const uint64_t* args, int dataArg)
+{
+    if (function)
+        invoke(function, args, dataArg, std::index_sequence_for<Args...>());
+}
+
+typedef void (*ReplayFunction)(const uint64_t* args, int dataArg);
+
+// Every function glad knows, by name. The capture has its own list of names, so it still plays back
+// if glad gets regenerated and the order changes.
+static std::unordered_map<std::string, ReplayFunction> replayFunctions()
+{
+    return {
+#define GLAD_FUNCTION(ret, name, pfn, params, args, record) { #name, [](const uint64_t* a, int dataArg) { invoke(glad_##name, a, dataArg); } },
+#define GLAD_VOID_FUNCTION GLAD_FUNCTION
+#include <glad/glad_functions.h>
+#undef GLAD_FUNCTION
+#undef GLAD_VOID_FUNCTION
+    };
+}
+
+struct ReplayCall
+{
+    uint16_t function;
+    // Zeroed past what was recorded, so a missing glFenceSync result reads as none
+    uint64_t args[16] = {};
+    uint8_t dataArg;
+    std::vector<uint8_t> data;
+};
+
+template <typename T>
+static bool readValue(std::ifstream& in, T& value)
+{
+    return (bool)in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+static bool loadCapture(const char* path, std::vector<std::string>& names, std::vector<std::vector<ReplayCall>>& frames)
+{
+    std::ifstream in(path, std::ios::binary);
+    char magic[8];
+    uint32_t functionCount = 0;
+    if (!in.read(magic, 8) || memcmp(magic, "GLTRACE1", 8) != 0 || !readValue(in, functionCount))
+    {
+        std::cerr << path << " isn't a trace capture" << std::endl;
+        return false;
+    }
+    for (uint32_t i = 0; i < functionCount; i++)
+    {
+        uint16_t length = 0;
+        readValue(in, length);
+        std::string name(length, '\0');
+        in.read(&name[0], length);
+        names.push_back(name);
+    }
+
+    frames.emplace_back();
+    char kind;
+    while (in.get(kind))
+    {
+        if (kind == 'F')
+        {
+            frames.emplace_back();
+            continue;
+        }
+        ReplayCall call;
+        uint8_t argc = 0;
+        uint32_t cpuNs = 0, dataSize = 0;
+        if (kind != 'C' || !readValue(in, call.function) || !readValue(in, argc) || !readValue(in, cpuNs) || argc > 16 || call.function >= names.size())
+        {
+            std::cerr << path << " is damaged, stopping after " << frames.size() - 1 << " frames" << std::endl;
+            break;
+        }
+        in.read(reinterpret_cast<char*>(call.args), argc * sizeof(uint64_t));
+        readValue(in, call.dataArg);
+        readValue(in, dataSize);
+        call.data.resize(dataSize);
+        in.read(reinterpret_cast<char*>(call.data.data()), dataSize);
+        frames.back().push_back(std::move(call));
+    }
+    // Calls after the last frame marker didn't make it to the screen
+    frames.pop_back();
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: gl_replay capture.bin [--width 800] [--height 600]" << std::endl;
+        return 1;
+    }
+    std::vector<std::string> names;
+    std::vector<std::vector<ReplayCall>> frames;
+    if (!loadCapture(argv[1], names, frames))
+        return 1;
+
+    GLFWwindow* window = createBenchContext(benchArgument(argc, argv, "--width", 800), benchArgument(argc, argv, "--height", 600));
+    if (!window)
+        return 1;
+
+    std::unordered_map<std::string, ReplayFunction> known = replayFunctions();
+    std::vector<ReplayFunction> functions;
+    for (const std::string& name : names)
+    {
+        auto it = known.find(name);
+        if (it == known.end())
+            std::cerr << name << " is in the capture but not in this build of glad, skipping it" << std::endl;
+        functions.push_back(it == known.end() ? nullptr : it->second);
+    }
+    uint16_t shaderSource = 0xFFFF, fenceSync = 0xFFFF, deleteSync = 0xFFFF;
+    // The calls whose first argument is a sync
+    std::vector<bool> takesSync(names.size(), false);
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == "glShaderSource")
+            shaderSource = (uint16_t)i;
+        else if (names[i] == "glFenceSync")
+            fenceSync = (uint16_t)i;
+        else if (names[i] == "glDeleteSync")
+            deleteSync = (uint16_t)i;
+        takesSync[i] = names[i] == "glClientWaitSync" || names[i] == "glWaitSync" || names[i] == "glDeleteSync"
+            || names[i] == "glGetSynciv" || names[i] == "glIsSync";
+    }
+    // Recorded sync to the replay's
+    std::unordered_map<uint64_t, GLsync> syncs;
+    size_t skippedSyncCalls = 0;
+
+    std::vector<double> frameMs;
+    size_t calls = 0;
+    for (std::vector<ReplayCall>& frame : frames)
+    {
+        BenchTimer timer;
+        for (ReplayCall& call : frame)
+        {
+            ReplayFunction function = functions[call.function];
+            if (!function)
+                continue;
+            int dataArg = call.data.empty() ? -1 : call.dataArg;
+            const char* source = reinterpret_cast<const char*>(call.data.data());
+            if (dataArg >= 0)
+                call.args[dataArg] = (uint64_t)(uintptr_t)call.data.data();
+            // The capture has glShaderSource's strings joined into one
+            if (call.function == shaderSource && dataArg >= 0)
+            {
+                call.args[1] = 1;
+                call.args[2] = (uint64_t)(uintptr_t)&source;
+                call.args[3] = 0;
+            }
+            if (call.function == fenceSync)
+            {
+                GLsync sync = glFenceSync((GLenum)call.args[0], (GLbitfield)call.args[1]);
+                if (call.args[2])
+                    syncs[call.args[2]] = sync;
+                else
+                    glDeleteSync(sync);
+                calls++;
+                continue;
+            }
+            if (takesSync[call.function])
+            {
+                auto sync = syncs.find(call.args[0]);
+                if (sync == syncs.end())
+                {
+                    skippedSyncCalls++;
+                    continue;
+                }
+                call.args[0] = (uint64_t)(uintptr_t)sync->second;
+                if (call.function == deleteSync)
+                    syncs.erase(sync);
+            }
+            function(call.args, dataArg);
+            calls++;
+        }
+        glFinish();
+        frameMs.push_back(timer.ms());
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+
+    double total = 0, slowest = 0;
+    // The first frame includes all the setup, so it's left out of the average
+    for (size_t i = 1; i < frameMs.size(); i++)
+    {
+        total += frameMs[i];
+        slowest = frameMs[i] > slowest ? frameMs[i] : slowest;
+    }
+    std::cout << "Replayed " << frames.size() << " frames, " << calls << " calls" << std::endl;
+    if (skippedSyncCalls)
+        std::cout << "Skipped " << skippedSyncCalls << " calls on syncs the capture doesn't say were made" << std::endl;
+    if (!frameMs.empty())
+        std::cout << "First frame (setup): " << frameMs[0] << "ms" << std::endl;
+    if (frameMs.size() > 1)
+        std::cout << "Other frames: " << total / (frameMs.size() - 1) << "ms average, " << slowest << "ms slowest" << std::endl;
+
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,41 @@
+// Golden images for the app's --golden checks, drawn with the software rasteriser rather than GL.
+//   golden_reference [folder, default ./golden]
+// Only the demos the software rasteriser can draw exactly like GL are done here (the RGB triangle
+// and the hello rectangle), the rest come from running the app with --golden --update on a machine
+// whose pictures are known to be right. Doesn't need a GL context.
+#include <iostream>
+#include <string>
+#include "../src/demo_geometry.h"
+#include "../src/png.h"
+#include "../src/software_rasteriser.h"
+
+// Has to match GOLDEN_SIZES in main.cpp
+static const int SIZES[][2] = { { 320, 240 }, { 800, 600 } };
+
+int main(int argc, char** argv)
+{
+    std::string folder = argc > 1 ? argv[1] : "./golden";
+    SoftwareRasteriser rasteriser;
+    int written = 0;
+    for (const int* size : SIZES)
+    {
+        int width = size[0], height = size[1];
+        std::string suffix = "_" + std::to_string(width) + "x" + std::to_string(height) + ".png";
+        rasteriser.resize(width, height);
+        Image image;
+        image.width = width;
+        image.height = height;
+
+        rasteriser.clear({ 0.0f, 0.0f, 0.0f, 1.0f });
+        rasteriser.drawInterleaved(RGB_TRIANGLE_VERTICES, 3, RGB_TRIANGLE_FLOATS_PER_VERTEX, RGB_TRIANGLE_COLOUR_OFFSET, CONSTANT_ORANGE);
+        rasteriser.readColour(image.rgba);
+        written += writePng(folder + "/RGBTriangle" + suffix, image);
+
+        rasteriser.clear({ 0.0f, 0.0f, 0.0f, 1.0f });
+        rasteriser.drawInterleaved(HELLO_RECTANGLE_VERTICES, 4, 3, -1, CONSTANT_ORANGE, HELLO_RECTANGLE_INDICES, 6);
+        rasteriser.readColour(image.rgba);
+        written += writePng(folder + "/HelloRectangle" + suffix, image);
+    }
+    std::cout << "Wrote " << written << " golden images to " << folder << std::endl;
+    return written == 4 ? 0 : 1;
+}
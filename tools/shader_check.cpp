@@ -0,0 +1,477 @@
+// Offline checks for everything in res/shaders, so mistakes show up before the app runs.
+//
+// Run it from res/ like the app (or pass the shader folder):
+//   shader_check [./shaders]
+//
+// For every program in programs.txt it:
+//  - preprocesses both stages the same way the app does (#include + feature defines)
+//  - checks every fragment shader "in" has a vertex shader "out" with the same name and type
+//  - checks attribute locations don't clash
+//  - checks uniforms declared in both stages agree on the type, and warns about ones that are
+//    never used (the driver throws those away, so glGetUniformLocation gives -1)
+// then writes reflection.txt next to programs.txt, so a review can see what changed in each interface.
+// It exits with 1 if there were any errors.
+//
+// This isn't a GLSL compiler, it only understands declarations at global scope and the
+// #ifdef/#ifndef/#if defined()/#elif/#else/#endif the feature defines use.
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/shader_manifest.h"
+#include "../src/shader_preprocessor.h"
+
+struct Declaration
+{
+    std::string storage; // in, out or uniform
+    ShaderVariable variable;
+    bool hasLocation = false;
+};
+
+struct Stage
+{
+    std::string path;
+    std::vector<Declaration> declarations;
+    std::string code; // Everything after preprocessing, with the comments gone
+};
+
+static int errors = 0;
+static int warnings = 0;
+
+static void error(const std::string& where, const std::string& message)
+{
+    std::cerr << where << ": error: " << message << std::endl;
+    errors++;
+}
+
+static void warning(const std::string& where, const std::string& message)
+{
+    std::cerr << where << ": warning: " << message << std::endl;
+    warnings++;
+}
+
+static std::string trim(const std::string& text)
+{
+    size_t first = text.find_first_not_of(" \t\r\n");
+    size_t last = text.find_last_not_of(" \t\r\n");
+    return first == std::string::npos ? "" : text.substr(first, last - first + 1);
+}
+
+static std::string stripComments(const std::string& source)
+{
+    std::string out;
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (source.compare(i, 2, "//") == 0)
+        {
+            while (i < source.size() && source[i] != '\n')
+                i++;
+            out += '\n';
+        }
+        else if (source.compare(i, 2, "/*") == 0)
+        {
+            size_t end = source.find("*/", i + 2);
+            i = end == std::string::npos ? source.size() : end + 1;
+            out += ' ';
+        }
+        else
+        {
+            out += source[i];
+        }
+    }
+    return out;
+}
+
+// Evaluates "defined(A) || !defined(B) && ..." with the usual precedence. Good enough for feature switches.
+static bool evaluateCondition(const std::string& expression, const std::set<std::string>& defined)
+{
+    // Split on || first so && binds tighter
+    size_t pos = 0;
+    bool any = false;
+    while (pos <= expression.size())
+    {
+        size_t next = expression.find("||", pos);
+        std::string term = expression.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
+        bool all = true;
+        size_t termPos = 0;
+        while (termPos <= term.size())
+        {
+            size_t andPos = term.find("&&", termPos);
+            std::string factor = trim(term.substr(termPos, andPos == std::string::npos ? std::string::npos : andPos - termPos));
+            bool negate = false;
+            while (!factor.empty() && factor[0] == '!')
+            {
+                negate = !negate;
+                factor = trim(factor.substr(1));
+            }
+            bool value;
+            if (factor.compare(0, 7, "defined") == 0)
+            {
+                std::string name = factor.substr(7);
+                name.erase(std::remove_if(name.begin(), name.end(), [](char c) { return c == '(' || c == ')' || isspace((unsigned char)c); }), name.end());
+                value = defined.count(name) != 0;
+            }
+            else
+            {
+                value = factor != "0" && !factor.empty();
+            }
+            all = all && (value != negate);
+            if (andPos == std::string::npos)
+                break;
+            termPos = andPos + 2;
+        }
+        any = any || all;
+        if (next == std::string::npos)
+            break;
+        pos = next + 2;
+    }
+    return any;
+}
+
+// Runs the conditional directives, leaving only the lines that are active
+static std::string evaluateDirectives(const std::string& source, const std::string& where)
+{
+    struct Branch
+    {
+        bool parentActive;
+        bool active;
+        bool taken;
+    };
+    std::vector<Branch> stack;
+    std::set<std::string> defined;
+    std::istringstream lines(source);
+    std::string line;
+    std::string out;
+    bool active = true;
+    while (std::getline(lines, line))
+    {
+        std::string trimmed = trim(line);
+        if (trimmed.empty() || trimmed[0] != '#')
+        {
+            out += active ? line + "\n" : "\n";
+            continue;
+        }
+        std::istringstream words(trimmed.substr(1));
+        std::string directive;
+        words >> directive;
+        std::string rest;
+        std::getline(words, rest);
+        rest = trim(rest);
+
+        if (directive == "ifdef" || directive == "ifndef" || directive == "if")
+        {
+            bool condition = directive == "if" ? evaluateCondition(rest, defined) : (defined.count(rest) != 0) == (directive == "ifdef");
+            stack.push_back({ active, active && condition, condition });
+            active = stack.back().active;
+        }
+        else if (directive == "elif" || directive == "else")
+        {
+            if (stack.empty())
+            {
+                error(where, "#" + directive + " without #if");
+                continue;
+            }
+            Branch& branch = stack.back();
+            bool condition = directive == "else" || evaluateCondition(rest, defined);
+            branch.active = branch.parentActive && !branch.taken && condition;
+            branch.taken = branch.taken || condition;
+            active = branch.active;
+        }
+        else if (directive == "endif")
+        {
+            if (stack.empty())
+            {
+                error(where, "#endif without #if");
+                continue;
+            }
+            active = stack.back().parentActive;
+            stack.pop_back();
+        }
+        else if (active && directive == "define")
+        {
+            std::istringstream define(rest);
+            std::string name;
+            define >> name;
+            defined.insert(name);
+        }
+        else if (active && directive == "undef")
+        {
+            defined.erase(rest);
+        }
+        out += "\n";
+    }
+    if (!stack.empty())
+        error(where, "missing #endif");
+    return out;
+}
+
+static size_t countWord(const std::string& text, const std::string& word)
+{
+    size_t count = 0;
+    for (size_t at = text.find(word); at != std::string::npos; at = text.find(word, at + 1))
+    {
+        bool startOk = at == 0 || !(isalnum((unsigned char)text[at - 1]) || text[at - 1] == '_');
+        size_t end = at + word.size();
+        bool endOk = end >= text.size() || !(isalnum((unsigned char)text[end]) || text[end] == '_');
+        if (startOk && endOk)
+            count++;
+    }
+    return count;
+}
+
+// Picks the global in/out/uniform declarations out of the source
+static void parseDeclarations(Stage& stage)
+{
+    int depth = 0;
+    std::string statement;
+    for (char c : stage.code)
+    {
+        if (c == '{')
+            depth++;
+        else if (c == '}')
+        {
+            depth--;
+            // A function body ends without a ';', so forget what came before it
+            if (depth == 0)
+                statement.clear();
+            continue;
+        }
+        if (depth > 0)
+            continue;
+        if (c != ';')
+        {
+            statement += c;
+            continue;
+        }
+
+        std::string text = trim(statement);
+        statement.clear();
+        Declaration declaration;
+        size_t layout = text.find("layout");
+        if (layout == 0)
+        {
+            size_t close = text.find(')');
+            std::string qualifiers = text.substr(text.find('(') + 1, close - text.find('(') - 1);
+            size_t location = qualifiers.find("location");
+            if (location != std::string::npos)
+            {
+                declaration.hasLocation = true;
+                declaration.variable.location = atoi(qualifiers.c_str() + qualifiers.find('=', location) + 1);
+            }
+            text = trim(text.substr(close + 1));
+        }
+
+        std::istringstream words(text);
+        std::string word;
+        while (words >> word)
+        {
+            static const std::set<std::string> ignored = { "flat", "smooth", "noperspective", "centroid", "highp", "mediump", "lowp" };
+            if (ignored.count(word))
+                continue;
+            if (word == "in" || word == "out" || word == "uniform")
+            {
+                declaration.storage = word;
+                continue;
+            }
+            break;
+        }
+        if (declaration.storage.empty())
+            continue;
+        declaration.variable.type = word;
+        std::string name;
+        words >> name;
+        size_t bracket = name.find('[');
+        if (bracket != std::string::npos)
+        {
+            declaration.variable.arraySize = atoi(name.c_str() + bracket + 1);
+            name = name.substr(0, bracket);
+        }
+        declaration.variable.name = name;
+        stage.declarations.push_back(declaration);
+    }
+}
+
+static bool loadStage(ShaderPreprocessor& preprocessor, Stage& stage, const std::vector<std::string>& defines)
+{
+    PreprocessedShader shader = preprocessor.preprocess(stage.path, defines);
+    if (shader.source.empty())
+    {
+        error(stage.path, "empty or missing");
+        return false;
+    }
+    if (shader.source.compare(0, 8, "#version") != 0)
+        error(stage.path, "#version has to be the very first thing in the file");
+    stage.code = evaluateDirectives(stripComments(shader.source), stage.path);
+    parseDeclarations(stage);
+    return true;
+}
+
+static ShaderProgramInfo checkProgram(const std::string& name, Stage& vertex, Stage& fragment)
+{
+    ShaderProgramInfo info;
+    std::string where = name + " (" + vertex.path + " + " + fragment.path + ")";
+
+    // Attributes
+    std::map<int, std::string> locations;
+    for (const Declaration& declaration : vertex.declarations)
+    {
+        if (declaration.storage != "in")
+            continue;
+        if (!declaration.hasLocation)
+            warning(where, "attribute " + declaration.variable.name + " has no layout(location), the driver will pick one");
+        else if (locations.count(declaration.variable.location))
+            error(where, "attributes " + locations[declaration.variable.location] + " and " + declaration.variable.name + " both use location " + std::to_string(declaration.variable.location));
+        else
+            locations[declaration.variable.location] = declaration.variable.name;
+        info.attributes.push_back(declaration.variable);
+    }
+
+    // Vertex out -> fragment in
+    for (const Declaration& input : fragment.declarations)
+    {
+        if (input.storage != "in")
+            continue;
+        const Declaration* output = nullptr;
+        for (const Declaration& declaration : vertex.declarations)
+            if (declaration.storage == "out" && declaration.variable.name == input.variable.name)
+                output = &declaration;
+        if (!output)
+            error(where, "fragment shader reads " + input.variable.name + " but the vertex shader never writes it");
+        else if (output->variable.type != input.variable.type)
+            error(where, input.variable.name + " is " + output->variable.type + " in the vertex shader but " + input.variable.type + " in the fragment shader");
+        else
+            info.varyings.push_back(input.variable);
+    }
+    for (const Declaration& output : vertex.declarations)
+    {
+        if (output.storage != "out")
+            continue;
+        bool read = false;
+        for (const Declaration& input : fragment.declarations)
+            read |= input.storage == "in" && input.variable.name == output.variable.name;
+        if (!read && countWord(vertex.code, output.variable.name) > 1)
+            warning(where, "vertex shader writes " + output.variable.name + " but the fragment shader doesn't read it");
+    }
+
+    // Uniforms, merged across both stages. Declaring one in a stage that doesn't use it is fine
+    // as long as the other stage does.
+    std::set<std::string> usedUniforms;
+    for (Stage* stage : { &vertex, &fragment })
+        for (const Declaration& declaration : stage->declarations)
+            if (declaration.storage == "uniform" && countWord(stage->code, declaration.variable.name) > 1)
+                usedUniforms.insert(declaration.variable.name);
+    for (Stage* stage : { &vertex, &fragment })
+    {
+        for (const Declaration& declaration : stage->declarations)
+        {
+            if (declaration.storage != "uniform")
+                continue;
+            if (!usedUniforms.count(declaration.variable.name))
+            {
+                warning(where, "uniform " + declaration.variable.name + " is never used, it won't have a location");
+                continue;
+            }
+            ShaderVariable* existing = nullptr;
+            for (ShaderVariable& uniform : info.uniforms)
+                if (uniform.name == declaration.variable.name)
+                    existing = &uniform;
+            if (!existing)
+                info.uniforms.push_back(declaration.variable);
+            else if (existing->type != declaration.variable.type || existing->arraySize != declaration.variable.arraySize)
+                error(where, "uniform " + declaration.variable.name + " has different types in each stage, it won't link");
+        }
+    }
+    return info;
+}
+
+int main(int argc, char** argv)
+{
+    std::string directory = argc > 1 ? argv[1] : "./shaders";
+    if (directory.back() != '/')
+        directory += '/';
+
+    std::ifstream list(directory + "programs.txt");
+    if (!list)
+    {
+        std::cerr << "Can't open " << directory << "programs.txt" << std::endl;
+        return 1;
+    }
+
+    ShaderPreprocessor preprocessor;
+    ShaderManifest manifest;
+    std::set<std::string> used;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(list, line))
+    {
+        lineNumber++;
+        std::istringstream words(line);
+        std::string kind, name, vertexFile, fragmentFile, define;
+        if (!(words >> kind) || kind[0] == '#')
+            continue;
+        if ((kind != "program" && kind != "permutations") || !(words >> name >> vertexFile >> fragmentFile))
+        {
+            error("programs.txt:" + std::to_string(lineNumber), "expected program/permutations <name> <vertex> <fragment> ...");
+            continue;
+        }
+        // Permutations can be limited to the masks that are actually used, after "only"
+        std::vector<std::string> defines;
+        std::set<uint32_t> only;
+        while (words >> define && define != "only")
+            defines.push_back(define);
+        if (define == "only")
+        {
+            uint32_t mask;
+            while (words >> mask)
+                only.insert(mask);
+        }
+        used.insert(vertexFile);
+        used.insert(fragmentFile);
+
+        // A plain program is just the one combination with every define on
+        uint32_t masks = kind == "permutations" ? 1u << defines.size() : 1;
+        for (uint32_t mask = 0; mask < masks; mask++)
+        {
+            if (!only.empty() && !only.count(mask))
+                continue;
+            std::vector<std::string> enabled;
+            for (size_t i = 0; i < defines.size(); i++)
+                if (kind == "program" || (mask & (1u << i)))
+                    enabled.push_back(defines[i]);
+
+            std::string programName = kind == "permutations" ? name + "/" + std::to_string(mask) : name;
+            Stage vertex, fragment;
+            vertex.path = directory + vertexFile;
+            fragment.path = directory + fragmentFile;
+            if (!loadStage(preprocessor, vertex, enabled) || !loadStage(preprocessor, fragment, enabled))
+                continue;
+            manifest.programs[programName] = checkProgram(programName, vertex, fragment);
+        }
+    }
+
+    // Anything that isn't part of a program still gets parsed, so at least broken directives get noticed
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(directory, error))
+    {
+        std::string extension = file.path().extension().string();
+        std::string fileName = file.path().filename().string();
+        if ((extension != ".vert" && extension != ".frag") || used.count(fileName))
+            continue;
+        warning(directory + fileName, "not used by any program in programs.txt");
+        Stage stage;
+        stage.path = directory + fileName;
+        loadStage(preprocessor, stage, {});
+    }
+
+    if (!manifest.save((directory + "reflection.txt").c_str()))
+        return 1;
+    std::cout << manifest.programs.size() << " programs checked, " << errors << " errors, " << warnings << " warnings" << std::endl;
+    return errors ? 1 : 0;
+}
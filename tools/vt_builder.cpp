@@ -0,0 +1,227 @@
+// Tiles a big image into a page file for VirtualTexture (src/virtual_texture.h), then plays a
+// camera zooming and panning over it to see how the tile cache copes with a few memory budgets.
+//   vt_builder [image, or none for a made up one] [output, default ./virtual.vtex] [--tile 128]
+//              [--size 8192] [--frames 1200] [--uploads 8] [--latency 2]
+// --size is how big the made up image is. Each frame works out which tiles the view needs, the
+// way the feedback pass would but --latency frames late, and loads up to --uploads of the missing
+// ones (copied out of the mapped page file) into the least recently used slots. Prints the hit
+// rate, how much was read and how fast, and how often the view wanted more than the budget holds.
+// Doesn't need a GL context.
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "bench_common.h"
+#include "../src/jpeg.h"
+#include "../src/virtual_texture.h"
+
+// Coloured cells with lines in that get finer, so every level has something in it
+static Image makeImage(int size)
+{
+    Image image;
+    image.width = image.height = size;
+    image.rgba.resize((size_t)size * size * 4);
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            uint32_t cell = (uint32_t)(x / 256) * 7919u + (uint32_t)(y / 256) * 104729u;
+            cell ^= cell >> 7;
+            cell *= 0x9E3779B1u;
+            uint8_t* pixel = image.pixel(x, y);
+            bool line = x % 64 == 0 || y % 64 == 0 || x % 16 == 0 || y % 16 == 0;
+            for (int c = 0; c < 3; c++)
+                pixel[c] = (uint8_t)((64 + (cell >> (8 + c * 8)) % 160) >> (line ? 1 : 0));
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+// Where the camera is on a frame, in virtual texture coordinates, the same path as the demo
+struct View
+{
+    float centreX, centreY, halfWidth, halfHeight;
+};
+
+static View viewAt(int frame, float aspect)
+{
+    float time = frame / 60.0f;
+    float zoom = 0.5f - 0.5f * cosf(time * 0.4f);
+    View view;
+    view.halfWidth = 0.5f * exp2f(-5.0f * zoom);
+    view.halfHeight = view.halfWidth / aspect;
+    view.centreX = 0.5f + 0.3f * zoom * cosf(time * 0.23f);
+    view.centreY = 0.5f + 0.3f * zoom * sinf(time * 0.31f);
+    return view;
+}
+
+struct SimulationResult
+{
+    size_t slots = 0;
+    size_t residentBytes = 0;
+    uint64_t requested = 0;
+    uint64_t hits = 0;
+    uint64_t uploads = 0;
+    uint64_t uploadedBytes = 0;
+    uint64_t evictions = 0;
+    uint64_t overBudget = 0;
+    // Frames where the view needed more tiles than there are slots
+    int framesOverBudget = 0;
+    size_t mostWanted = 0;
+    double copyMs = 0.0;
+};
+
+static SimulationResult simulate(const VirtualTextureFile& file, size_t budget, int frames, int width, int height, int uploadsPerFrame, int latency)
+{
+    const VirtualTextureHeader& header = file.header;
+    SimulationResult result;
+    size_t indirectionBytes = 0;
+    for (uint32_t level = 0; level < header.levels; level++)
+        indirectionBytes += (size_t)header.tilesAcross(level) * header.tilesAcross(level) * 4;
+    // The same sizing as VirtualTexture::create, less the driver's texture size limit
+    size_t slotsAcross = 1;
+    while (slotsAcross < VirtualTexture::MAX_SLOTS_ACROSS && indirectionBytes + (slotsAcross + 1) * (slotsAcross + 1) * header.tileBytes() <= budget)
+        slotsAcross++;
+    if (slotsAcross < 2)
+        return result;
+    result.slots = slotsAcross * slotsAcross;
+    result.residentBytes = indirectionBytes + result.slots * header.tileBytes();
+
+    TileCache cache;
+    cache.reset((uint32_t)result.slots, header.tileCount());
+    uint32_t evicted;
+    uint32_t top = header.tileIndex(header.levels - 1, 0, 0);
+    cache.pin(cache.take(top, 0, evicted));
+    std::vector<uint64_t> wantedIn(header.tileCount(), 0);
+    std::vector<uint32_t> missing;
+    std::vector<uint8_t> staging(header.tileBytes());
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        uint64_t stamp = (uint64_t)frame + 1;
+        // What the feedback would be saying now, from a few frames ago
+        View view = viewAt(std::max(0, frame - latency), (float)width / height);
+        float texelsPerPixel = view.halfWidth * 2.0f * header.size / width;
+        uint32_t level = (uint32_t)std::min(std::max(floorf(log2f(texelsPerPixel)), 0.0f), (float)header.levels - 1);
+        float across = (float)header.tilesAcross(level);
+        auto tileRange = [&](float centre, float half, uint32_t& first, uint32_t& last) {
+            first = (uint32_t)std::max(0.0f, floorf((centre - half) * across));
+            last = (uint32_t)std::min(across - 1.0f, floorf((centre + half) * across));
+        };
+        uint32_t firstX, lastX, firstY, lastY;
+        tileRange(view.centreX, view.halfWidth, firstX, lastX);
+        tileRange(view.centreY, view.halfHeight, firstY, lastY);
+
+        missing.clear();
+        size_t wanted = 0;
+        for (uint32_t y = firstY; y <= lastY; y++)
+        {
+            for (uint32_t x = firstX; x <= lastX; x++)
+            {
+                uint32_t tile = header.tileIndex(level, x, y);
+                wanted++;
+                result.requested++;
+                uint32_t slot = cache.find(tile);
+                if (slot != TileCache::NONE)
+                {
+                    result.hits++;
+                    cache.markUsed(slot, stamp);
+                    continue;
+                }
+                // Its coarser levels first, as processFeedback queues them
+                uint32_t chain[32];
+                int length = 0;
+                uint32_t ancestorX = x, ancestorY = y;
+                for (uint32_t l = level; l < header.levels; l++, ancestorX /= 2, ancestorY /= 2)
+                {
+                    uint32_t ancestor = header.tileIndex(l, ancestorX, ancestorY);
+                    uint32_t ancestorSlot = cache.find(ancestor);
+                    if (ancestorSlot != TileCache::NONE)
+                    {
+                        cache.markUsed(ancestorSlot, stamp);
+                        break;
+                    }
+                    if (wantedIn[ancestor] != stamp)
+                        chain[length++] = ancestor;
+                    wantedIn[ancestor] = stamp;
+                }
+                while (length > 0)
+                    missing.push_back(chain[--length]);
+            }
+        }
+        result.mostWanted = std::max(result.mostWanted, wanted);
+        if (wanted + 1 > result.slots)
+            result.framesOverBudget++;
+
+        for (size_t i = 0; i < missing.size() && i < (size_t)uploadsPerFrame; i++)
+        {
+            uint32_t slot = cache.take(missing[i], stamp, evicted);
+            if (slot == TileCache::NONE)
+            {
+                result.overBudget++;
+                continue;
+            }
+            if (evicted != TileCache::NONE)
+                result.evictions++;
+            BenchTimer timer;
+            memcpy(staging.data(), file.tile(missing[i]), staging.size());
+            result.copyMs += timer.ms();
+            result.uploads++;
+            result.uploadedBytes += staging.size();
+        }
+    }
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    std::string input = argc > 1 && argv[1][0] != '-' ? argv[1] : "";
+    std::string output = argc > 2 && argv[2][0] != '-' ? argv[2] : "./virtual.vtex";
+    int tileSize = benchArgument(argc, argv, "--tile", 128);
+    int size = benchArgument(argc, argv, "--size", 8192);
+    int frames = benchArgument(argc, argv, "--frames", 1200);
+    int uploadsPerFrame = benchArgument(argc, argv, "--uploads", 8);
+    int latency = benchArgument(argc, argv, "--latency", 2);
+    const int width = 1280, height = 720;
+
+    Image image;
+    if (input.empty())
+        image = makeImage(size);
+    else if (!readImage(input, image))
+        return 1;
+
+    BenchTimer timer;
+    VirtualTextureHeader header;
+    if (!writeVirtualTexture(output, image, header, (uint32_t)tileSize))
+        return 1;
+    double writeMs = timer.ms();
+    VirtualTextureFile file;
+    if (!file.open(output))
+        return 1;
+    std::cout << (input.empty() ? "Made up image" : input) << ", " << image.width << "x" << image.height << ": " << header.levels << " levels of "
+        << tileSize << " texel tiles, " << header.tileCount() << " tiles, " << file.bytes / (1024.0 * 1024.0) << "MB written to " << output
+        << " in " << writeMs << "ms" << std::endl;
+
+    double fullMB = header.tileCount() * header.tileBytes() / (1024.0 * 1024.0);
+    std::cout << frames << " frames at " << width << "x" << height << ", up to " << uploadsPerFrame << " tiles loaded a frame, feedback "
+        << latency << " frames late" << std::endl;
+    for (size_t budgetMB : { 4, 16, 64 })
+    {
+        SimulationResult result = simulate(file, budgetMB * 1024 * 1024, frames, width, height, uploadsPerFrame, latency);
+        if (!result.slots)
+        {
+            std::cout << budgetMB << "MB budget: too small for one tile" << std::endl;
+            continue;
+        }
+        double uploadedMB = result.uploadedBytes / (1024.0 * 1024.0);
+        std::cout << budgetMB << "MB budget (" << result.residentBytes / (1024.0 * 1024.0) << "MB used, " << result.residentBytes / (1024.0 * 1024.0) / fullMB * 100.0
+            << "% of everything, " << result.slots << " slots): " << (result.requested ? 100.0 * result.hits / result.requested : 100.0) << "% hit rate, "
+            << result.uploads << " tiles loaded (" << uploadedMB << "MB, " << uploadedMB / frames * 60.0 << "MB/s at 60fps, copied at "
+            << (result.copyMs > 0.0 ? uploadedMB / (result.copyMs / 1000.0) : 0.0) << "MB/s), " << result.evictions << " evicted" << std::endl;
+        std::cout << "  the view wanted up to " << result.mostWanted << " tiles, more than fit on " << result.framesOverBudget << " frames, "
+            << result.overBudget << " loads put off for lack of room" << std::endl;
+    }
+    return 0;
+}